@@ -97,6 +97,11 @@ if (PANDA_TRACK_INTERNAL_ALLOCATIONS)
     add_definitions(-DTRACK_INTERNAL_ALLOCATIONS=${PANDA_TRACK_INTERNAL_ALLOCATIONS})
 endif()
 
+# Count hits and misses of the interpreter call site cache in release builds too, debug builds always count them
+if (PANDA_INTERPRETER_CACHE_STATISTICS)
+    add_definitions(-DPANDA_INTERPRETER_CACHE_STATISTICS)
+endif()
+
 if (PANDA_TARGET_ARM64 AND NOT PANDA_CI_TESTING_MODE STREQUAL "Nightly")
     if (PANDA_ENABLE_ADDRESS_SANITIZER OR PANDA_ENABLE_THREAD_SANITIZER)
         panda_set_flag(PANDA_ARM64_TESTS_WITH_SANITIZER)
@@ -100,6 +100,16 @@ public:
         return compilerTask_->GetVM();
     }
 
+    uint64_t GetQueueWaitTime() const
+    {
+        return compilerTask_->GetQueueWaitTime();
+    }
+
+    uint32_t GetEstimatedCost() const
+    {
+        return compilerTask_->GetEstimatedCost();
+    }
+
     ArenaAllocator *GetAllocator() const
     {
         return allocator_.get();
@@ -32,6 +32,9 @@
 #include "optimizer/code_generator/codegen.h"
 #include "libarkbase/utils/utils.h"
 
+#include <iomanip>
+#include <iostream>
+
 namespace ark::compiler {
 
 #ifdef PANDA_COMPILER_DEBUG_INFO
@@ -39,16 +42,19 @@ static Span<uint8_t> EmitElf(Graph *graph, CodeAllocator *codeAllocator, ArenaAl
                              const std::string &methodName);
 #endif
 
-void JITStats::SetCompilationStart()
+void JITStats::SetCompilationStart(uint64_t queueWaitTime, uint32_t estimatedCost)
 {
     ASSERT(startTime_ == 0);
     startTime_ = time::GetCurrentTimeInNanos();
+    queueWaitTime_ = queueWaitTime;
+    estimatedCost_ = estimatedCost;
 }
 void JITStats::EndCompilationWithStats(const std::string &methodName, bool isOsr, size_t bcSize, size_t codeSize)
 {
     ASSERT(startTime_ != 0);
     auto time = time::GetCurrentTimeInNanos() - startTime_;
-    statsList_.push_back(Entry {PandaString(methodName, internalAllocator_->Adapter()), isOsr, bcSize, codeSize, time});
+    statsList_.push_back(Entry {PandaString(methodName, internalAllocator_->Adapter()), isOsr, bcSize, codeSize, time,
+                                queueWaitTime_, estimatedCost_});
     startTime_ = 0;
 }
 
@@ -66,11 +72,45 @@ void JITStats::DumpCsv(char sep)
         csv << i.isOsr << sep;
         csv << i.bcSize << sep;
         csv << i.codeSize << sep;
-        csv << i.time;
+        csv << i.time << sep;
+        csv << i.queueWaitTime << sep;
+        csv << i.estimatedCost;
         csv << '\n';
     }
 }
 
+void JITStats::PrintStatistics() const
+{
+    // clang-format off
+#ifndef __clang_analyzer__
+    auto &out = std::cerr;
+    static constexpr auto OFFSET_DEFAULT = 12;
+    static constexpr auto OFFSET_OSR = 4;
+    static constexpr uint64_t NANOS_IN_MICRO = 1000;
+    out << std::dec
+        << std::setw(OFFSET_DEFAULT) << "Time,us" << std::setw(OFFSET_DEFAULT) << "Wait,ms"
+        << std::setw(OFFSET_DEFAULT) << "BC size" << std::setw(OFFSET_DEFAULT) << "Est. cost"
+        << std::setw(OFFSET_DEFAULT) << "Code size" << std::setw(OFFSET_OSR) << "OSR" << "  Method" << std::endl;
+    out << "-----------------------------------------------------------------------------\n";
+    uint64_t totalTime = 0;
+    uint64_t totalWait = 0;
+    size_t totalBcSize = 0;
+    for (const auto &i : statsList_) {
+        out << std::setw(OFFSET_DEFAULT) << i.time / NANOS_IN_MICRO << std::setw(OFFSET_DEFAULT) << i.queueWaitTime
+            << std::setw(OFFSET_DEFAULT) << i.bcSize << std::setw(OFFSET_DEFAULT) << i.estimatedCost
+            << std::setw(OFFSET_DEFAULT) << i.codeSize << std::setw(OFFSET_OSR) << i.isOsr << "  " << i.methodName
+            << std::endl;
+        totalTime += i.time;
+        totalWait += i.queueWaitTime;
+        totalBcSize += i.bcSize;
+    }
+    out << "-----------------------------------------------------------------------------\n";
+    out << std::setw(OFFSET_DEFAULT) << totalTime / NANOS_IN_MICRO << std::setw(OFFSET_DEFAULT) << totalWait
+        << std::setw(OFFSET_DEFAULT) << totalBcSize << "  TOTAL (" << statsList_.size() << " methods)" << std::endl;
+#endif
+    // clang-format on
+}
+
 struct EventCompilationArgs {
     const std::string methodName_;
     bool isOsr;
@@ -284,7 +324,7 @@ void JITCompileMethod(RuntimeInterface *runtime, CodeAllocator *codeAllocator, A
     }
 
     if (jitStats != nullptr) {
-        jitStats->SetCompilationStart();
+        jitStats->SetCompilationStart(taskCtx.GetQueueWaitTime(), taskCtx.GetEstimatedCost());
     }
 
     taskRunner.AddFinalize([jitStats](CompilerContext<RUNNER_MODE> &compilerCtx) {
@@ -37,25 +37,41 @@ public:
     NO_COPY_SEMANTIC(JITStats);
     ~JITStats()
     {
-        DumpCsv();
+        if (g_options.WasSetCompilerDumpJitStatsCsv()) {
+            DumpCsv();
+        }
+        if (g_options.IsCompilerPrintJitStats()) {
+            PrintStatistics();
+        }
     }
-    void SetCompilationStart();
+    /// @param queueWaitTime and @param estimatedCost are the compiler queue statistics of the task
+    void SetCompilationStart(uint64_t queueWaitTime = 0, uint32_t estimatedCost = 0);
     void EndCompilationWithStats(const std::string &methodName, bool isOsr, size_t bcSize, size_t codeSize);
     void ResetCompilationStart();
 
+    static bool IsEnabled()
+    {
+        return g_options.WasSetCompilerDumpJitStatsCsv() || g_options.IsCompilerPrintJitStats();
+    }
+
 private:
     void DumpCsv(char sep = ',');
+    void PrintStatistics() const;
     struct Entry {
         PandaString methodName;
         bool isOsr;
         size_t bcSize;
         size_t codeSize;
         uint64_t time;
+        uint64_t queueWaitTime;
+        uint32_t estimatedCost;
     };
 
 private:
     mem::InternalAllocatorPtr internalAllocator_;
     uint64_t startTime_ {};
+    uint64_t queueWaitTime_ {};
+    uint32_t estimatedCost_ {};
     std::vector<Entry, typename mem::AllocatorAdapter<Entry>> statsList_;
 };
 
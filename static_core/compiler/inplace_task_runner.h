@@ -79,6 +79,16 @@ public:
         compilationStatus_ = compilationStatus;
     }
 
+    void SetQueueWaitTime(uint64_t queueWaitTime)
+    {
+        queueWaitTime_ = queueWaitTime;
+    }
+
+    void SetEstimatedCost(uint32_t estimatedCost)
+    {
+        estimatedCost_ = estimatedCost;
+    }
+
     Method *GetMethod() const
     {
         return method_;
@@ -124,6 +134,16 @@ public:
         return compilationStatus_;
     }
 
+    uint64_t GetQueueWaitTime() const
+    {
+        return queueWaitTime_;
+    }
+
+    uint32_t GetEstimatedCost() const
+    {
+        return estimatedCost_;
+    }
+
 private:
     Method *method_ {nullptr};
     bool isOsr_ {false};
@@ -135,6 +155,9 @@ private:
     Pipeline *pipeline_ {nullptr};
     // Used only in JIT Compilation
     bool compilationStatus_ {false};
+    // Compiler queue statistics of the task, used only in JIT Compilation
+    uint64_t queueWaitTime_ {0};
+    uint32_t estimatedCost_ {0};
 };
 
 class InPlaceCompilerTaskRunner : public ark::TaskRunner<InPlaceCompilerTaskRunner, InPlaceCompilerContext> {
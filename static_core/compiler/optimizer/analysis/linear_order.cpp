@@ -14,6 +14,7 @@
  */
 
 #include "linear_order.h"
+#include <algorithm>
 #include "optimizer/analysis/loop_analyzer.h"
 #include "optimizer/ir/basicblock.h"
 #include "optimizer/ir/graph.h"
@@ -382,6 +383,67 @@ void LinearOrder::MarkSideExitsBlocks()
     }
 }
 
+static bool CanBeCold(const BasicBlock *block)
+{
+    return !block->IsStartBlock() && !block->IsEndBlock() && !block->IsTry() && !block->IsTryBegin() &&
+           !block->IsTryEnd() && !block->IsCatch() && !block->IsCatchBegin() && !block->IsOsrEntry();
+}
+
+bool LinearOrder::IsColdEdge(BasicBlock *block, const BasicBlock *succ)
+{
+    if (block->IsMarked(coldMarker_)) {
+        return true;
+    }
+    if (!block->IsIfBlock()) {
+        return false;
+    }
+    if (LeastLikelySuccessorByPreference(block) == succ) {
+        return true;
+    }
+    bool trueSucc = block->GetTrueSuccessor() == succ;
+    return GetBranchCounter(block, trueSucc) == 0 &&
+           GetBranchCounter(block, !trueSucc) >= g_options.GetCompilerColdBranchMinCounter();
+}
+
+// Block is cold if it is a side exit, if it is entered only through the cold edges or if it leads only to
+// the cold blocks. Both rules are applied until no more blocks are marked, since loops may need several passes.
+void LinearOrder::MarkColdBlocks()
+{
+    const auto &rpo = GetGraph()->GetBlocksRPO();
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto block : rpo) {
+            if (block->IsMarked(coldMarker_) || !CanBeCold(block)) {
+                continue;
+            }
+            const auto &preds = block->GetPredsBlocks();
+            if (block->IsMarked(blocksMarker_) ||
+                std::all_of(preds.begin(), preds.end(), [this, block](auto pred) { return IsColdEdge(pred, block); })) {
+                block->SetMarker(coldMarker_);
+                changed = true;
+            }
+        }
+        for (auto it = rpo.rbegin(); it != rpo.rend(); ++it) {
+            auto block = *it;
+            if (block->IsMarked(coldMarker_) || !CanBeCold(block)) {
+                continue;
+            }
+            const auto &succs = block->GetSuccsBlocks();
+            if (std::all_of(succs.begin(), succs.end(), [this](auto succ) { return succ->IsMarked(coldMarker_); })) {
+                block->SetMarker(coldMarker_);
+                changed = true;
+            }
+        }
+    }
+}
+
+void LinearOrder::MoveColdBlocksToEnd()
+{
+    std::stable_partition(reorderedBlocks_.begin(), reorderedBlocks_.end(),
+                          [this](auto block) { return !block->IsMarked(coldMarker_); });
+}
+
 void LinearOrder::DumpUnreachableBlocks()
 {
     std::cerr << "There are unreachable blocks:\n";
@@ -417,6 +479,12 @@ bool LinearOrder::RunImpl()
             DumpUnreachableBlocks();
         }
 #endif  // NDEBUG
+        if (g_options.IsCompilerSplitColdBlocks()) {
+            coldMarker_ = GetGraph()->NewMarker();
+            MarkColdBlocks();
+            MoveColdBlocksToEnd();
+            GetGraph()->EraseMarker(coldMarker_);
+        }
         MakeLinearOrder(reorderedBlocks_);
 
         GetGraph()->EraseMarker(marker_);
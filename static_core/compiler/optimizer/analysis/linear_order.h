@@ -29,6 +29,8 @@ class Graph;
  * - inverse type of IfInst if true-successor is placed first;
  * - marks `If` block with `JumpFlag` (so `Codegen` could insert `jmp`) if there are no `If` successors
  *   placed just after it;
+ * Cold blocks (side exits and blocks reachable only through branches, which are never taken according
+ * to the profile or unlikely according to the hints) are placed after all other blocks of the method.
  */
 class LinearOrder : public Analysis {
 public:
@@ -68,6 +70,9 @@ private:
     BasicBlock *LeastLikelySuccessorByPreference(const BasicBlock *block);
     // mark pre exit blocks without Retrurn and ReturnVoid instructions
     void MarkSideExitsBlocks();
+    void MarkColdBlocks();
+    bool IsColdEdge(BasicBlock *block, const BasicBlock *succ);
+    void MoveColdBlocksToEnd();
     int64_t GetBranchCounter(const BasicBlock *block, bool trueSucc);
     bool IsConditionChainCounter(const BasicBlock *block);
     int64_t GetConditionChainCounter(const BasicBlock *block, bool trueSucc);
@@ -78,6 +83,7 @@ private:
     void DFSAndDeferLeastFrequentBranches(BasicBlock *block, size_t *blocksCount);
     Marker marker_ {UNDEF_MARKER};
     Marker blocksMarker_ {UNDEF_MARKER};
+    Marker coldMarker_ {UNDEF_MARKER};
     ArenaVector<BasicBlock *> linearBlocks_;
     ArenaList<BasicBlock *> rpoBlocks_;
     ArenaVector<BasicBlock *> reorderedBlocks_;
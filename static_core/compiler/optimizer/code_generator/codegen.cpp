@@ -1407,11 +1407,15 @@ void Codegen::CreateNewObjCall(NewObjectInst *newObj)
         initClass = initClass->GetInput(0).GetInst();
     }
 
-    auto maxTlabSize = runtime->GetTLABMaxSize();
+    // Pretenured objects are allocated in the tenured TLABs, which are refilled by the tenured slow path
+    bool pretenured = runtime->IsAllocationSitePretenured(newObj->GetMethod(), newObj->GetPc());
+    auto runtimeEntrypoint =
+        pretenured ? EntrypointId::CREATE_TENURED_OBJECT_BY_CLASS : EntrypointId::CREATE_OBJECT_BY_CLASS;
+    auto maxTlabSize = pretenured ? runtime->GetTenuredTLABMaxSize() : runtime->GetTLABMaxSize();
     if (maxTlabSize == 0 ||
         (initClass->GetOpcode() != Opcode::LoadAndInitClass && initClass->GetOpcode() != Opcode::LoadImmediate)) {
         EVENT_CODEGEN("CallRuntime for NewObj");
-        CallRuntime(newObj, EntrypointId::CREATE_OBJECT_BY_CLASS, dst, RegMask::GetZeroMask(), src);
+        CallRuntime(newObj, runtimeEntrypoint, dst, RegMask::GetZeroMask(), src);
         return;
     }
     RuntimeInterface::ClassPtr klass;
@@ -1423,7 +1427,7 @@ void Codegen::CreateNewObjCall(NewObjectInst *newObj)
     }
     if (klass == nullptr || !runtime->CanUseTlabForClass(klass)) {
         EVENT_CODEGEN("CallRuntime for NewObj");
-        CallRuntime(newObj, EntrypointId::CREATE_OBJECT_BY_CLASS, dst, RegMask::GetZeroMask(), src);
+        CallRuntime(newObj, runtimeEntrypoint, dst, RegMask::GetZeroMask(), src);
         return;
     }
     auto classSize = runtime->GetClassSize(klass);
@@ -1432,12 +1436,12 @@ void Codegen::CreateNewObjCall(NewObjectInst *newObj)
     classSize = (classSize & ~(alignment - 1U)) + ((classSize % alignment) != 0U ? alignment : 0U);
     if (classSize > maxTlabSize) {
         EVENT_CODEGEN("CallRuntime for NewObj");
-        CallRuntime(newObj, EntrypointId::CREATE_OBJECT_BY_CLASS, dst, RegMask::GetZeroMask(), src);
+        CallRuntime(newObj, runtimeEntrypoint, dst, RegMask::GetZeroMask(), src);
         return;
     }
     EVENT_CODEGEN("CallFastPath for NewObj");
-    CallFastPath(newObj, EntrypointId::ALLOCATE_OBJECT_TLAB, dst, RegMask::GetZeroMask(), srcClass,
-                 TypedImm(classSize));
+    CallFastPath(newObj, pretenured ? EntrypointId::ALLOCATE_OBJECT_TENURED_TLAB : EntrypointId::ALLOCATE_OBJECT_TLAB,
+                 dst, RegMask::GetZeroMask(), srcClass, TypedImm(classSize));
 }
 
 void Codegen::CreateNewObjCallOld(NewObjectInst *newObj)
@@ -1449,6 +1453,10 @@ void Codegen::CreateNewObjCallOld(NewObjectInst *newObj)
     auto maxTlabSize = runtime->GetTLABMaxSize();
     auto encoder = GetEncoder();
 
+    if (runtime->IsAllocationSitePretenured(newObj->GetMethod(), newObj->GetPc())) {
+        CallRuntime(newObj, EntrypointId::CREATE_TENURED_OBJECT_BY_CLASS, dst, RegMask::GetZeroMask(), src);
+        return;
+    }
     if (maxTlabSize == 0 ||
         (initClass->GetOpcode() != Opcode::LoadAndInitClass && initClass->GetOpcode() != Opcode::LoadImmediate)) {
         CallRuntime(newObj, EntrypointId::CREATE_OBJECT_BY_CLASS, dst, RegMask::GetZeroMask(), src);
@@ -1335,6 +1335,18 @@ public:
         return false;
     }
 
+    /// @return true if the objects allocated at the bytecode @param pc of the method are allocated in tenured space
+    virtual bool IsAllocationSitePretenured([[maybe_unused]] MethodPtr method, [[maybe_unused]] uint32_t pc) const
+    {
+        return false;
+    }
+
+    /// @return max size of the pretenured objects allocated by the fast path in the tenured TLABs
+    virtual size_t GetTenuredTLABMaxSize() const
+    {
+        return 0;
+    }
+
     // TLAB offsets
     size_t GetCurrentTLABOffset(Arch arch) const
     {
@@ -2220,6 +2232,22 @@ inline constexpr std::array<const char *, DEOPT_COUNT> DEOPT_TYPE_NAMES = {"INVA
                                                                            "IFIMM_TRY",
                                                                            "ANY_IC"};
 
+// Element-wise operation applied by the LIB_CALL_VECTOR_* intrinsics, passed to them as an argument
+enum class VectorOp : uint32_t {
+    ADD = 0,
+    SUB,
+    // Scalar operand is the left one: value - array[i]
+    REVERSE_SUB,
+    MUL,
+    DIV,
+    // Scalar operand is the left one: value / array[i]
+    REVERSE_DIV,
+    AND,
+    OR,
+    XOR,
+    COUNT
+};
+
 inline const char *DeoptimizeTypeToString(DeoptimizeType deoptType)
 {
     auto idx = static_cast<uint8_t>(deoptType);
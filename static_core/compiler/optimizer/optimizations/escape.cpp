@@ -1082,9 +1082,13 @@ bool EscapeAnalysis::MergeProcessor::MergeState(StateOwner inst, BasicBlock *blo
     }
 
     if (materialize) {
-        newMaterialization =
-            parent_->GetState(block->GetDominator())->GetStateId(inst) != EscapeAnalysis::MATERIALIZED_ID;
-        parent_->Materialize(inst, block->GetDominator());
+        if (CanMaterializeInPredecessors(inst, block)) {
+            newMaterialization = MaterializeInPredecessors(inst, block);
+        } else {
+            newMaterialization =
+                parent_->GetState(block->GetDominator())->GetStateId(inst) != EscapeAnalysis::MATERIALIZED_ID;
+            parent_->Materialize(inst, block->GetDominator());
+        }
         newState->Materialize(inst);
         return newMaterialization;
     }
@@ -1120,6 +1124,107 @@ bool EscapeAnalysis::MergeProcessor::MergeState(StateOwner inst, BasicBlock *blo
     return newMaterialization;
 }
 
+// An object escaping on some paths to the merge block is materialized in the dominator of the block by default,
+// so it is allocated on every path going through the dominator. If the profile shows paths leaving the dominator
+// without reaching the merge, the object is materialized at the end of the predecessors where it is still virtual,
+// and the materialized objects are merged by a phi. So the object stays virtual on the paths not reaching the merge.
+bool EscapeAnalysis::MergeProcessor::CanMaterializeInPredecessors(StateOwner inst, BasicBlock *block)
+{
+    if (!std::holds_alternative<Inst *>(inst)) {
+        return false;
+    }
+    auto &merged = parent_->mergeMaterializations_;
+    if (auto it = merged.find(block); it != merged.end() && it->second.count(std::get<Inst *>(inst)) != 0) {
+        // Already materialized in the predecessors on the previous iterations
+        return true;
+    }
+    if (block->IsCatch() || block->IsTry() || block->IsLoopHeader()) {
+        return false;
+    }
+    VirtualState *vstate = nullptr;
+    bool hasMaterializedPred = false;
+    for (auto pred : block->GetPredsBlocks()) {
+        auto predState = parent_->GetState(pred)->GetState(inst);
+        if (predState == nullptr) {
+            hasMaterializedPred = true;
+            continue;
+        }
+        if ((vstate != nullptr && vstate->GetId() != predState->GetId()) || pred->GetSuccsBlocks().size() != 1U) {
+            return false;
+        }
+        vstate = predState;
+    }
+    if (vstate == nullptr || !hasMaterializedPred) {
+        return false;
+    }
+    auto alloc = vstate->GetInst();
+    // Materialization inside of the loop may create several objects instead of the one allocated outside of it
+    if (!LiveInAnalysis::IsAllocInst(alloc) || alloc->GetBasicBlock()->GetLoop() != block->GetLoop()) {
+        return false;
+    }
+    return IsMergeBypassed(block);
+}
+
+bool EscapeAnalysis::MergeProcessor::MaterializeInPredecessors(StateOwner inst, BasicBlock *block)
+{
+    auto &merged =
+        parent_->mergeMaterializations_.try_emplace(block, parent_->GetLocalAllocator()->Adapter()).first->second;
+    merged.insert(std::get<Inst *>(inst));
+    bool newMaterialization = false;
+    for (auto pred : block->GetPredsBlocks()) {
+        auto vstate = parent_->GetState(pred)->GetState(inst);
+        if (vstate == nullptr) {
+            continue;
+        }
+        COMPILER_LOG(DEBUG, PEA) << "Materialize " << *vstate->GetInst() << " in predecessor " << pred->GetId()
+                                 << " of merge block " << block->GetId();
+        merged.insert(vstate->GetInst());
+        parent_->Materialize(inst, pred);
+        newMaterialization = true;
+    }
+    return newMaterialization;
+}
+
+// Check whether the profile shows a path from the dominator of the block to the exit or to the next iteration
+// of the loop, which doesn't pass through the block. Only the branches taken according to the profile are followed,
+// so the objects are materialized in the dominator when there is no profile.
+bool EscapeAnalysis::MergeProcessor::IsMergeBypassed(BasicBlock *block)
+{
+    if (auto it = bypassedMerges_.find(block); it != bypassedMerges_.end()) {
+        return it->second;
+    }
+    auto graph = parent_->GetGraph();
+    auto dominator = block->GetDominator();
+    MarkerHolder visited {graph};
+    ArenaVector<BasicBlock *> worklist {parent_->GetLocalAllocator()->Adapter()};
+    worklist.push_back(dominator);
+    dominator->SetMarker(visited.GetMarker());
+    bool bypassed = false;
+    while (!worklist.empty()) {
+        auto current = worklist.back();
+        worklist.pop_back();
+        if (current->IsEndBlock() || !dominator->IsDominate(current)) {
+            bypassed = true;
+            break;
+        }
+        auto &succs = current->GetSuccsBlocks();
+        bool isBranch = succs.size() == MAX_SUCCS_NUM;
+        for (size_t idx = 0; idx < succs.size(); ++idx) {
+            auto succ = succs[idx];
+            if (succ == block || succ->IsMarked(visited.GetMarker())) {
+                continue;
+            }
+            if (isBranch && graph->GetBranchCounter(current, idx == 0) <= 0) {
+                continue;
+            }
+            succ->SetMarker(visited.GetMarker());
+            worklist.push_back(succ);
+        }
+    }
+    bypassedMerges_[block] = bypassed;
+    return bypassed;
+}
+
 template <bool NO_NEED_MERGE>
 bool EscapeAnalysis::MergeProcessor::MergeFields(BasicBlock *block, BasicBlockState *blockState, VirtualState *vstate)
 {
@@ -1241,7 +1346,7 @@ bool EscapeAnalysis::RunImpl()
         return decomposer.HasDecomposed();
     }
 
-    ScalarReplacement sr {GetGraph(), aliases_, phis_, materializationInfo_, saveStateInfo_};
+    ScalarReplacement sr {GetGraph(), aliases_, phis_, materializationInfo_, saveStateInfo_, mergeMaterializations_};
     sr.Apply(virtualizableAllocations_);
 
     return true;
@@ -2054,6 +2159,7 @@ Inst *ScalarReplacement::Materialize(Inst *originalInst, Inst *ssAlloc, Inst *ss
     auto &allocs = materializedObjects_.try_emplace(originalInst, graph_->GetLocalAllocator()->Adapter()).first->second;
     InitializeObject(newAlloc, ssInit, state, newAlloc);
     allocs.push_back(newAlloc);
+    materializationsCount_++;
     COMPILER_LOG(DEBUG, PEA) << "Materialized " << originalInst->GetId() << " at SavePoint " << ssAlloc->GetId()
                              << " as " << *newAlloc;
     return newAlloc;
@@ -2220,6 +2326,66 @@ Inst *ScalarReplacement::ResolveAllocation(Inst *inst, BasicBlock *block)
     return inst;
 }
 
+Inst *ScalarReplacement::FindDominatingAllocation(Inst *inst, BasicBlock *block) const
+{
+    auto it = materializedObjects_.find(inst);
+    if (it == materializedObjects_.end()) {
+        return nullptr;
+    }
+    for (auto alloc : it->second) {
+        if (alloc->GetBasicBlock()->IsDominate(block)) {
+            return alloc;
+        }
+    }
+    return nullptr;
+}
+
+// Objects materialized in the predecessors of a merge block don't dominate its users, so
+// the materialized objects are merged by a phi, which is used instead of the allocation below the merge.
+void ScalarReplacement::CreateMergePhis(const ArenaSet<Inst *> &candidates)
+{
+    ArenaVector<Inst *> inputs {graph_->GetLocalAllocator()->Adapter()};
+    for (auto block : graph_->GetBlocksRPO()) {
+        auto mergeIt = mergeMaterializations_.find(block);
+        if (mergeIt == mergeMaterializations_.end()) {
+            continue;
+        }
+        for (auto inst : mergeIt->second) {
+            if (!LiveInAnalysis::IsAllocInst(inst) || candidates.count(inst) == 0 ||
+                materializedObjects_.count(inst) == 0) {
+                continue;
+            }
+            inputs.clear();
+            for (auto pred : block->GetPredsBlocks()) {
+                inputs.push_back(FindDominatingAllocation(inst, pred));
+            }
+            if (std::find(inputs.begin(), inputs.end(), nullptr) != inputs.end() ||
+                std::all_of(inputs.begin(), inputs.end(), [first = inputs.front()](auto input) {
+                    return input == first;
+                })) {
+                continue;
+            }
+            auto phi = graph_->CreateInstPhi(DataType::REFERENCE, block->GetGuestPc());
+            for (auto input : inputs) {
+                phi->AppendInput(input);
+            }
+            block->AppendPhi(phi);
+            materializedObjects_[inst].push_back(phi);
+            COMPILER_LOG(DEBUG, PEA) << "Merged materializations of " << inst->GetId() << " in block "
+                                     << block->GetId() << " as " << *phi;
+        }
+    }
+}
+
+void ScalarReplacement::UpdateStatistics(const ArenaSet<Inst *> &candidates) const
+{
+    auto replaced = static_cast<size_t>(std::count_if(candidates.begin(), candidates.end(),
+                                                      [](auto inst) { return LiveInAnalysis::IsAllocInst(inst); }));
+    auto statistics = graph_->GetPassManager()->GetStatistics();
+    statistics->AddScalarReplacedAllocations(replaced);
+    statistics->AddMaterializedAllocations(materializationsCount_);
+}
+
 void ScalarReplacement::UpdateSaveStates()
 {
     ArenaVector<Inst *> queue {graph_->GetLocalAllocator()->Adapter()};
@@ -2342,6 +2508,7 @@ void ScalarReplacement::Apply(ArenaSet<Inst *> &candidates)
     removeInstMarker_ = graph_->NewMarker();
     CreatePhis();
     MaterializeObjects();
+    CreateMergePhis(candidates);
     ReplaceAliases();
     ResolvePhiInputs();
     UpdateSaveStates();
@@ -2351,6 +2518,7 @@ void ScalarReplacement::Apply(ArenaSet<Inst *> &candidates)
     UpdateAllocationUsers();
     ProcessRemovalQueue();
     PatchSaveStates();
+    UpdateStatistics(candidates);
     graph_->EraseMarker(removeInstMarker_);
 }
 
@@ -111,6 +111,7 @@ public:
           phis_(graph->GetLocalAllocator()->Adapter()),
           saveStateInfo_(graph->GetLocalAllocator()->Adapter()),
           virtualizableAllocations_(graph->GetLocalAllocator()->Adapter()),
+          mergeMaterializations_(graph->GetLocalAllocator()->Adapter()),
           mergeProcessor_(this),
           liveIns_(graph)
     {
@@ -297,7 +298,8 @@ private:
               statesMergeBuffer_(parent->GetLocalAllocator()->Adapter()),
               allFields_(parent->GetLocalAllocator()->Adapter()),
               pendingInsts_(parent->GetLocalAllocator()->Adapter()),
-              statesToMerge_(parent->GetLocalAllocator()->Adapter())
+              statesToMerge_(parent->GetLocalAllocator()->Adapter()),
+              bypassedMerges_(parent->GetLocalAllocator()->Adapter())
         {
         }
         ~MergeProcessor() = default;
@@ -314,6 +316,7 @@ private:
         ArenaVector<Field> allFields_;
         ArenaVector<StateOwner> pendingInsts_;
         ArenaVector<VirtualState *> statesToMerge_;
+        ArenaMap<BasicBlock *, bool> bypassedMerges_;
 
         template <bool NO_NEED_MERGE = true>
         bool MergeFields(BasicBlock *block, BasicBlockState *blockState, VirtualState *vstate);
@@ -326,6 +329,9 @@ private:
         void MaterializePhi(BasicBlockState *newState, Inst *phi);
         void VirtualizePhi(BasicBlock *block, BasicBlockState *newState, Inst *phi);
         void MergeNewAlloc(VirtualState *vstate);
+        bool CanMaterializeInPredecessors(StateOwner inst, BasicBlock *block);
+        bool MaterializeInPredecessors(StateOwner inst, BasicBlock *block);
+        bool IsMergeBypassed(BasicBlock *block);
     };
 
     Marker visited_ {UNDEF_MARKER};
@@ -337,6 +343,9 @@ private:
     ArenaVector<ArenaMap<FieldKey, PhiState *, FieldKeyComporator>> phis_;
     ArenaUnorderedMap<Inst *, ArenaBitVector> saveStateInfo_;
     ArenaSet<Inst *> virtualizableAllocations_;
+    // objects materialized in the predecessors of a merge block instead of its dominator,
+    // materialized objects are merged by a phi at the beginning of the block
+    ArenaMap<BasicBlock *, ArenaSet<Inst *>> mergeMaterializations_;
     MergeProcessor mergeProcessor_;
     LiveInAnalysis liveIns_;
     // 0 is materialized state
@@ -425,12 +434,14 @@ public:
     ScalarReplacement(Graph *graph, ArenaMap<Inst *, StateOwner> &aliases,
                       ArenaVector<ArenaMap<FieldKey, PhiState *, FieldKeyComporator>> &phis,
                       ArenaUnorderedMap<MaterializationSite, ArenaMap<Inst *, VirtualState *>> &materializationSites,
-                      ArenaUnorderedMap<Inst *, ArenaBitVector> &saveStateLiveness)
+                      ArenaUnorderedMap<Inst *, ArenaBitVector> &saveStateLiveness,
+                      ArenaMap<BasicBlock *, ArenaSet<Inst *>> &mergeMaterializations)
         : graph_(graph),
           aliases_(aliases),
           phis_(phis),
           materializationSites_(materializationSites),
           saveStateLiveness_(saveStateLiveness),
+          mergeMaterializations_(mergeMaterializations),
           allocatedPhis_(graph_->GetLocalAllocator()->Adapter()),
           materializedObjects_(graph_->GetLocalAllocator()->Adapter()),
           removalQueue_(graph_->GetLocalAllocator()->Adapter())
@@ -449,12 +460,14 @@ private:
     ArenaVector<ArenaMap<FieldKey, PhiState *, FieldKeyComporator>> &phis_;
     ArenaUnorderedMap<MaterializationSite, ArenaMap<Inst *, VirtualState *>> &materializationSites_;
     ArenaUnorderedMap<Inst *, ArenaBitVector> &saveStateLiveness_;
+    ArenaMap<BasicBlock *, ArenaSet<Inst *>> &mergeMaterializations_;
 
     ArenaMap<PhiState *, PhiInst *> allocatedPhis_;
     ArenaMap<Inst *, ArenaVector<Inst *>> materializedObjects_;
 
     ArenaVector<Inst *> removalQueue_;
     Marker removeInstMarker_ {UNDEF_MARKER};
+    size_t materializationsCount_ {0};
 
     void ProcessRemovalQueue();
     bool IsEnqueuedForRemoval(Inst *inst) const;
@@ -462,6 +475,9 @@ private:
     void UpdateAllocationUsers();
     void UpdateSaveStates();
     Inst *ResolveAllocation(Inst *inst, BasicBlock *block);
+    Inst *FindDominatingAllocation(Inst *inst, BasicBlock *block) const;
+    void CreateMergePhis(const ArenaSet<Inst *> &candidates);
+    void UpdateStatistics(const ArenaSet<Inst *> &candidates) const;
     void ResolvePhiInputs();
     void ReplaceAliases();
     Inst *ResolveAlias(const StateOwner &alias, const Inst *inst);
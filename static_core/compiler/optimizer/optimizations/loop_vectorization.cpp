@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler_logger.h"
+#include "optimizer/analysis/countable_loop_parser.h"
+#include "optimizer/ir/analysis.h"
+#include "optimizer/ir/basicblock.h"
+#include "optimizer/ir/graph.h"
+#include "optimizer/optimizations/loop_vectorization.h"
+
+// CC-OFFNXT(G.PRE.02) necessary macro
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_VECTORIZATION(level) COMPILER_LOG(level, LOOP_TRANSFORM) << "[Vectorization] "
+
+namespace ark::compiler {
+bool LoopVectorization::RunImpl()
+{
+    if (GetGraph()->GetArch() == Arch::AARCH32) {
+        // Kernels are called with the native calling convention, which is not supported on Arm32.
+        return false;
+    }
+    GetGraph()->RunPass<LoopAnalyzer>();
+    RunLoopsVisitor();
+    return isApplied_;
+}
+
+void LoopVectorization::InvalidateAnalyses()
+{
+    GetGraph()->InvalidateAnalysis<LoopAnalyzer>();
+    InvalidateBlocksOrderAnalyzes(GetGraph());
+}
+
+static bool AllUsesWithinLoop(Inst *inst, const Loop *loop)
+{
+    for (auto &user : inst->GetUsers()) {
+        if (user.GetInst()->GetBasicBlock()->GetLoop() != loop) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Parses a single block countable loop `for (i = init; i < test; i++) dst[i] = lhs op rhs`,
+ * where each of the operands is either `src[i]` or a loop invariant value, but not both are invariant
+ * (that is an array init idiom).
+ * All the arrays are accessed by the loop index only, so the iteration reads only the elements it writes
+ * and the loop may be vectorized even if some of the arrays are the same.
+ */
+// NOLINTNEXTLINE(fuchsia-multiple-inheritance)
+class ElementWiseLoopParser : private CountableLoopParser, private MarkerHolder {
+public:
+    explicit ElementWiseLoopParser(Loop *loop) : CountableLoopParser(*loop), MarkerHolder(GetGraph(loop)) {}
+
+    bool Parse()
+    {
+        if (!CountableLoopParser::Parse() || loopInfo_.constStep != 1 || !loopInfo_.isInc ||
+            loopInfo_.walkType != WalkType::INC || loopInfo_.normalizedCc != ConditionCode::CC_LT ||
+            loopInfo_.index->GetType() != DataType::INT32) {
+            LOG_VECTORIZATION(DEBUG) << "Loop shape doesn't match";
+            return false;
+        }
+        if (!FindStore() || !CheckOperation() || !CheckLoopIsolation()) {
+            LOG_VECTORIZATION(DEBUG) << "Dataflow pattern doesn't match";
+            return false;
+        }
+        return true;
+    }
+
+    const CountableLoopInfo &GetLoopInfo() const
+    {
+        return loopInfo_;
+    }
+
+    IntrinsicInst *CreateIntrinsic()
+    {
+        auto graph = GetGraph(&loop_);
+        bool isScalar = scalar_ != nullptr;
+        auto intrinsic = graph->CreateInstIntrinsic(DataType::VOID, store_->GetPc(), GetIntrinsicId(isScalar));
+        intrinsic->ClearFlag(inst_flags::Flags::REQUIRE_STATE);
+        intrinsic->ClearFlag(inst_flags::Flags::RUNTIME_CALL);
+        intrinsic->ClearFlag(inst_flags::Flags::CAN_THROW);
+        auto op = graph->FindOrCreateConstant(static_cast<uint32_t>(GetVectorOp()));
+        Inst *rhs = isScalar ? scalar_ : loads_[1U]->GetArray();
+        auto rhsType = isScalar ? GetScalarType() : DataType::REFERENCE;
+        intrinsic->SetInputs(graph->GetAllocator(), {{store_->GetArray(), DataType::REFERENCE},
+                                                     {loads_[0]->GetArray(), DataType::REFERENCE},
+                                                     {rhs, rhsType},
+                                                     {op, DataType::INT32},
+                                                     {loopInfo_.init, DataType::INT32},
+                                                     {loopInfo_.test, DataType::INT32}});
+        return intrinsic;
+    }
+
+private:
+    static Graph *GetGraph(const Loop *loop)
+    {
+        return loop->GetHeader()->GetGraph();
+    }
+
+    bool IsFloat() const
+    {
+        return DataType::IsFloatType(store_->GetType());
+    }
+
+    size_t GetTypeSize(DataType::Type type) const
+    {
+        return DataType::GetTypeSize(type, GetGraph(&loop_)->GetArch());
+    }
+
+    size_t GetElementSize() const
+    {
+        return GetTypeSize(store_->GetType());
+    }
+
+    static bool IsIntegerType(DataType::Type type)
+    {
+        return DataType::IsTypeNumeric(type) && !DataType::IsFloatType(type);
+    }
+
+    static bool IsSupportedElementType(DataType::Type type)
+    {
+        switch (type) {
+            case DataType::INT8:
+            case DataType::UINT8:
+            case DataType::INT16:
+            case DataType::UINT16:
+            case DataType::INT32:
+            case DataType::UINT32:
+            case DataType::INT64:
+            case DataType::UINT64:
+            case DataType::FLOAT32:
+            case DataType::FLOAT64:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool FindStore()
+    {
+        for (auto inst : loop_.GetHeader()->Insts()) {
+            if (inst->GetOpcode() != Opcode::StoreArray) {
+                continue;
+            }
+            if (store_ != nullptr) {
+                return false;
+            }
+            store_ = inst->CastToStoreArray();
+        }
+        return store_ != nullptr && store_->GetIndex() == loopInfo_.index && IsSupportedElementType(store_->GetType());
+    }
+
+    bool IsSupportedOperation(Inst *inst) const
+    {
+        if (inst->GetBasicBlock() != loop_.GetHeader()) {
+            return false;
+        }
+        switch (inst->GetOpcode()) {
+            case Opcode::Add:
+            case Opcode::Sub:
+            case Opcode::Mul:
+                break;
+            case Opcode::Div:
+                // Integer division requires the zero check
+                if (!IsFloat()) {
+                    return false;
+                }
+                break;
+            case Opcode::And:
+            case Opcode::Or:
+            case Opcode::Xor:
+                if (IsFloat()) {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+        auto type = inst->GetType();
+        if (IsFloat()) {
+            return type == store_->GetType();
+        }
+        // Low bits of the integer results depend only on the low bits of the operands,
+        // so the operation may be computed in the narrower element type
+        return IsIntegerType(type) && GetTypeSize(type) >= GetElementSize();
+    }
+
+    bool IsSupportedLoad(Inst *inst) const
+    {
+        if (inst->GetOpcode() != Opcode::LoadArray || inst->GetBasicBlock() != loop_.GetHeader()) {
+            return false;
+        }
+        auto load = inst->CastToLoadArray();
+        auto type = load->GetType();
+        if (!load->IsArray() || load->GetIndex() != loopInfo_.index || !IsSupportedElementType(type)) {
+            return false;
+        }
+        if (IsFloat()) {
+            return type == store_->GetType();
+        }
+        return IsIntegerType(type) && GetTypeSize(type) == GetElementSize();
+    }
+
+    bool IsSupportedScalar(Inst *inst) const
+    {
+        if (inst->GetBasicBlock()->GetLoop() == &loop_) {
+            return false;
+        }
+        auto type = inst->GetType();
+        if (IsFloat()) {
+            return type == store_->GetType();
+        }
+        // Integer constants are 64-bit, the kernels use the low bits of the value only
+        return IsIntegerType(type);
+    }
+
+    bool CheckOperation()
+    {
+        operation_ = store_->GetStoredValue();
+        if (!IsSupportedOperation(operation_)) {
+            return false;
+        }
+        auto lhs = operation_->GetInput(0).GetInst();
+        auto rhs = operation_->GetInput(1).GetInst();
+        if (IsSupportedLoad(lhs)) {
+            loads_[0] = lhs->CastToLoadArray();
+            if (IsSupportedLoad(rhs)) {
+                loads_[1U] = rhs->CastToLoadArray();
+                return true;
+            }
+            if (IsSupportedScalar(rhs)) {
+                scalar_ = rhs;
+                return true;
+            }
+            return false;
+        }
+        if (IsSupportedLoad(rhs) && IsSupportedScalar(lhs)) {
+            loads_[0] = rhs->CastToLoadArray();
+            scalar_ = lhs;
+            scalarIsLhs_ = true;
+            return true;
+        }
+        return false;
+    }
+
+    bool CheckLoopIsolation()
+    {
+        auto compare = loopInfo_.ifImm->GetInput(0).GetInst();
+        ASSERT(compare->GetOpcode() == Opcode::Compare);
+        std::array<Inst *, 7U> matched = {loopInfo_.ifImm, compare,    loopInfo_.update, loopInfo_.index,
+                                          store_,          operation_, loads_[0]};
+        for (Inst *inst : matched) {
+            ASSERT(inst->GetBasicBlock()->GetLoop() == &loop_);
+            if (!AllUsesWithinLoop(inst, &loop_)) {
+                LOG_VECTORIZATION(DEBUG) << "Inst '" << inst->GetId() << ".' used outside";
+                return false;
+            }
+            inst->SetMarker(GetMarker());
+        }
+        if (loads_[1U] != nullptr) {
+            if (!AllUsesWithinLoop(loads_[1U], &loop_)) {
+                return false;
+            }
+            loads_[1U]->SetMarker(GetMarker());
+        }
+
+        for (auto inst : loop_.GetHeader()->AllInsts()) {
+            if (inst->IsMarked(GetMarker())) {
+                continue;
+            }
+            if ((inst->IsCall() && static_cast<CallInst *>(inst)->IsInlined()) ||
+                inst->GetOpcode() == Opcode::ReturnInlined) {
+                continue;
+            }
+            auto opcode = inst->GetOpcode();
+            if (opcode == Opcode::NOP || opcode == Opcode::SaveState || opcode == Opcode::SafePoint) {
+                continue;
+            }
+            LOG_VECTORIZATION(DEBUG) << "Inst '" << inst->GetId() << ".' breaks pattern";
+            return false;
+        }
+        return true;
+    }
+
+    VectorOp GetVectorOp() const
+    {
+        switch (operation_->GetOpcode()) {
+            case Opcode::Add:
+                return VectorOp::ADD;
+            case Opcode::Sub:
+                return scalarIsLhs_ ? VectorOp::REVERSE_SUB : VectorOp::SUB;
+            case Opcode::Mul:
+                return VectorOp::MUL;
+            case Opcode::Div:
+                return scalarIsLhs_ ? VectorOp::REVERSE_DIV : VectorOp::DIV;
+            case Opcode::And:
+                return VectorOp::AND;
+            case Opcode::Or:
+                return VectorOp::OR;
+            case Opcode::Xor:
+                return VectorOp::XOR;
+            default:
+                UNREACHABLE();
+        }
+    }
+
+    DataType::Type GetScalarType() const
+    {
+        if (IsFloat()) {
+            return store_->GetType();
+        }
+        return GetElementSize() == GetTypeSize(DataType::INT64) ? DataType::INT64 : DataType::INT32;
+    }
+
+    RuntimeInterface::IntrinsicId GetIntrinsicId(bool isScalar) const
+    {
+        using IntrinsicId = RuntimeInterface::IntrinsicId;
+        switch (store_->GetType()) {
+            case DataType::INT8:
+            case DataType::UINT8:
+                return isScalar ? IntrinsicId::LIB_CALL_VECTOR_SCALAR_8 : IntrinsicId::LIB_CALL_VECTOR_ARRAY_8;
+            case DataType::INT16:
+            case DataType::UINT16:
+                return isScalar ? IntrinsicId::LIB_CALL_VECTOR_SCALAR_16 : IntrinsicId::LIB_CALL_VECTOR_ARRAY_16;
+            case DataType::INT32:
+            case DataType::UINT32:
+                return isScalar ? IntrinsicId::LIB_CALL_VECTOR_SCALAR_32 : IntrinsicId::LIB_CALL_VECTOR_ARRAY_32;
+            case DataType::INT64:
+            case DataType::UINT64:
+                return isScalar ? IntrinsicId::LIB_CALL_VECTOR_SCALAR_64 : IntrinsicId::LIB_CALL_VECTOR_ARRAY_64;
+            case DataType::FLOAT32:
+                return isScalar ? IntrinsicId::LIB_CALL_VECTOR_SCALAR_F32 : IntrinsicId::LIB_CALL_VECTOR_ARRAY_F32;
+            case DataType::FLOAT64:
+                return isScalar ? IntrinsicId::LIB_CALL_VECTOR_SCALAR_F64 : IntrinsicId::LIB_CALL_VECTOR_ARRAY_F64;
+            default:
+                UNREACHABLE();
+        }
+    }
+
+    StoreInst *store_ {nullptr};
+    Inst *operation_ {nullptr};
+    std::array<LoadInst *, 2U> loads_ {};
+    Inst *scalar_ {nullptr};
+    bool scalarIsLhs_ {false};
+};
+
+bool LoopVectorization::TransformLoop(Loop *loop)
+{
+    if (!loop->GetInnerLoops().empty() || loop->GetBlocks().size() != 1) {
+        return false;
+    }
+    ElementWiseLoopParser parser(loop);
+    if (!parser.Parse()) {
+        return false;
+    }
+    const auto &loopInfo = parser.GetLoopInfo();
+
+    bool alwaysJump = false;
+    if (loopInfo.init->IsConst() && loopInfo.test->IsConst()) {
+        auto iterations =
+            loopInfo.test->CastToConstant()->GetIntValue() - loopInfo.init->CastToConstant()->GetIntValue();
+        if (iterations <= ITERATIONS_THRESHOLD) {
+            LOG_VECTORIZATION(DEBUG) << "Loop " << loop->GetId() << " will have " << iterations
+                                     << " iterations, so it is not vectorized";
+            return false;
+        }
+        alwaysJump = true;
+    }
+
+    auto intrinsic = parser.CreateIntrinsic();
+    ReplaceLoop(loop, loopInfo, intrinsic, alwaysJump);
+    isApplied_ = true;
+    return false;
+}
+
+void LoopVectorization::ReplaceLoop(Loop *loop, const CountableLoopInfo &loopInfo, IntrinsicInst *intrinsic,
+                                    bool alwaysJump)
+{
+    auto header = loop->GetHeader();
+    auto preHeader = loop->GetPreHeader();
+
+    auto loopSucc = header->GetSuccessor(0) == header ? header->GetSuccessor(1) : header->GetSuccessor(0);
+    if (alwaysJump) {
+        // insert block before disconnecting header to properly handle Phi in loop_succ
+        auto block = header->InsertNewBlockToSuccEdge(loopSucc);
+        preHeader->ReplaceSucc(header, block, true);
+        GetGraph()->DisconnectBlock(header, false, false);
+        block->AppendInst(intrinsic);
+
+        LOG_VECTORIZATION(INFO) << "Replaced loop " << loop->GetId() << " with the instruction " << *intrinsic
+                                << " inserted into the new block " << block->GetId();
+        return;
+    }
+    // Short loops are left scalar, as the call overhead is not paid off
+    auto guardBlock = preHeader->InsertNewBlockToSuccEdge(header);
+    auto sub = GetGraph()->CreateInstSub(DataType::INT32, intrinsic->GetPc(), loopInfo.test, loopInfo.init);
+    auto cmp = GetGraph()->CreateInstCompare(DataType::BOOL, intrinsic->GetPc(), sub,
+                                             GetGraph()->FindOrCreateConstant(ITERATIONS_THRESHOLD), DataType::INT32,
+                                             ConditionCode::CC_LE);
+    auto ifImm = GetGraph()->CreateInstIfImm(DataType::NO_TYPE, intrinsic->GetPc(), cmp, 0, DataType::BOOL,
+                                             ConditionCode::CC_NE);
+    guardBlock->AppendInst(sub);
+    guardBlock->AppendInst(cmp);
+    guardBlock->AppendInst(ifImm);
+
+    auto mergeBlock = header->InsertNewBlockToSuccEdge(loopSucc);
+    auto intrinsicBlock = GetGraph()->CreateEmptyBlock();
+
+    guardBlock->AddSucc(intrinsicBlock);
+    intrinsicBlock->AddSucc(mergeBlock);
+    intrinsicBlock->AppendInst(intrinsic);
+
+    LOG_VECTORIZATION(INFO) << "Inserted conditional jump into intrinsic " << *intrinsic << " before loop "
+                            << loop->GetId() << ", inserted blocks: " << intrinsicBlock->GetId() << ", "
+                            << guardBlock->GetId() << ", " << mergeBlock->GetId();
+}
+
+}  // namespace ark::compiler
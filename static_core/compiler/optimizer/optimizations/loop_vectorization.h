@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_COMPILER_OPTIMIZER_OPTIMIZATIONS_LOOP_VECTORIZATION_H
+#define PANDA_COMPILER_OPTIMIZER_OPTIMIZATIONS_LOOP_VECTORIZATION_H
+
+#include "optimizer/optimizations/loop_transform.h"
+#include "compiler_options.h"
+
+// Find loops applying an element-wise arithmetic operation to arrays, i.e. `dst[i] = a[i] op b[i]` or
+// `dst[i] = a[i] op value`, and replace them with an intrinsic, which processes the arrays with SIMD instructions.
+// Only LoadArray/StoreArray of primitive arrays are matched: accesses of escompat typed arrays and reductions
+// (sum, min, max into a loop-carried scalar) stay scalar.
+namespace ark::compiler {
+
+struct CountableLoopInfo;
+
+class LoopVectorization : public LoopTransform<LoopExitPoint::LOOP_EXIT_HEADER> {
+public:
+    explicit LoopVectorization(Graph *graph) : LoopTransform(graph) {}
+    ~LoopVectorization() override = default;
+    NO_COPY_SEMANTIC(LoopVectorization);
+    NO_MOVE_SEMANTIC(LoopVectorization);
+
+    bool RunImpl() override;
+
+    bool IsEnable() const override
+    {
+        return g_options.IsCompilerLoopVectorization();
+    }
+
+    const char *GetPassName() const override
+    {
+        return "LoopVectorization";
+    }
+
+    void InvalidateAnalyses() override;
+
+private:
+    // Jump into intrinsic only if there will be more iterations
+    static constexpr size_t ITERATIONS_THRESHOLD = 16;
+
+    bool TransformLoop(Loop *loop) override;
+    void ReplaceLoop(Loop *loop, const CountableLoopInfo &loopInfo, IntrinsicInst *intrinsic, bool alwaysJump);
+
+    bool isApplied_ {false};
+};
+
+}  // namespace ark::compiler
+
+#endif  // PANDA_COMPILER_OPTIMIZER_OPTIMIZATIONS_LOOP_VECTORIZATION_H
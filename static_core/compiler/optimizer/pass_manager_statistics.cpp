@@ -68,6 +68,8 @@ void PassManagerStatistics::PrintStatistics() const
         << std::setw(OFFSET_DEFAULT) << graph_->GetLocalAllocator()->GetAllocatedSize()
         << std::setw(OFFSET_DEFAULT) << total_time << std::endl;
     out << "PBC instruction number : " << pbcInstNum_ << std::endl;
+    out << "Scalar replaced allocations : " << scalarReplacedAllocations_ << ", materialized at "
+        << materializedAllocations_ << " sites" << std::endl;
 #endif
     // clang-format on
 }
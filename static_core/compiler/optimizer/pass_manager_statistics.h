@@ -48,6 +48,24 @@ public:
         return inlinedMethods_;
     }
 
+    auto AddScalarReplacedAllocations(size_t num)
+    {
+        scalarReplacedAllocations_ += num;
+    }
+    auto GetScalarReplacedAllocations() const
+    {
+        return scalarReplacedAllocations_;
+    }
+
+    auto AddMaterializedAllocations(size_t num)
+    {
+        materializedAllocations_ += num;
+    }
+    auto GetMaterializedAllocations() const
+    {
+        return materializedAllocations_;
+    }
+
     auto AddPbcInstNum(uint64_t num)
     {
         pbcInstNum_ += num;
@@ -102,6 +120,10 @@ private:
 
     // Count of inlined methods
     size_t inlinedMethods_ {0};
+    // Count of allocations removed by the scalar replacement
+    size_t scalarReplacedAllocations_ {0};
+    // Count of allocations created where the scalar replaced objects escape
+    size_t materializedAllocations_ {0};
     // Number of pbc instructions in main and all successfully inlined methods.
     uint64_t pbcInstNum_ {0};
 
@@ -46,6 +46,7 @@
 #include "optimizer/optimizations/loop_peeling.h"
 #include "optimizer/optimizations/loop_unswitch.h"
 #include "optimizer/optimizations/loop_unroll.h"
+#include "optimizer/optimizations/loop_vectorization.h"
 #include "optimizer/optimizations/lower_boxed_boolean.h"
 #include "optimizer/optimizations/lowering.h"
 #include "optimizer/optimizations/lse.h"
@@ -245,6 +246,7 @@ bool Pipeline::RunOptimizations()
         graph->RunPass<Peepholes>();
     }
     graph->RunPass<LoopIdioms>();
+    graph->RunPass<LoopVectorization>();
     graph->RunPass<LoopUnroll>(g_options.GetCompilerLoopUnrollInstLimit(), g_options.GetCompilerLoopUnrollFactor());
     OptimizationsAfterUnroll(graph);
     graph->RunPass<Peepholes>();
@@ -28,6 +28,7 @@ inline const RuntimeInterface::FieldPtr UINT8_FIELD = reinterpret_cast<void *>(0
 inline const RuntimeInterface::FieldPtr INT8_FIELD = reinterpret_cast<void *>(0xB00B01UL);
 inline const RuntimeInterface::ClassPtr INT32_CLASS = reinterpret_cast<void *>(0xDEAD5320U);
 inline const RuntimeInterface::IdType CUSTOM_CLASS_ID = 0xDEAD1337U;
+inline const RuntimeInterface::MethodPtr PROFILED_METHOD = reinterpret_cast<void *>(0xDEADC0DEU);
 inline const RuntimeInterface::ClassPtr CUSTOM_CLASS = reinterpret_cast<void *>(0x00133700U);
 
 class EscapeAnalysisTest : public GraphTest {
@@ -613,6 +614,145 @@ TEST_F(EscapeAnalysisTest, MergeDifferentMaterializedStatesForSameArray)
     ASSERT_TRUE(GraphComparator().Compare(GetGraph(), graph));
 }
 
+SRC_GRAPH(MaterializeInMergePredecessors, Graph *graph)
+{
+    GRAPH(graph)
+    {
+        // NOLINTBEGIN(readability-magic-numbers)
+        PARAMETER(0U, 0U).u64();
+        CONSTANT(1U, 0U);
+
+        BASIC_BLOCK(2U, 3U, 4U)
+        {
+            INST(2U, Opcode::SaveState).SrcVregs({0U}).Inputs(0U);
+            INST(3U, Opcode::LoadAndInitClass).ref().Inputs(2U);
+            INST(4U, Opcode::NewObject).ref().Inputs(3U, 2U);
+            INST(5U, Opcode::IfImm).SrcType(DataType::UINT64).Imm(0U).CC(CC_NE).Inputs(0U).Pc(10U);
+        }
+
+        BASIC_BLOCK(3U, 5U)
+        {
+            INST(6U, Opcode::SaveState).SrcVregs({0U, 1U}).Inputs(0U, 4U);
+            INST(7U, Opcode::CallStatic).v0id().InputsAutoType(4U, 6U);
+        }
+
+        BASIC_BLOCK(4U, 6U, 7U)
+        {
+            INST(8U, Opcode::IfImm).SrcType(DataType::UINT64).Imm(1U).CC(CC_EQ).Inputs(0U).Pc(20U);
+        }
+
+        BASIC_BLOCK(6U, 5U) {}
+
+        BASIC_BLOCK(5U, -1L)
+        {
+            INST(9U, Opcode::SaveState).SrcVregs({0U, 1U}).Inputs(0U, 4U);
+            INST(10U, Opcode::NullCheck).ref().Inputs(4U, 9U);
+            INST(11U, Opcode::LoadObject).u64().Inputs(10U);
+            INST(12U, Opcode::Return).Inputs(11U).u64();
+        }
+
+        BASIC_BLOCK(7U, -1L)
+        {
+            INST(13U, Opcode::Return).Inputs(1U).u64();
+        }
+        // NOLINTEND(readability-magic-numbers)
+    }
+}
+
+OUT_GRAPH(MaterializeInMergePredecessors, Graph *graph)
+{
+    GRAPH(graph)
+    {
+        // NOLINTBEGIN(readability-magic-numbers)
+        PARAMETER(0U, 0U).u64();
+        CONSTANT(1U, 0U);
+
+        BASIC_BLOCK(2U, 3U, 4U)
+        {
+            INST(2U, Opcode::SaveState).SrcVregs({0U}).Inputs(0U);
+            INST(3U, Opcode::LoadAndInitClass).ref().Inputs(2U);
+            INST(5U, Opcode::IfImm).SrcType(DataType::UINT64).Imm(0U).CC(CC_NE).Inputs(0U);
+        }
+
+        BASIC_BLOCK(3U, 5U)
+        {
+            INST(14U, Opcode::SaveState).SrcVregs({0U}).Inputs(0U);
+            INST(4U, Opcode::NewObject).ref().Inputs(3U, 14U);
+            INST(6U, Opcode::SaveState).SrcVregs({0U, 1U}).Inputs(0U, 4U);
+            INST(7U, Opcode::CallStatic).v0id().InputsAutoType(4U, 6U);
+        }
+
+        BASIC_BLOCK(4U, 6U, 7U)
+        {
+            INST(8U, Opcode::IfImm).SrcType(DataType::UINT64).Imm(1U).CC(CC_EQ).Inputs(0U);
+        }
+
+        BASIC_BLOCK(6U, 5U)
+        {
+            INST(15U, Opcode::SaveState);
+            INST(16U, Opcode::NewObject).ref().Inputs(3U, 15U);
+        }
+
+        BASIC_BLOCK(5U, -1L)
+        {
+            INST(17U, Opcode::Phi).ref().Inputs(4U, 16U);
+            INST(9U, Opcode::SaveState).SrcVregs({0U, 1U}).Inputs(0U, 17U);
+            INST(10U, Opcode::NullCheck).ref().Inputs(17U, 9U);
+            INST(11U, Opcode::LoadObject).u64().Inputs(10U);
+            INST(12U, Opcode::Return).Inputs(11U).u64();
+        }
+
+        BASIC_BLOCK(7U, -1L)
+        {
+            INST(13U, Opcode::Return).Inputs(1U).u64();
+        }
+        // NOLINTEND(readability-magic-numbers)
+    }
+}
+
+TEST_F(EscapeAnalysisTest, MaterializeInMergePredecessors)
+{
+    static constexpr uint32_t DOMINATOR_BRANCH_ID = 5;
+    static constexpr uint32_t BYPASS_BRANCH_ID = 8;
+    static constexpr uint32_t DOMINATOR_BRANCH_PC = 10;
+    static constexpr uint32_t BYPASS_BRANCH_PC = 20;
+    static constexpr int64_t COUNTER = 100;
+    src_graph::MaterializeInMergePredecessors::CREATE(GetGraph());
+    // Branch counters are read only for the branches from the bytecode
+    INS(DOMINATOR_BRANCH_ID).CastToIfImm()->SetMethod(PROFILED_METHOD);
+    INS(BYPASS_BRANCH_ID).CastToIfImm()->SetMethod(PROFILED_METHOD);
+    RegisterBranchCounters(DOMINATOR_BRANCH_PC, COUNTER, COUNTER);
+    RegisterBranchCounters(BYPASS_BRANCH_PC, COUNTER, COUNTER);
+
+    // The object escapes in block 3 only, so it is not allocated on the path through block 7
+    ASSERT_TRUE(Run());
+
+    auto graph = CreateEmptyGraph();
+    out_graph::MaterializeInMergePredecessors::CREATE(graph);
+    ASSERT_TRUE(GraphComparator().Compare(GetGraph(), graph));
+
+    auto statistics = GetGraph()->GetPassManager()->GetStatistics();
+    ASSERT_EQ(statistics->GetScalarReplacedAllocations(), 1U);
+    ASSERT_EQ(statistics->GetMaterializedAllocations(), 2U);
+}
+
+TEST_F(EscapeAnalysisTest, MaterializeInDominatorWithoutProfile)
+{
+    src_graph::MaterializeInMergePredecessors::CREATE(GetGraph());
+
+    ASSERT_TRUE(Run());
+
+    // Without the profile the object is allocated in block 2 before the branch
+    auto statistics = GetGraph()->GetPassManager()->GetStatistics();
+    ASSERT_EQ(statistics->GetMaterializedAllocations(), 1U);
+    for (auto inst : GetGraph()->GetStartBlock()->GetSuccessor(0U)->Insts()) {
+        if (inst->GetOpcode() == Opcode::NewObject) {
+            return;
+        }
+    }
+    FAIL() << "Object is not materialized in the dominator of the merge block";
+}
+
 TEST_F(EscapeAnalysisTest, ObjectEscapement)
 {
     GRAPH(GetGraph())
@@ -345,6 +345,62 @@ TEST_F(LinearOrderTest, ThrowBlock2)
     ASSERT_EQ(&BB(4U), blocks3.back());
 }
 
+TEST_F(LinearOrderTest, ColdBlocksAtTheEnd)
+{
+    auto graph = CreateGraphWithDefaultRuntime();
+    GRAPH(graph)
+    {
+        PARAMETER(0U, 0U).s32();
+        PARAMETER(1U, 1U).ref();
+        CONSTANT(2U, 1U);
+
+        BASIC_BLOCK(2U, 3U, 4U)
+        {
+            INST(3U, Opcode::IfImm).SrcType(DataType::INT32).CC(CC_LT).Imm(0U).Inputs(0U);
+        }
+        // Leads only to the side exit
+        BASIC_BLOCK(3U, 5U)
+        {
+            INST(4U, Opcode::Add).s32().Inputs(0U, 2U);
+        }
+        BASIC_BLOCK(5U, -1L)
+        {
+            INST(5U, Opcode::SaveState).Inputs(0U, 4U).SrcVregs({0U, 1U});
+            INST(6U, Opcode::Throw).Inputs(1U, 5U);
+        }
+        BASIC_BLOCK(4U, 6U, 7U)
+        {
+            INST(7U, Opcode::IfImm).SrcType(DataType::INT32).CC(CC_EQ).Imm(1U).Inputs(0U).Unlikely();
+        }
+        BASIC_BLOCK(6U, 8U)
+        {
+            INST(8U, Opcode::Sub).s32().Inputs(0U, 2U);
+        }
+        BASIC_BLOCK(7U, 8U)
+        {
+            INST(9U, Opcode::Add).s32().Inputs(0U, 2U);
+        }
+        BASIC_BLOCK(8U, -1L)
+        {
+            INST(10U, Opcode::Phi).s32().Inputs(8U, 9U);
+            INST(11U, Opcode::Return).s32().Inputs(10U);
+        }
+    }
+    const auto &blocks = graph->GetBlocksLinearOrder();
+    auto firstCold = std::find_if(blocks.begin(), blocks.end(), [](auto block) {
+        return block->GetId() == 3U || block->GetId() == 5U || block->GetId() == 6U;
+    });
+    ASSERT_EQ(std::distance(firstCold, blocks.end()), 3L);
+    ASSERT_EQ(&BB(6U), *firstCold);
+    ASSERT_EQ(&BB(3U), *std::next(firstCold));
+    ASSERT_EQ(&BB(5U), blocks.back());
+    // Hot path falls through to the likely successors
+    ASSERT_EQ(&BB(2U), blocks.at(1U));
+    ASSERT_EQ(&BB(4U), blocks.at(2U));
+    ASSERT_EQ(&BB(7U), blocks.at(3U));
+    ASSERT_EQ(&BB(8U), blocks.at(4U));
+}
+
 TEST_F(LinearOrderTest, ConditionChainHoisting)
 {
     auto source = R"(
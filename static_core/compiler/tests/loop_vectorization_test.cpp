@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unit_test.h"
+#include "optimizer/optimizations/loop_vectorization.h"
+#include "optimizer/optimizations/cleanup.h"
+
+namespace ark::compiler {
+class LoopVectorizationTest : public GraphTest {
+public:
+    LoopVectorizationTest() : isVectorizationEnabledDefault_(g_options.IsCompilerLoopVectorization())
+    {
+        g_options.SetCompilerLoopVectorization(true);
+    }
+
+    ~LoopVectorizationTest() override
+    {
+        g_options.SetCompilerLoopVectorization(isVectorizationEnabledDefault_);
+    }
+
+    NO_COPY_SEMANTIC(LoopVectorizationTest);
+    NO_MOVE_SEMANTIC(LoopVectorizationTest);
+
+protected:
+    enum class Operands { ARRAYS, SCALAR_RHS, SCALAR_LHS };
+
+    // for (i = 0; i < dst.length; i++) dst[i] = lhs op rhs
+    Graph *BuildElementWiseLoop(DataType::Type type, DataType::Type opType, Opcode opcode, Operands operands,
+                                bool offsetIndex = false)
+    {
+        auto graph = CreateEmptyGraph();
+        auto scalarType = DataType::IsFloatType(type) ? type : opType;
+        GRAPH(graph)
+        {
+            // NOLINTBEGIN(readability-magic-numbers)
+            PARAMETER(0U, 0U).ref();
+            PARAMETER(1U, 1U).ref();
+            if (operands == Operands::ARRAYS) {
+                PARAMETER(2U, 2U).ref();
+            } else {
+                PARAMETER(2U, 2U).type(scalarType);
+            }
+            CONSTANT(3U, 0U);
+            CONSTANT(4U, 1U);
+
+            BASIC_BLOCK(2U, 3U, 4U)
+            {
+                INST(5U, Opcode::SaveState).Inputs(0U, 1U, 2U).SrcVregs({0U, 1U, 2U});
+                INST(6U, Opcode::NullCheck).ref().Inputs(0U, 5U);
+                INST(7U, Opcode::LenArray).i32().Inputs(6U);
+                INST(8U, Opcode::Compare).b().Inputs(3U, 7U).CC(CC_LT).SrcType(DataType::INT32);
+                INST(9U, Opcode::IfImm).Inputs(8U).Imm(0U).CC(CC_EQ).SrcType(DataType::BOOL);
+            }
+
+            BASIC_BLOCK(3U, 4U, 3U)
+            {
+                INST(10U, Opcode::Phi).i32().Inputs(3U, 15U);
+                if (offsetIndex) {
+                    INST(19U, Opcode::Add).i32().Inputs(10U, 4U);
+                    INST(11U, Opcode::LoadArray).type(type).Inputs(1U, 19U);
+                } else {
+                    INST(11U, Opcode::LoadArray).type(type).Inputs(1U, 10U);
+                }
+                if (operands == Operands::ARRAYS) {
+                    INST(12U, Opcode::LoadArray).type(type).Inputs(2U, 10U);
+                    INST(13U, opcode).type(opType).Inputs(11U, 12U);
+                } else if (operands == Operands::SCALAR_RHS) {
+                    INST(13U, opcode).type(opType).Inputs(11U, 2U);
+                } else {
+                    INST(13U, opcode).type(opType).Inputs(2U, 11U);
+                }
+                INST(14U, Opcode::StoreArray).type(type).Inputs(6U, 10U, 13U);
+                INST(15U, Opcode::Add).i32().Inputs(10U, 4U);
+                INST(16U, Opcode::Compare).b().Inputs(7U, 15U).CC(CC_LE).SrcType(DataType::INT32);
+                INST(17U, Opcode::IfImm).Inputs(16U).Imm(0U).CC(CC_NE).SrcType(DataType::BOOL);
+            }
+
+            BASIC_BLOCK(4U, -1L)
+            {
+                INST(18U, Opcode::ReturnVoid).v0id();
+            }
+            // NOLINTEND(readability-magic-numbers)
+        }
+        return graph;
+    }
+
+    static IntrinsicInst *FindIntrinsic(Graph *graph)
+    {
+        for (auto block : graph->GetBlocksRPO()) {
+            for (auto inst : block->Insts()) {
+                if (inst->IsIntrinsic()) {
+                    return inst->CastToIntrinsic();
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void CheckVectorized(Graph *graph, RuntimeInterface::IntrinsicId expectedId, VectorOp expectedOp)
+    {
+        ASSERT_TRUE(graph->RunPass<LoopVectorization>());
+        graph->RunPass<Cleanup>();
+        auto intrinsic = FindIntrinsic(graph);
+        ASSERT_NE(intrinsic, nullptr);
+        ASSERT_EQ(intrinsic->GetIntrinsicId(), expectedId);
+        ASSERT_EQ(intrinsic->GetInputsCount(), 6U);
+        // dst, src, array or scalar operand, operation, begin, end
+        ASSERT_EQ(intrinsic->GetInput(0U).GetInst(), &INS(6U));
+        ASSERT_EQ(intrinsic->GetInput(1U).GetInst(), &INS(1U));
+        ASSERT_EQ(intrinsic->GetInput(2U).GetInst(), &INS(2U));
+        auto op = intrinsic->GetInput(3U).GetInst();
+        ASSERT_TRUE(op->IsConst());
+        ASSERT_EQ(op->CastToConstant()->GetIntValue(), static_cast<uint64_t>(expectedOp));
+        ASSERT_EQ(intrinsic->GetInput(4U).GetInst(), &INS(3U));
+        ASSERT_EQ(intrinsic->GetInput(5U).GetInst(), &INS(7U));
+        ASSERT_FALSE(intrinsic->CanThrow());
+        ASSERT_FALSE(intrinsic->RequireState());
+        // The scalar loop is kept for the short arrays
+        ASSERT_EQ(INS(14U).GetOpcode(), Opcode::StoreArray);
+        ASSERT_NE(INS(14U).GetBasicBlock(), nullptr);
+    }
+
+private:
+    bool isVectorizationEnabledDefault_;
+};
+
+TEST_F(LoopVectorizationTest, ArraysOperands)
+{
+    if (GetGraph()->GetArch() == Arch::AARCH32) {
+        GTEST_SKIP();
+    }
+    using IntrinsicId = RuntimeInterface::IntrinsicId;
+    CheckVectorized(BuildElementWiseLoop(DataType::FLOAT64, DataType::FLOAT64, Opcode::Add, Operands::ARRAYS),
+                    IntrinsicId::LIB_CALL_VECTOR_ARRAY_F64, VectorOp::ADD);
+    CheckVectorized(BuildElementWiseLoop(DataType::FLOAT32, DataType::FLOAT32, Opcode::Div, Operands::ARRAYS),
+                    IntrinsicId::LIB_CALL_VECTOR_ARRAY_F32, VectorOp::DIV);
+    CheckVectorized(BuildElementWiseLoop(DataType::INT32, DataType::INT32, Opcode::Sub, Operands::ARRAYS),
+                    IntrinsicId::LIB_CALL_VECTOR_ARRAY_32, VectorOp::SUB);
+    CheckVectorized(BuildElementWiseLoop(DataType::INT64, DataType::INT64, Opcode::Mul, Operands::ARRAYS),
+                    IntrinsicId::LIB_CALL_VECTOR_ARRAY_64, VectorOp::MUL);
+    // Byte elements are computed in int, only the low byte is stored
+    CheckVectorized(BuildElementWiseLoop(DataType::UINT8, DataType::INT32, Opcode::Xor, Operands::ARRAYS),
+                    IntrinsicId::LIB_CALL_VECTOR_ARRAY_8, VectorOp::XOR);
+    CheckVectorized(BuildElementWiseLoop(DataType::INT16, DataType::INT32, Opcode::Add, Operands::ARRAYS),
+                    IntrinsicId::LIB_CALL_VECTOR_ARRAY_16, VectorOp::ADD);
+}
+
+TEST_F(LoopVectorizationTest, ScalarOperand)
+{
+    if (GetGraph()->GetArch() == Arch::AARCH32) {
+        GTEST_SKIP();
+    }
+    using IntrinsicId = RuntimeInterface::IntrinsicId;
+    CheckVectorized(BuildElementWiseLoop(DataType::FLOAT64, DataType::FLOAT64, Opcode::Mul, Operands::SCALAR_RHS),
+                    IntrinsicId::LIB_CALL_VECTOR_SCALAR_F64, VectorOp::MUL);
+    CheckVectorized(BuildElementWiseLoop(DataType::FLOAT64, DataType::FLOAT64, Opcode::Div, Operands::SCALAR_LHS),
+                    IntrinsicId::LIB_CALL_VECTOR_SCALAR_F64, VectorOp::REVERSE_DIV);
+    CheckVectorized(BuildElementWiseLoop(DataType::INT32, DataType::INT32, Opcode::Sub, Operands::SCALAR_LHS),
+                    IntrinsicId::LIB_CALL_VECTOR_SCALAR_32, VectorOp::REVERSE_SUB);
+    CheckVectorized(BuildElementWiseLoop(DataType::UINT8, DataType::INT32, Opcode::And, Operands::SCALAR_RHS),
+                    IntrinsicId::LIB_CALL_VECTOR_SCALAR_8, VectorOp::AND);
+}
+
+TEST_F(LoopVectorizationTest, NotApplied)
+{
+    if (GetGraph()->GetArch() == Arch::AARCH32) {
+        GTEST_SKIP();
+    }
+    // Integer division requires the zero check
+    ASSERT_FALSE(BuildElementWiseLoop(DataType::INT32, DataType::INT32, Opcode::Div, Operands::ARRAYS)
+                     ->RunPass<LoopVectorization>());
+    // Bitwise operations are not defined for floating point values
+    ASSERT_FALSE(BuildElementWiseLoop(DataType::FLOAT64, DataType::FLOAT64, Opcode::Shl, Operands::ARRAYS)
+                     ->RunPass<LoopVectorization>());
+    // Element i + 1 is read after it is written on the previous iteration
+    ASSERT_FALSE(BuildElementWiseLoop(DataType::INT32, DataType::INT32, Opcode::Add, Operands::ARRAYS, true)
+                     ->RunPass<LoopVectorization>());
+}
+
+}  // namespace ark::compiler
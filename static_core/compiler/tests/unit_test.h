@@ -114,6 +114,24 @@ struct RuntimeInterfaceMock : public compiler::RuntimeInterface {
         return true;
     }
 
+    int64_t GetBranchTakenCounter([[maybe_unused]] MethodPtr method, uint32_t pc) const override
+    {
+        if (branchCounters_ == nullptr) {
+            return 0;
+        }
+        auto it = branchCounters_->find(pc);
+        return it == branchCounters_->end() ? 0 : it->second.first;
+    }
+
+    int64_t GetBranchNotTakenCounter([[maybe_unused]] MethodPtr method, uint32_t pc) const override
+    {
+        if (branchCounters_ == nullptr) {
+            return 0;
+        }
+        auto it = branchCounters_->find(pc);
+        return it == branchCounters_->end() ? 0 : it->second.second;
+    }
+
 private:
     static constexpr uintptr_t METHOD = 0xdead;
     static constexpr uintptr_t CALLEE = 0xdeadc;
@@ -126,6 +144,8 @@ private:
     ArenaUnorderedMap<PandaRuntimeInterface::FieldPtr, DataType::Type> *fieldTypes_ {nullptr};
     ArenaUnorderedMap<PandaRuntimeInterface::ClassPtr, DataType::Type> *arrayComponentTypes_ {nullptr};
     ArenaUnorderedMap<IdType, PandaRuntimeInterface::ClassPtr> *classes_ {nullptr};
+    // Taken and not taken counters of the branches by pc
+    ArenaUnorderedMap<uint32_t, std::pair<int64_t, int64_t>> *branchCounters_ {nullptr};
 
     friend class GraphTest;
     friend class GraphCreator;
@@ -288,6 +308,10 @@ public:
             graph_->GetAllocator()
                 ->New<ArenaUnorderedMap<PandaRuntimeInterface::IdType, PandaRuntimeInterface::ClassPtr>>(
                     graph_->GetAllocator()->Adapter());  // CC-OFF(G.FMT.06-CPP) project code style
+
+        runtime_.branchCounters_ =
+            graph_->GetAllocator()->New<ArenaUnorderedMap<uint32_t, std::pair<int64_t, int64_t>>>(
+                graph_->GetAllocator()->Adapter());
     }
     ~GraphTest() override = default;
 
@@ -338,6 +362,11 @@ public:
         (*runtime_.classes_)[id] = klass;
     }
 
+    void RegisterBranchCounters(uint32_t pc, int64_t taken, int64_t notTaken)
+    {
+        (*runtime_.branchCounters_)[pc] = {taken, notTaken};
+    }
+
 protected:
     RuntimeInterfaceMock runtime_;  // NOLINT(misc-non-private-member-variables-in-classes)
     Graph *graph_ {nullptr};        // NOLINT(misc-non-private-member-variables-in-classes)
@@ -148,6 +148,19 @@ inline size_t MmapPoolMap::GetAllSize() const
     return bytes;
 }
 
+inline size_t MmapPoolMap::GetUnreturnedFreePoolsSize() const
+{
+    size_t bytes = 0;
+    for (const auto &[size, pool] : freePools_) {
+        if (pool->IsReturnedToOS()) {
+            continue;
+        }
+        // The pool may be partially returned by the interrupted releasing
+        bytes += pool == unreturnedPool_.GetMmapPool() ? unreturnedPool_.GetUnreturnedSize() : size;
+    }
+    return bytes;
+}
+
 // CC-OFFNXT(G.FUD.06) solid logic, ODR
 inline bool MmapPoolMap::HaveEnoughFreePools(size_t poolsNum, size_t poolSize) const
 {
@@ -624,6 +637,14 @@ inline size_t MmapMemPool::GetObjectUsedBytes() const
     return commonSpace_.GetOccupiedMemorySize() - commonSpacePools_.GetAllSize();
 }
 
+inline size_t MmapMemPool::GetObjectCommittedBytes() const
+{
+    os::memory::LockHolder lk(lock_);
+    ASSERT(commonSpace_.GetOccupiedMemorySize() >= commonSpacePools_.GetAllSize());
+    size_t usedBytes = commonSpace_.GetOccupiedMemorySize() - commonSpacePools_.GetAllSize();
+    return usedBytes + commonSpacePools_.GetUnreturnedFreePoolsSize() + commonSpace_.GetUnreturnedToOsSize();
+}
+
 inline void MmapMemPool::ReleaseFreePagesToOS()
 {
     os::memory::LockHolder lk(lock_);
@@ -179,6 +179,9 @@ public:
     // Get the sum of all free pools size.
     size_t GetAllSize() const;
 
+    // Get the size of free pools memory, which is not returned to OS yet.
+    size_t GetUnreturnedFreePoolsSize() const;
+
     /**
      * Iterate over all free pools
      * @param visitor function for pool visit
@@ -266,6 +269,9 @@ public:
     /// @return used bytes count in object space (so exclude bytes in free pools)
     size_t GetObjectUsedBytes() const;
 
+    /// @return bytes count in object space backed by memory of the process (used bytes and not returned free pools)
+    size_t GetObjectCommittedBytes() const;
+
     size_t GetCompilerSpaceCurrentSize() const
     {
         return nonObjectSpacesCurrentSize_[SpaceTypeToIndex(SpaceType::SPACE_TYPE_COMPILER)];
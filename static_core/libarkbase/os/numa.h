@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_LIBPANDABASE_OS_NUMA_H
+#define PANDA_LIBPANDABASE_OS_NUMA_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "libarkbase/macros.h"
+
+namespace ark::os::numa {
+
+/// Node ids of the system are less than this value
+// CC-OFFNXT(G.NAM.03-CPP) project code style
+static constexpr uint32_t MAX_NODES_COUNT = 64U;
+
+/// @return id of the NUMA node of the CPU, 0 if it can't be determined
+PANDA_PUBLIC_API uint32_t GetNodeOfCpu(int cpu);
+
+/// @return CPU the current thread is running on, 0 if it can't be determined
+PANDA_PUBLIC_API int GetCurrentCpu();
+
+/**
+ * Allow the current thread to run only on the CPUs of the NUMA node
+ * @return true if the affinity was set, false - otherwise
+ */
+PANDA_PUBLIC_API bool BindCurrentThreadToNode(uint32_t node);
+
+/**
+ * Prefer the NUMA node for the pages of the memory range, which are not faulted in yet
+ * @param mem page aligned start of the range
+ * @return true if the memory policy was set, false - otherwise
+ */
+PANDA_PUBLIC_API bool SetPreferredNode(void *mem, size_t size, uint32_t node);
+
+}  // namespace ark::os::numa
+
+#endif  // PANDA_LIBPANDABASE_OS_NUMA_H
@@ -434,6 +434,59 @@ TEST(Utf, CompareUtf8ToUtf8_4b)
     }
 }
 
+// The ASCII runs are longer than the vector kernels process at once, non-ASCII characters break them at any offset
+TEST(Utf, LongAsciiRuns)
+{
+    static constexpr size_t RUN_LENGTH = 37U;
+    std::vector<uint8_t> mutf8;
+    std::vector<uint16_t> utf16;
+    auto appendAscii = [&mutf8, &utf16](size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            auto ch = static_cast<uint8_t>('a' + i % ('z' - 'a'));
+            mutf8.push_back(ch);
+            utf16.push_back(ch);
+        }
+    };
+    appendAscii(RUN_LENGTH);
+    mutf8.push_back(0x00U);
+    EXPECT_TRUE(IsMUtf8OnlySingleBytes(mutf8.data()));
+    mutf8.pop_back();
+
+    // U+00E9 and U+4E2D
+    mutf8.insert(mutf8.end(), {0xc3U, 0xa9U});
+    utf16.push_back(0xe9U);
+    appendAscii(RUN_LENGTH + 1U);
+    mutf8.insert(mutf8.end(), {0xe4U, 0xb8U, 0xadU});
+    utf16.push_back(0x4e2dU);
+    appendAscii(RUN_LENGTH + 2U);
+    mutf8.push_back(0x00U);
+
+    EXPECT_FALSE(IsMUtf8OnlySingleBytes(mutf8.data()));
+    EXPECT_TRUE(IsValidModifiedUTF8(mutf8.data()));
+    EXPECT_EQ(MUtf8ToUtf16Size(mutf8.data()), utf16.size());
+    size_t mutf8Len = Mutf8Size(mutf8.data());
+    EXPECT_EQ(MUtf8ToUtf16Size(mutf8.data(), mutf8Len), utf16.size());
+
+    std::vector<uint16_t> out(utf16.size());
+    ConvertMUtf8ToUtf16(mutf8.data(), mutf8Len, out.data());
+    EXPECT_EQ(out, utf16);
+
+    // Start inside the first run and stop inside the second one
+    std::vector<uint16_t> region(RUN_LENGTH);
+    EXPECT_EQ(ConvertRegionMUtf8ToUtf16(mutf8.data(), region.data(), mutf8Len, region.size(), 3U), region.size());
+    EXPECT_EQ(region, std::vector<uint16_t>(utf16.begin() + 3U, utf16.begin() + 3U + RUN_LENGTH));
+
+    EXPECT_EQ(Utf16ToMUtf8Size(utf16.data(), utf16.size()), mutf8.size());
+    std::vector<uint8_t> back(mutf8Len);
+    EXPECT_EQ(ConvertRegionUtf16ToMUtf8(utf16.data(), back.data(), utf16.size(), back.size(), 0), mutf8Len);
+    EXPECT_EQ(back, std::vector<uint8_t>(mutf8.begin(), mutf8.end() - 1U));
+
+    // Continuation byte after a long run
+    mutf8.back() = 0x80U;
+    mutf8.push_back(0x00U);
+    EXPECT_FALSE(IsValidModifiedUTF8(mutf8.data()));
+}
+
 TEST(Utf, IsValidUTF8)
 {
     // test one byte
@@ -18,11 +18,14 @@
 #include <cstddef>
 #include <cstring>
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <tuple>
 #include <utility>
 
 #include "securec.h"
+#include "libarkbase/utils/vector_helpers.h"
 
 // NOLINTNEXTLINE(hicpp-signed-bitwise)
 static constexpr uint32_t U16_SURROGATE_OFFSET = (0xd800 << 10UL) + 0xdc00 - 0x10000;
@@ -100,6 +103,101 @@ static constexpr uint32_t CombineTwoU16(uint16_t d0, uint16_t d1)
     return codePoint;
 }
 
+// Kernels for the runs of ASCII characters, which are the most frequent ones in the program strings.
+// The rest of the string is processed by the scalar code.
+using helpers::vector::AnyLane;
+using helpers::vector::VECTOR_BYTES;
+using VectorU8 = helpers::vector::VectorType<uint8_t>;
+using VectorU16 = helpers::vector::VectorType<uint16_t>;
+using HalfVectorU8 = helpers::vector::Vector<uint16_t>::HalfType;
+static constexpr size_t WIDEN_LANES = helpers::vector::Vector<uint16_t>::LANES;
+static constexpr uint64_t ASCII_HIGH_BITS = 0x8080808080808080ULL;
+
+/// @return the number of leading bytes in [0, 0x7f]
+static size_t AsciiPrefixLength(const uint8_t *data, size_t length)
+{
+    size_t i = 0;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; i + 2U * VECTOR_BYTES <= length; i += 2U * VECTOR_BYTES) {
+        VectorU8 lo;
+        VectorU8 hi;
+        memcpy(&lo, data + i, VECTOR_BYTES);
+        memcpy(&hi, data + i + VECTOR_BYTES, VECTOR_BYTES);
+        VectorU8 high = (lo | hi) & static_cast<uint8_t>(MASK1);
+        if (AnyLane(high)) {
+            break;
+        }
+    }
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(uint64_t));
+        if ((word & ASCII_HIGH_BITS) != 0) {
+            break;
+        }
+    }
+    while (i < length && data[i] < MASK1) {
+        ++i;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return i;
+}
+
+/// @return the number of leading utf16 codes in [1, 0x7f], which are encoded as one byte in both utf8 and mutf8
+static size_t Utf16AsciiPrefixLength(const uint16_t *data, size_t length)
+{
+    constexpr size_t LANES = VECTOR_BYTES / sizeof(uint16_t);
+    size_t i = 0;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; i + LANES <= length; i += LANES) {
+        VectorU16 codes;
+        memcpy(&codes, data + i, VECTOR_BYTES);
+        // zero wraps around to 0xffff
+        auto notAscii = (codes - static_cast<uint16_t>(1U)) >= static_cast<uint16_t>(UTF8_1B_MAX);
+        if (AnyLane(notAscii)) {
+            break;
+        }
+    }
+    while (i < length && data[i] != 0 && data[i] <= UTF8_1B_MAX) {
+        ++i;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return i;
+}
+
+/// Zero extends @param length ASCII bytes to utf16 codes
+static void WidenAscii(const uint8_t *in, uint16_t *out, size_t length)
+{
+    size_t i = 0;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; i + WIDEN_LANES <= length; i += WIDEN_LANES) {
+        HalfVectorU8 bytes;
+        memcpy(&bytes, in + i, WIDEN_LANES);
+        auto codes = __builtin_convertvector(bytes, VectorU16);
+        memcpy(out + i, &codes, VECTOR_BYTES);
+    }
+    for (; i < length; ++i) {
+        out[i] = in[i];
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/// Truncates @param length utf16 codes in [1, 0x7f] to bytes
+static void NarrowAscii(const uint16_t *in, uint8_t *out, size_t length)
+{
+    size_t i = 0;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; i + WIDEN_LANES <= length; i += WIDEN_LANES) {
+        VectorU16 codes;
+        memcpy(&codes, in + i, VECTOR_BYTES);
+        auto bytes = __builtin_convertvector(codes, HalfVectorU8);
+        memcpy(out + i, &bytes, WIDEN_LANES);
+    }
+    for (; i < length; ++i) {
+        out[i] = static_cast<uint8_t>(in[i]);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
 bool IsMUtf8OnlySingleBytes(const uint8_t *mutf8In)
 {
     while (*mutf8In != '\0') {    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -121,6 +219,14 @@ void ConvertMUtf8ToUtf16(const uint8_t *mutf8In, size_t mutf8Len, uint16_t *utf1
 {
     size_t inPos = 0;
     while (inPos < mutf8Len) {
+        if (*mutf8In < MASK1) {
+            size_t ascii = AsciiPrefixLength(mutf8In, mutf8Len - inPos);
+            WidenAscii(mutf8In, utf16Out, ascii);
+            mutf8In += ascii;   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            utf16Out += ascii;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            inPos += ascii;
+            continue;
+        }
         auto [pair, nbytes] = ConvertMUtf8ToUtf16Pair(mutf8In, mutf8Len - inPos);
         auto [p_hi, p_lo] = SplitUtf16Pair(pair);
 
@@ -140,6 +246,23 @@ size_t ConvertRegionMUtf8ToUtf16(const uint8_t *mutf8In, uint16_t *utf16Out, siz
     size_t inPos = 0;
     size_t outPos = 0;
     while (inPos < mutf8Len) {
+        if (*mutf8In < MASK1) {
+            size_t ascii = AsciiPrefixLength(mutf8In, mutf8Len - inPos);
+            size_t skip = std::min(ascii, start);
+            start -= skip;
+            size_t count = std::min(ascii - skip, utf16Len - outPos);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            WidenAscii(mutf8In + skip, utf16Out, count);
+            utf16Out += count;         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            mutf8In += skip + count;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            inPos += skip + count;
+            outPos += count;
+            if (skip + count < ascii) {
+                // no place for the rest of the codes
+                break;
+            }
+            continue;
+        }
         auto [pair, nbytes] = ConvertMUtf8ToUtf16Pair(mutf8In, mutf8Len - inPos);
         auto [p_hi, p_lo] = SplitUtf16Pair(pair);
 
@@ -261,14 +384,8 @@ size_t Mutf8Size(const uint8_t *mutf8)
 
 size_t MUtf8ToUtf16Size(const uint8_t *mutf8)
 {
-    // NOTE(d.kovalenko): make it faster
-    size_t res = 0;
-    while (*mutf8 != '\0') {  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        auto [pair, nbytes] = ConvertMUtf8ToUtf16Pair(mutf8);
-        res += pair > MAX_U16 ? CONST_2 : 1;
-        mutf8 += nbytes;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    }
-    return res;
+    // A sequence truncated by the terminating zero is handled as one truncated by the length
+    return MUtf8ToUtf16Size(mutf8, Mutf8Size(mutf8));
 }
 
 size_t MUtf8ToUtf16Size(const uint8_t *mutf8, size_t mutf8Len)
@@ -276,6 +393,13 @@ size_t MUtf8ToUtf16Size(const uint8_t *mutf8, size_t mutf8Len)
     size_t pos = 0;
     size_t res = 0;
     while (pos != mutf8Len) {
+        if (*mutf8 < MASK1) {
+            size_t ascii = AsciiPrefixLength(mutf8, mutf8Len - pos);
+            res += ascii;
+            mutf8 += ascii;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            pos += ascii;
+            continue;
+        }
         auto [pair, nbytes] = ConvertMUtf8ToUtf16Pair(mutf8, mutf8Len - pos);
         if (nbytes == 0) {
             nbytes = 1;
@@ -305,7 +429,13 @@ bool IsValidModifiedUTF8(const uint8_t *elems)
 {
     ASSERT(elems);
 
+    const uint8_t *end = elems + Mutf8Size(elems);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     while (*elems != '\0') {
+        if (*elems < MASK1) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            elems += AsciiPrefixLength(elems, end - elems);
+            continue;
+        }
         // NOLINTNEXTLINE(hicpp-signed-bitwise, readability-magic-numbers)
         switch (*elems & 0xf0) {
             case 0x00:
@@ -473,6 +603,14 @@ size_t Utf16ToUtf8Size(const uint16_t *utf16, uint32_t length, bool modify)
     }
 
     for (uint32_t i = 0; i < length; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (utf16[i] != 0 && utf16[i] <= UTF8_1B_MAX) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            size_t ascii = Utf16AsciiPrefixLength(utf16 + i, length - i);
+            res += ascii;
+            i += ascii - 1;
+            continue;
+        }
         if (utf16[i] == 0) {  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             if (modify) {
                 res += UtfLength::TWO;  // special case for U+0000 => C0 80
@@ -515,6 +653,19 @@ size_t ConvertRegionUtf16ToUtf8(const uint16_t *utf16In, uint8_t *utf8Out, size_
     }
     size_t end = start + utf16Len;
     for (size_t i = start; i < end; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (utf16In[i] != 0 && utf16In[i] <= UTF8_1B_MAX) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            size_t count = std::min(Utf16AsciiPrefixLength(utf16In + i, end - i), utf8Len - utf8Pos);
+            if (count == 0) {
+                break;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            NarrowAscii(utf16In + i, utf8Out + utf8Pos, count);
+            utf8Pos += count;
+            i += count - 1;
+            continue;
+        }
         uint16_t next16Code = 0;
         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
         if ((i + 1) != end && IsAvailableNextUtf16Code(utf16In[i + 1])) {
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_LIBPANDABASE_UTILS_VECTOR_HELPERS_H_
+#define PANDA_LIBPANDABASE_UTILS_VECTOR_HELPERS_H_
+
+#include "libarkbase/macros.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+
+/**
+ * Types for the kernels written with the compiler vector extensions. The extensions are lowered to NEON on arm64
+ * and to SSE2 on amd64, so the kernels need neither intrinsics nor runtime dispatch, and the other targets get
+ * the scalar code generated by the compiler.
+ */
+namespace ark::helpers::vector {
+
+// CC-OFFNXT(G.NAM.03-CPP) project code style
+static constexpr size_t VECTOR_BYTES = 16;
+
+template <typename T>
+struct Vector {
+    // NOLINTNEXTLINE(modernize-use-using)
+    typedef T Type __attribute__((vector_size(VECTOR_BYTES)));
+    // The same number of bytes, used to widen them to T
+    // NOLINTNEXTLINE(modernize-use-using)
+    typedef uint8_t HalfType __attribute__((vector_size(VECTOR_BYTES / sizeof(T))));
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr size_t LANES = VECTOR_BYTES / sizeof(T);
+};
+
+template <typename T>
+using VectorType = typename Vector<T>::Type;
+
+/// @return true if any lane of the comparison result @param mask is set
+template <typename Mask>
+ALWAYS_INLINE inline bool AnyLane(const Mask &mask)
+{
+    static_assert(sizeof(Mask) == VECTOR_BYTES);
+    // Vector extensions have no horizontal reduction, so the lanes are tested as two 64-bit words
+    std::array<uint64_t, VECTOR_BYTES / sizeof(uint64_t)> words {};
+    memcpy(words.data(), &mask, VECTOR_BYTES);
+    return (words[0] | words[1]) != 0;
+}
+
+}  // namespace ark::helpers::vector
+
+#endif  // PANDA_LIBPANDABASE_UTILS_VECTOR_HELPERS_H_
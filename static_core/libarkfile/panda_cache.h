@@ -248,7 +248,49 @@ public:
         return true;
     }
 
+    /// Calls @param cb(id, method) for every occupied slot of the method cache
+    template <class Callback>
+    void EnumerateMethodCache(const Callback &cb)
+    {
+        EnumerateCache(methodCache_, methodCacheReady_, cb);
+    }
+
+    /// Calls @param cb(id, field) for every occupied slot of the field cache
+    template <class Callback>
+    void EnumerateFieldCache(const Callback &cb)
+    {
+        EnumerateCache(fieldCache_, fieldCacheReady_, cb);
+    }
+
+    /// Calls @param cb(id, class) for every occupied slot of the class cache
+    template <class Callback>
+    void EnumerateClassCache(const Callback &cb)
+    {
+        EnumerateCache(classCache_, classCacheReady_, cb);
+    }
+
 private:
+    template <class Pair, class Callback>
+    static void EnumerateCache(std::vector<Pair> &cache, const std::atomic<bool> &ready, const Callback &cb)
+    {
+        // Emulator target doesn't support atomic operations with 128bit structures like MethodCachePair.
+#ifndef PANDA_TARGET_EMULATOR
+        // Atomic with acquire order reason: pairs with ready_ store(release) to observe init
+        if (!ready.load(std::memory_order_acquire)) {
+            return;
+        }
+        for (auto &slot : cache) {
+            auto *pairPtr = reinterpret_cast<std::atomic<Pair> *>(reinterpret_cast<uintptr_t>(&slot));
+            // Atomic with acquire order reason: fixes a data race with the cache update
+            auto pair = pairPtr->load(std::memory_order_acquire);
+            TSAN_ANNOTATE_HAPPENS_AFTER(pairPtr);
+            if (pair.ptr != nullptr) {
+                cb(pair.id, pair.ptr);
+            }
+        }
+#endif
+    }
+
     void InitializeMethodCacheIfNeeded()
     {
         // Atomic with acquire order reason: pairs with ready_ store(release); early out if already inited
@@ -161,6 +161,9 @@ static void PrintStatistics(RuntimeOptions &runtimeOptions, Runtime &runtime)
     if (runtimeOptions.IsPrintMemoryStatistics()) {
         std::cout << runtime.GetMemoryStatistics();
     }
+    if (runtimeOptions.IsPrintInterpreterCacheStatistics()) {
+        std::cout << runtime.GetInterpreterCacheStatistics();
+    }
 }
 
 // CC-OFFNXT(huge_method[C++], G.FUN.01-CPP) solid logic
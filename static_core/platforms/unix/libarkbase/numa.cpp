@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libarkbase/os/numa.h"
+
+#include <string>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <cctype>
+#include <cstdlib>
+#include <dirent.h>
+#include <fstream>
+#include <string_view>
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
+
+namespace ark::os::numa {
+
+#ifdef __linux__
+// CC-OFFNXT(G.NAM.03-CPP) project code style
+static constexpr int DECIMAL_BASE = 10;
+
+uint32_t GetNodeOfCpu(int cpu)
+{
+    // The CPU directory contains a link to its node directory, so a single directory is read per CPU
+    auto cpuPath = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+    DIR *dir = opendir(cpuPath.c_str());
+    if (dir == nullptr) {
+        return 0;
+    }
+    static constexpr std::string_view NODE_PREFIX = "node";
+    uint32_t node = 0;
+    while (auto *entry = readdir(dir)) {
+        std::string_view name(entry->d_name);
+        if (name.size() > NODE_PREFIX.size() && name.substr(0, NODE_PREFIX.size()) == NODE_PREFIX &&
+            std::isdigit(static_cast<unsigned char>(name[NODE_PREFIX.size()])) != 0) {
+            node = static_cast<uint32_t>(std::strtoul(entry->d_name + NODE_PREFIX.size(), nullptr, DECIMAL_BASE));
+            break;
+        }
+    }
+    closedir(dir);
+    return node;
+}
+
+int GetCurrentCpu()
+{
+    auto cpu = sched_getcpu();
+    return cpu < 0 ? 0 : cpu;
+}
+
+bool BindCurrentThreadToNode(uint32_t node)
+{
+    // The list of the node CPUs looks like "0-3,8-11"
+    std::ifstream cpuList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    bool hasCpus = false;
+    std::string range;
+    while (std::getline(cpuList, range, ',')) {
+        char *end = nullptr;
+        auto first = std::strtol(range.c_str(), &end, DECIMAL_BASE);
+        if (end == range.c_str()) {
+            continue;
+        }
+        auto last = *end == '-' ? std::strtol(end + 1, nullptr, DECIMAL_BASE) : first;
+        for (auto cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+            CPU_SET(cpu, &cpuset);
+            hasCpus = true;
+        }
+    }
+    return hasCpus && sched_setaffinity(0, sizeof(cpuset), &cpuset) == 0;
+}
+
+bool SetPreferredNode(void *mem, size_t size, uint32_t node)
+{
+    if (node >= MAX_NODES_COUNT) {
+        return false;
+    }
+    unsigned long nodeMask = 1UL << node;  // NOLINT(google-runtime-int)
+    // The kernel reads maxnode - 1 bits of the mask
+    return syscall(SYS_mbind, mem, size, MPOL_PREFERRED, &nodeMask, MAX_NODES_COUNT + 1U, 0) == 0;
+}
+#else
+uint32_t GetNodeOfCpu([[maybe_unused]] int cpu)
+{
+    return 0;
+}
+
+int GetCurrentCpu()
+{
+    return 0;
+}
+
+bool BindCurrentThreadToNode([[maybe_unused]] uint32_t node)
+{
+    return false;
+}
+
+bool SetPreferredNode([[maybe_unused]] void *mem, [[maybe_unused]] size_t size, [[maybe_unused]] uint32_t node)
+{
+    return false;
+}
+#endif
+
+}  // namespace ark::os::numa
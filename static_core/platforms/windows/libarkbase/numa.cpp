@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libarkbase/os/numa.h"
+
+namespace ark::os::numa {
+
+uint32_t GetNodeOfCpu([[maybe_unused]] int cpu)
+{
+    return 0;
+}
+
+int GetCurrentCpu()
+{
+    return 0;
+}
+
+bool BindCurrentThreadToNode([[maybe_unused]] uint32_t node)
+{
+    return false;
+}
+
+bool SetPreferredNode([[maybe_unused]] void *mem, [[maybe_unused]] size_t size, [[maybe_unused]] uint32_t node)
+{
+    return false;
+}
+
+}  // namespace ark::os::numa
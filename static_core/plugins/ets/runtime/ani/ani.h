@@ -6244,6 +6244,64 @@ struct __ani_interaction_api {
      * @since 26.1.0
      */
     ani_status (*ValueArray_GetLength)(ani_env *env, ani_valuearray array, ani_size *result);
+
+    /**
+     * @brief Provides direct access to the elements of a ValueArray.
+     *
+     * This function pins the array in place, so the native code may read and write its elements without copying
+     * them until `ValueArray_Unpin` is called. If the garbage collector cannot pin objects, the elements are
+     * copied to a native buffer, which is written back to the array by `ValueArray_Unpin`.
+     * The native code should not call managed code or block while the array is pinned.
+     *
+     * @param[in] env A pointer to the environment structure.
+     * @param[in] array The ValueArray to pin.
+     * @param[out] data_result A pointer to store the pointer to the elements of the array.
+     * @param[out] length_result A pointer to store the number of the elements.
+     * @return Returns a status code of type `ani_status` indicating success or failure.
+     * @since 26.1.0
+     */
+    ani_status (*ValueArray_Pin)(ani_env *env, ani_valuearray array, void **data_result, ani_size *length_result);
+
+    /**
+     * @brief Releases the elements of a ValueArray provided by `ValueArray_Pin`.
+     *
+     * @param[in] env A pointer to the environment structure.
+     * @param[in] array The ValueArray passed to `ValueArray_Pin`.
+     * @param[in] data The pointer returned by `ValueArray_Pin`, it must not be used after the call.
+     * @return Returns a status code of type `ani_status` indicating success or failure.
+     * @since 26.1.0
+     */
+    ani_status (*ValueArray_Unpin)(ani_env *env, ani_valuearray array, void *data);
+
+    /**
+     * @brief Provides direct read-only access to the characters of a string.
+     *
+     * This function flattens the string and pins it in place until `String_Unpin` is called. The characters
+     * are either UTF-16 code units or, for compressed strings, ASCII characters of one byte each. They are not
+     * null-terminated. If the garbage collector cannot pin objects, the characters are copied to a native buffer.
+     * The native code should not call managed code or block while the string is pinned.
+     *
+     * @param[in] env A pointer to the environment structure.
+     * @param[in] string The string to pin.
+     * @param[out] data_result A pointer to store the pointer to the characters of the string.
+     * @param[out] length_result A pointer to store the number of the characters.
+     * @param[out] is_utf16_result A pointer to store whether the characters are UTF-16 code units.
+     * @return Returns a status code of type `ani_status` indicating success or failure.
+     * @since 26.1.0
+     */
+    ani_status (*String_Pin)(ani_env *env, ani_string string, const void **data_result, ani_size *length_result,
+                             ani_boolean *is_utf16_result);
+
+    /**
+     * @brief Releases the characters of a string provided by `String_Pin`.
+     *
+     * @param[in] env A pointer to the environment structure.
+     * @param[in] string The string passed to `String_Pin`.
+     * @param[in] data The pointer returned by `String_Pin`, it must not be used after the call.
+     * @return Returns a status code of type `ani_status` indicating success or failure.
+     * @since 26.1.0
+     */
+    ani_status (*String_Unpin)(ani_env *env, ani_string string, const void *data);
 };
 
 // C++ API
@@ -8181,6 +8239,23 @@ struct __ani_env {
     {
         return c_api->ValueArray_GetLength(this, array, result);
     }
+    ani_status ValueArray_Pin(ani_valuearray array, void **data_result, ani_size *length_result)
+    {
+        return c_api->ValueArray_Pin(this, array, data_result, length_result);
+    }
+    ani_status ValueArray_Unpin(ani_valuearray array, void *data)
+    {
+        return c_api->ValueArray_Unpin(this, array, data);
+    }
+    ani_status String_Pin(ani_string string, const void **data_result, ani_size *length_result,
+                          ani_boolean *is_utf16_result)
+    {
+        return c_api->String_Pin(this, string, data_result, length_result, is_utf16_result);
+    }
+    ani_status String_Unpin(ani_string string, const void *data)
+    {
+        return c_api->String_Unpin(this, string, data);
+    }
 #endif  // __cplusplus
 };
 
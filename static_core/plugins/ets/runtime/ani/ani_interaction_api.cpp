@@ -44,6 +44,7 @@
 #include "plugins/ets/runtime/types/ets_std_core_array.h"
 #include "plugins/ets/runtime/types/ets_object.h"
 #include "runtime/execution/job_execution_context_scopes.h"
+#include "runtime/include/coretypes/string_flatten.h"
 
 // NOLINTBEGIN(cppcoreguidelines-macro-usage)
 
@@ -1043,6 +1044,47 @@ NO_UB_SANITIZE static ani_status ValueArray_GetLength(ani_env *env, ani_valuearr
     return ANI_OK;
 }
 
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status ValueArray_Pin(ani_env *env, ani_valuearray array, void **dataResult,
+                                                ani_size *lengthResult)
+{
+    ANI_DEBUG_TRACE(env);
+    CHECK_ENV(env);
+    CHECK_PTR_ARG(array);
+    CHECK_PTR_ARG(dataResult);
+    CHECK_PTR_ARG(lengthResult);
+
+    ScopedManagedCodeFix s(env);
+    EtsArray *internalArray = s.ToInternalType(array);
+    ANI_CHECK_RETURN_IF_EQ(internalArray->AsObject()->IsArrayClass(), false, ANI_INVALID_TYPE);
+    ANI_CHECK_RETURN_IF_EQ(internalArray->IsPrimitive(), false, ANI_INVALID_TYPE);
+
+    auto length = internalArray->GetLength();
+    EtsObject *object = internalArray->AsObject();
+    void *data = s.GetPandaEnv()->PinData(object, object, internalArray->GetData<uint8_t>(),
+                                          length * internalArray->GetElementSize());
+    ANI_CHECK_RETURN_IF_EQ(data, nullptr, ANI_OUT_OF_MEMORY);
+    *dataResult = data;
+    *lengthResult = length;
+    return ANI_OK;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status ValueArray_Unpin(ani_env *env, ani_valuearray array, void *data)
+{
+    ANI_DEBUG_TRACE(env);
+    CHECK_ENV(env);
+    CHECK_PTR_ARG(array);
+    CHECK_PTR_ARG(data);
+
+    ScopedManagedCodeFix s(env);
+    EtsArray *internalArray = s.ToInternalType(array);
+    static constexpr bool WRITE_BACK = true;
+    ANI_CHECK_RETURN_IF_EQ(s.GetPandaEnv()->UnpinData(internalArray->AsObject(), data, WRITE_BACK), false,
+                           ANI_INVALID_ARGS);
+    return ANI_OK;
+}
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 NO_UB_SANITIZE static ani_status ValueArray_New_Boolean(ani_env *env, ani_size length, ani_valuearray_boolean *result)
 {
@@ -4105,6 +4147,56 @@ NO_UB_SANITIZE static ani_status String_GetUTF16SubString(ani_env *env, ani_stri
     return ANI_OK;
 }
 
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status String_Pin(ani_env *env, ani_string string, const void **dataResult,
+                                            ani_size *lengthResult, ani_boolean *isUtf16Result)
+{
+    ANI_DEBUG_TRACE(env);
+    CHECK_ENV(env);
+    CHECK_PTR_ARG(string);
+    CHECK_PTR_ARG(dataResult);
+    CHECK_PTR_ARG(lengthResult);
+    CHECK_PTR_ARG(isUtf16Result);
+
+    ScopedManagedCodeFix s(env);
+    auto *thread = s.GetExecutionContext()->GetMT();
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+    VMHandle<coretypes::String> str(thread, s.ToInternalType(string)->GetCoreType());
+    LanguageContext ctx = Runtime::GetCurrent()->GetLanguageContext(panda_file::SourceLang::ETS);
+    // Tree strings are flattened to a new line string, which is kept alive by the pinned data
+    auto flat = coretypes::FlatStringInfo::FlattenAllString(str, ctx);
+    ANI_CHECK_RETURN_IF_EQ(flat.GetString(), nullptr, ANI_OUT_OF_MEMORY);
+
+    bool isUtf16 = flat.IsUtf16();
+    auto *chars = isUtf16 ? static_cast<const void *>(flat.GetDataUtf16()) : flat.GetDataUtf8();
+    size_t size = flat.GetLength() * (isUtf16 ? sizeof(uint16_t) : sizeof(uint8_t));
+    auto *source = EtsObject::FromCoreType(str.GetPtr());
+    auto *object = EtsObject::FromCoreType(flat.GetString());
+    void *data = s.GetPandaEnv()->PinData(source, object, const_cast<void *>(chars), size);
+    ANI_CHECK_RETURN_IF_EQ(data, nullptr, ANI_OUT_OF_MEMORY);
+    *dataResult = data;
+    *lengthResult = flat.GetLength();
+    *isUtf16Result = isUtf16 ? ANI_TRUE : ANI_FALSE;
+    return ANI_OK;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status String_Unpin(ani_env *env, ani_string string, const void *data)
+{
+    ANI_DEBUG_TRACE(env);
+    CHECK_ENV(env);
+    CHECK_PTR_ARG(string);
+    CHECK_PTR_ARG(data);
+
+    ScopedManagedCodeFix s(env);
+    EtsString *internalString = s.ToInternalType(string);
+    // Strings are immutable, so the copy is never written back
+    static constexpr bool WRITE_BACK = false;
+    ANI_CHECK_RETURN_IF_EQ(s.GetPandaEnv()->UnpinData(internalString->AsObject(), data, WRITE_BACK), false,
+                           ANI_INVALID_ARGS);
+    return ANI_OK;
+}
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 NO_UB_SANITIZE static ani_status Object_CallMethod_Boolean_V(ani_env *env, ani_object object, ani_method method,
                                                              ani_boolean *result, va_list args)
@@ -6643,6 +6735,10 @@ const __ani_interaction_api INTERACTION_API = {
     Primitive_Box_Double,
     Primitive_Unbox_Double,
     ValueArray_GetLength,
+    ValueArray_Pin,
+    ValueArray_Unpin,
+    String_Pin,
+    String_Unpin,
 };
 // clang-format on
 
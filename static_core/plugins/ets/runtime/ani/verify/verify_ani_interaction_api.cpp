@@ -1079,6 +1079,42 @@ NO_UB_SANITIZE static ani_status String_GetUTF16SubString(VEnv *venv, VString *v
                                                              utf16Buffer, utf16BufferSize, result);
 }
 
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status String_Pin(VEnv *venv, VString *vstring, const void **dataResult,
+                                            ani_size *lengthResult, ani_boolean *isUtf16Result)
+{
+    // clang-format off
+    VERIFY_ANI_ARGS(
+        ANIArg::MakeForEnv(venv, "env"),
+        ANIArg::MakeForString(vstring, "string"),
+        ANIArg::MakeForVoidPtrStorage(const_cast<void **>(dataResult), "data_result"),
+        ANIArg::MakeForSizeStorage(lengthResult, "length_result"),
+        ANIArg::MakeForBooleanStorage(isUtf16Result, "is_utf16_result")
+    );
+    // clang-format on
+    CHECK_PTR_ARG(venv);
+    CHECK_PTR_ARG(vstring);
+
+    auto stringRef = ResolveToAniRef(vstring);
+    return GetInteractionAPI(venv)->String_Pin(venv->GetEnv(), stringRef, dataResult, lengthResult, isUtf16Result);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status String_Unpin(VEnv *venv, VString *vstring, const void *data)
+{
+    // clang-format off
+    VERIFY_ANI_ARGS(
+        ANIArg::MakeForEnv(venv, "env"),
+        ANIArg::MakeForString(vstring, "string")
+    );
+    // clang-format on
+    CHECK_PTR_ARG(venv);
+    CHECK_PTR_ARG(vstring);
+
+    auto stringRef = ResolveToAniRef(vstring);
+    return GetInteractionAPI(venv)->String_Unpin(venv->GetEnv(), stringRef, data);
+}
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 NO_UB_SANITIZE static ani_status String_NewUTF8(VEnv *venv, const char *utf8String, ani_size utf8Size,
                                                 VString **vresult)
@@ -1322,6 +1358,41 @@ NO_UB_SANITIZE static ani_status ValueArray_GetLength(VEnv *venv, VValueArray *v
     return GetInteractionAPI(venv)->ValueArray_GetLength(venv->GetEnv(), arrayRef, result);
 }
 
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status ValueArray_Pin(VEnv *venv, VValueArray *varray, void **dataResult,
+                                                ani_size *lengthResult)
+{
+    // clang-format off
+    VERIFY_ANI_ARGS(
+        ANIArg::MakeForEnv(venv, "env"),
+        ANIArg::MakeForValueArray(varray, "array"),
+        ANIArg::MakeForVoidPtrStorage(dataResult, "data_result"),
+        ANIArg::MakeForSizeStorage(lengthResult, "length_result")
+    );
+    // clang-format on
+    CHECK_PTR_ARG(venv);
+    CHECK_PTR_ARG(varray);
+
+    auto arrayRef = ResolveToAniRef(varray);
+    return GetInteractionAPI(venv)->ValueArray_Pin(venv->GetEnv(), arrayRef, dataResult, lengthResult);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+NO_UB_SANITIZE static ani_status ValueArray_Unpin(VEnv *venv, VValueArray *varray, void *data)
+{
+    // clang-format off
+    VERIFY_ANI_ARGS(
+        ANIArg::MakeForEnv(venv, "env"),
+        ANIArg::MakeForValueArray(varray, "array")
+    );
+    // clang-format on
+    CHECK_PTR_ARG(venv);
+    CHECK_PTR_ARG(varray);
+
+    auto arrayRef = ResolveToAniRef(varray);
+    return GetInteractionAPI(venv)->ValueArray_Unpin(venv->GetEnv(), arrayRef, data);
+}
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 NO_UB_SANITIZE static ani_status ValueArray_New_Boolean(VEnv *venv, ani_size length, VValueArrayBoolean **vresult)
 {
@@ -10324,6 +10395,10 @@ const __ani_interaction_api VERIFY_INTERACTION_API = {
     VERIFY_ANI_CAST_API(Primitive_Box_Double),
     VERIFY_ANI_CAST_API(Primitive_Unbox_Double),
     VERIFY_ANI_CAST_API(ValueArray_GetLength),
+    VERIFY_ANI_CAST_API(ValueArray_Pin),
+    VERIFY_ANI_CAST_API(ValueArray_Unpin),
+    VERIFY_ANI_CAST_API(String_Pin),
+    VERIFY_ANI_CAST_API(String_Unpin),
 };
 // clang-format on
 
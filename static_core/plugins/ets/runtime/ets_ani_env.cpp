@@ -15,6 +15,8 @@
 
 #include "plugins/ets/runtime/ets_ani_env.h"
 
+#include <algorithm>
+
 #include "plugins/ets/runtime/ani/ani_interaction_api.h"
 #include "plugins/ets/runtime/ani/verify/verify_ani_interaction_api.h"
 #include "plugins/ets/runtime/ani/verify/types/venv.h"
@@ -62,6 +64,13 @@ PandaAniEnv::PandaAniEnv(EtsExecutionContext *executionCtx, PandaUniquePtr<EtsRe
     }
 }
 
+PandaAniEnv::~PandaAniEnv()
+{
+    if (referenceStorage_ != nullptr) {
+        ReleaseAllPinnedData();
+    }
+}
+
 PandaEtsVM *PandaAniEnv::GetEtsVM() const
 {
     return executionCtx_->GetPandaVM();
@@ -69,11 +78,13 @@ PandaEtsVM *PandaAniEnv::GetEtsVM() const
 
 void PandaAniEnv::FreeInternalMemory()
 {
+    ReleaseAllPinnedData();
     referenceStorage_.reset();
 }
 
 void PandaAniEnv::CleanUp()
 {
+    ReleaseAllPinnedData();
     referenceStorage_->CleanUp();
 }
 
@@ -90,6 +101,97 @@ void PandaAniEnv::CreateEnvANIVerifier()
     envANIVerifier_ = MakePandaUnique<ani::verify::EnvANIVerifier>(this, verifier, c_api);
 }
 
+void *PandaAniEnv::PinData(EtsObject *source, EtsObject *object, void *data, size_t size)
+{
+    ASSERT_MANAGED_CODE();
+    auto *vm = GetEtsVM();
+    bool canPin = vm->GetGC()->IsPinningSupported();
+    if (canPin) {
+        auto it = pinnedData_.find(data);
+        if (it != pinnedData_.end()) {
+            ++it->second.pinCount;
+            return data;
+        }
+    }
+    EtsReference *ref = referenceStorage_->NewEtsRef(object, EtsReference::EtsObjectType::GLOBAL);
+    if (ref == nullptr) {
+        return nullptr;
+    }
+    EtsReference *sourceRef = nullptr;
+    if (source != object) {
+        sourceRef = referenceStorage_->NewEtsRef(source, EtsReference::EtsObjectType::GLOBAL);
+        if (sourceRef == nullptr) {
+            referenceStorage_->RemoveEtsRef(ref);
+            return nullptr;
+        }
+    }
+    void *result = data;
+    if (canPin) {
+        vm->GetHeapManager()->PinObject(object->GetCoreType());
+    } else {
+        // The object may be moved by GC, so native code gets a copy
+        result = Runtime::GetCurrent()->GetInternalAllocator()->Alloc(std::max<size_t>(size, 1U));
+        if (result == nullptr) {
+            referenceStorage_->RemoveEtsRef(ref);
+            if (sourceRef != nullptr) {
+                referenceStorage_->RemoveEtsRef(sourceRef);
+            }
+            return nullptr;
+        }
+        MemcpyUnsafe(result, data, size);
+    }
+    auto dataOffset = ToUintPtr(data) - ToUintPtr(object);
+    pinnedData_.emplace(result, PinnedData {ref, sourceRef, dataOffset, size, 1U, !canPin});
+    return result;
+}
+
+bool PandaAniEnv::UnpinData(EtsObject *object, const void *data, bool writeBack)
+{
+    ASSERT_MANAGED_CODE();
+    auto it = pinnedData_.find(data);
+    if (it == pinnedData_.end()) {
+        return false;
+    }
+    PinnedData &pinned = it->second;
+    if (object != referenceStorage_->GetEtsObject(pinned.ref) &&
+        (pinned.sourceRef == nullptr || object != referenceStorage_->GetEtsObject(pinned.sourceRef))) {
+        return false;
+    }
+    if (--pinned.pinCount > 0) {
+        return true;
+    }
+    ReleasePinnedData(pinned, data, writeBack);
+    pinnedData_.erase(it);
+    return true;
+}
+
+void PandaAniEnv::ReleasePinnedData(const PinnedData &pinned, const void *data, bool writeBack)
+{
+    EtsObject *object = referenceStorage_->GetEtsObject(pinned.ref);
+    if (pinned.isCopy) {
+        if (writeBack) {
+            MemcpyUnsafe(ToVoidPtr(ToUintPtr(object) + pinned.dataOffset), data, pinned.size);
+        }
+        Runtime::GetCurrent()->GetInternalAllocator()->Free(const_cast<void *>(data));
+    } else {
+        GetEtsVM()->GetHeapManager()->UnpinObject(object->GetCoreType());
+    }
+    referenceStorage_->RemoveEtsRef(pinned.ref);
+    if (pinned.sourceRef != nullptr) {
+        referenceStorage_->RemoveEtsRef(pinned.sourceRef);
+    }
+}
+
+void PandaAniEnv::ReleaseAllPinnedData()
+{
+    for (const auto &[data, pinned] : pinnedData_) {
+        // The copy is dropped, as native code did not ask to write it back
+        static constexpr bool WRITE_BACK = false;
+        ReleasePinnedData(pinned, data, WRITE_BACK);
+    }
+    pinnedData_.clear();
+}
+
 void PandaAniEnv::SetException(EtsThrowable *thr)
 {
     ASSERT_MANAGED_CODE();
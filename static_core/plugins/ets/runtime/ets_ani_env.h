@@ -17,6 +17,7 @@
 #define PANDA_PLUGINS_ETS_RUNTIME_ETS_ANI_ENV_H
 
 #include "runtime/include/managed_thread.h"
+#include "runtime/include/mem/panda_containers.h"
 #include "plugins/ets/runtime/ani/ani.h"
 #include "plugins/ets/runtime/ani/verify/env_ani_verifier.h"
 #include "plugins/ets/runtime/mem/ets_reference.h"
@@ -33,7 +34,7 @@ public:
                                                         mem::InternalAllocatorPtr allocator);
 
     PandaAniEnv(EtsExecutionContext *executionCtx, PandaUniquePtr<EtsReferenceStorage> referenceStorage);
-    ~PandaAniEnv() = default;
+    ~PandaAniEnv();
 
     EtsExecutionContext *GetExecutionContext() const
     {
@@ -63,6 +64,25 @@ public:
     /// @brief Internally creates and initializes the Environment-specific ANI Verifier.
     void CreateEnvANIVerifier();
 
+    /**
+     * @brief Pins @param object, so native code may access its data directly until UnpinData is called.
+     * If the GC can not pin objects, the data is copied to a native buffer.
+     * @param source the object passed by native code, e.g. the tree string which was flattened to @param object
+     * @param object the primitive array or the line string which contains the data
+     * @param data the data inside @param object
+     * @param size the size of the data in bytes
+     * @return the data for the native code, or nullptr if there is not enough memory
+     */
+    void *PinData(EtsObject *source, EtsObject *object, void *data, size_t size);
+
+    /**
+     * @brief Releases the data returned by PinData
+     * @param object the object the data was pinned from
+     * @param writeBack copy the native buffer back to the object if the data was copied
+     * @return false if @param data was not returned by PinData for @param object
+     */
+    bool UnpinData(EtsObject *object, const void *data, bool writeBack);
+
     void SetException(EtsThrowable *thr);
     EtsThrowable *GetThrowable() const;
     bool HasPendingException() const;
@@ -75,9 +95,25 @@ public:
     NO_MOVE_SEMANTIC(PandaAniEnv);
 
 private:
+    struct PinnedData {
+        // Keeps the object alive, as the flattened string is not referenced by the managed code
+        EtsReference *ref;
+        // The object passed by native code, if it differs from the object which contains the data
+        EtsReference *sourceRef;
+        size_t dataOffset;
+        size_t size;
+        uint32_t pinCount;
+        bool isCopy;
+    };
+
+    void ReleasePinnedData(const PinnedData &pinned, const void *data, bool writeBack);
+    /// Releases the data, which native code did not unpin before the env is cleaned up
+    void ReleaseAllPinnedData();
+
     EtsExecutionContext *executionCtx_;
     PandaUniquePtr<EtsReferenceStorage> referenceStorage_;
     PandaUniquePtr<ani::verify::EnvANIVerifier> envANIVerifier_;
+    PandaUnorderedMap<const void *, PinnedData> pinnedData_;
 };
 
 }  // namespace ark::ets
@@ -113,7 +113,9 @@ static CoroutineManagerConfig CreateCoroutineManagerConfig(const RuntimeOptions
         // enable external timer implementation
         options.IsCoroutineEnableFeaturesEnableExternalTimer(plugins::LangToRuntimeType(panda_file::SourceLang::ETS)),
         // number of reserved workers for taskpool
-        taskPoolMode == ets::intrinsics::taskpool::TASKPOOL_EAWORKER_MODE ? taskpoolEWorkersCount : 0};
+        taskPoolMode == ets::intrinsics::taskpool::TASKPOOL_EAWORKER_MODE ? taskpoolEWorkersCount : 0,
+        // enable work stealing
+        options.IsCoroutineEnableFeaturesWorkStealing(plugins::LangToRuntimeType(panda_file::SourceLang::ETS))};
     return cfg;
 }
 
@@ -294,7 +294,7 @@ template <typename FRead>
 }
 
 template <typename FRead>
-[[nodiscard]] static ALWAYS_INLINE inline bool ConvertArgToJS(InteropCtx *ctx, ProtoReader &protoReader,
+[[nodiscard]] static ALWAYS_INLINE inline bool ConvertArgToJS(InteropCtx *ctx, panda_file::Type type,
                                                               napi_value *resSlot, FRead &readVal)
 {
     INTEROP_TRACE();
@@ -309,7 +309,7 @@ template <typename FRead>
         return res != nullptr;
     };
 
-    switch (protoReader.GetType().GetId()) {
+    switch (type.GetId()) {
         case panda_file::Type::TypeId::VOID: {
             *resSlot = GetUndefined(env);
             return true;
@@ -343,6 +343,13 @@ template <typename FRead>
     }
 }
 
+template <typename FRead>
+[[nodiscard]] static ALWAYS_INLINE inline bool ConvertArgToJS(InteropCtx *ctx, ProtoReader &protoReader,
+                                                              napi_value *resSlot, FRead &readVal)
+{
+    return ConvertArgToJS(ctx, protoReader.GetType(), resSlot, readVal);
+}
+
 }  // namespace ark::ets::interop::js
 
 #endif  // PANDA_PLUGINS_ETS_RUNTIME_INTEROP_JS_CALL_ARG_CONVERTORS_H
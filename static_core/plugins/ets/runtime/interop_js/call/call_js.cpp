@@ -18,6 +18,7 @@
 #include "runtime/mem/local_object_handle.h"
 #include "plugins/ets/runtime/interop_js/call/call.h"
 #include "plugins/ets/runtime/interop_js/call/arg_convertors.h"
+#include "plugins/ets/runtime/interop_js/call/call_js_stub.h"
 #include "plugins/ets/runtime/interop_js/call/proto_reader.h"
 #include "plugins/ets/runtime/interop_js/code_scopes.h"
 #include "plugins/ets/runtime/ets_stubs-inl.h"
@@ -32,12 +33,58 @@ static ALWAYS_INLINE inline arch::ArgReader<RUNTIME_ARCH> CreateProxyBridgeArgRe
     return arch::ArgReader<RUNTIME_ARCH>(inGprArgs, inFprArgs, inStackArgs);
 }
 
+CallJSStub::CallJSStub(Method *method, PandaVector<panda_file::Type> &&types, uint32_t refArgsEnd)
+    : method_(method), types_(std::move(types)), refArgsEnd_(refArgsEnd), hasVarArgs_(method->HasVarArgs())
+{
+    ASSERT(!types_.empty());
+    InitSpecialMethod();
+}
+
+void CallJSStub::InitSpecialMethod()
+{
+    std::string_view methodName(EtsMethod::FromRuntimeMethod(method_)->GetName());
+    if (methodName.rfind(GETTER_BEGIN, 0) == 0) {
+        specialMethod_ = SpecialMethod::GETTER;
+        propertyName_ = methodName.substr(SETTER_GETTER_PREFIX_LENGTH);
+    } else if (methodName.rfind(SETTER_BEGIN, 0) == 0) {
+        specialMethod_ = SpecialMethod::SETTER;
+        propertyName_ = methodName.substr(SETTER_GETTER_PREFIX_LENGTH);
+    } else if (methodName == GET_INDEX_METHOD) {
+        specialMethod_ = SpecialMethod::GET_INDEX;
+    } else if (methodName == SET_INDEX_METHOD) {
+        specialMethod_ = SpecialMethod::SET_INDEX;
+    } else if (methodName == ITERATOR_METHOD) {
+        specialMethod_ = SpecialMethod::ITERATOR;
+    }
+}
+
+CallJSStub *CallJSStub::GetOrCreate(InteropCtx *ctx, Method *method)
+{
+    auto *cache = ctx->GetCallJSStubsCache();
+    auto *stub = cache->Lookup(method);
+    if (LIKELY(stub != nullptr)) {
+        return stub;
+    }
+    INTEROP_LOG(DEBUG) << "Create call stub for " << method->GetFullName();
+    PandaVector<panda_file::Type> types;
+    uint32_t refArgsEnd = 0;
+    panda_file::ShortyIterator it(method->GetShorty());
+    types.push_back(*it);  // return type
+    for (++it; it != panda_file::ShortyIterator(); ++it) {
+        types.push_back(*it);
+        if ((*it).IsReference()) {
+            refArgsEnd = static_cast<uint32_t>(types.size() - 1);
+        }
+    }
+    return cache->Insert(method, std::make_unique<CallJSStub>(method, std::move(types), refArgsEnd));
+}
+
 class CallJSHandler {
 public:
     ALWAYS_INLINE CallJSHandler(EtsExecutionContext *executionCtx, Method *method, uint8_t *args, uint8_t *inStackArgs)
         : executionCtx_(executionCtx),
           ctx_(InteropCtx::Current(executionCtx_)),
-          protoReader_(method, ctx_->GetClassLinker(), ctx_->LinkerCtx()),
+          stub_(CallJSStub::GetOrCreate(ctx_, method)),
           argReader_(CreateProxyBridgeArgReader(args, inStackArgs))
     {
     }
@@ -49,19 +96,19 @@ public:
 
     ALWAYS_INLINE ObjectHeader *SetupArgreader(bool isInstance)
     {
-        auto method = protoReader_.GetMethod();
-        protoReader_.Advance();                // skip return type
+        auto method = stub_->GetMethod();
         argReader_.template Read<Method *>();  // skip method
         ASSERT(isInstance == !method->IsStatic());
         numArgs_ = method->GetNumArgs() - static_cast<uint32_t>(isInstance);
+        ASSERT(numArgs_ == stub_->GetNumArgs());
         return isInstance ? argReader_.Read<ObjectHeader *>() : nullptr;
     }
 
     template <panda_file::Type::TypeId PF_TYPEID, typename T>
     ALWAYS_INLINE T ReadFixedArg()
     {
-        ASSERT(protoReader_.GetType() == panda_file::Type(PF_TYPEID));
-        protoReader_.Advance();
+        ASSERT(stub_->GetArgType(argIdx_) == panda_file::Type(PF_TYPEID));
+        argIdx_++;
         numArgs_--;
         return argReader_.Read<T>();
     }
@@ -69,7 +116,7 @@ public:
     template <typename T>
     ALWAYS_INLINE T *ReadFixedRefArg([[maybe_unused]] Class *expected)
     {
-        ASSERT(expected == nullptr || protoReader_.GetClass() == expected);
+        ASSERT(expected == nullptr || ResolveArgClass(argIdx_) == expected);
         return ReadFixedArg<panda_file::Type::TypeId::REFERENCE, T *>();
     }
 
@@ -89,7 +136,7 @@ public:
 
     ALWAYS_INLINE Method *GetMethod()
     {
-        return protoReader_.GetMethod();
+        return stub_->GetMethod();
     }
 
     ~CallJSHandler() = default;
@@ -121,15 +168,21 @@ private:
 
     napi_value HandleSpecialMethod(Span<napi_value> jsargs);
 
+    Class *ResolveReturnClass();
+
+    Class *ResolveArgClass(uint32_t argIdx);
+
     NO_COPY_SEMANTIC(CallJSHandler);
     NO_MOVE_SEMANTIC(CallJSHandler);
 
     EtsExecutionContext *const executionCtx_;
     InteropCtx *const ctx_;
 
-    ProtoReader protoReader_;
+    CallJSStub *const stub_;
     arch::ArgReader<RUNTIME_ARCH> argReader_;
     uint32_t numArgs_ {};
+    // index of the next argument in the proto
+    uint32_t argIdx_ {};
     napi_value jsThis_ {};
     napi_value jsFn_ {};
 };
@@ -242,22 +295,24 @@ template <bool IS_NEWCALL>
 ALWAYS_INLINE inline std::optional<napi_value> CallJSHandler::ConvertArgsAndCall()
 {
     INTEROP_TRACE();
-    bool isVarArgs = UNLIKELY(protoReader_.GetMethod()->HasVarArgs());
+    bool isVarArgs = UNLIKELY(stub_->HasVarArgs());
     auto readVal = [this](auto typeTag) { return argReader_.template Read<typename decltype(typeTag)::type>(); };
     auto const numNonRest = numArgs_ - (isVarArgs ? 1 : 0);
     auto jsargs = ctx_->GetTempArgs<napi_value>(numNonRest);
 
-    // scope is required to ConvertRefArgToJS
-    HandleScope<ObjectHeader *> scope(executionCtx_->GetMT());
-    for (uint32_t argIdx = 0; argIdx < numNonRest; ++argIdx, protoReader_.Advance()) {
-        if (UNLIKELY(!ConvertArgToJS(ctx_, protoReader_, &jsargs[argIdx], readVal))) {
+    // scope is required to ConvertRefArgToJS, the signatures with primitive arguments only do not need it
+    std::optional<HandleScope<ObjectHeader *>> scope;
+    if (stub_->HasRefArgsFrom(argIdx_)) {
+        scope.emplace(executionCtx_->GetMT());
+    }
+    for (uint32_t argIdx = 0; argIdx < numNonRest; ++argIdx, ++argIdx_) {
+        if (UNLIKELY(!ConvertArgToJS(ctx_, stub_->GetArgType(argIdx_), &jsargs[argIdx], readVal))) {
             return std::nullopt;
         }
     }
 
-    napi_value handlerResult = HandleSpecialMethod(*jsargs);
-    if (handlerResult) {
-        return handlerResult;
+    if (UNLIKELY(stub_->GetSpecialMethod() != CallJSStub::SpecialMethod::NONE)) {
+        return HandleSpecialMethod(*jsargs);
     }
 
     napi_env env = ctx_->GetJSEnv();
@@ -279,45 +334,77 @@ napi_value CallJSHandler::HandleSpecialMethod(Span<napi_value> jsargs)
     napi_value handlerResult {};
     napi_env env = ctx_->GetJSEnv();
     ScopedNativeCodeThread nativeScope(executionCtx_->GetMT());
-    std::string_view methodName(EtsMethod::FromRuntimeMethod(protoReader_.GetMethod())->GetName());
 
-    if (methodName.rfind(GETTER_BEGIN, 0) == 0) {
-        std::string content = std::string(methodName.substr(SETTER_GETTER_PREFIX_LENGTH));
-        NAPI_CHECK_FATAL(napi_get_named_property(env, jsThis_, content.c_str(), &handlerResult));
-    } else if (methodName.rfind(SETTER_BEGIN, 0) == 0) {
-        std::string content = std::string(methodName.substr(SETTER_GETTER_PREFIX_LENGTH));
-        NAPI_CHECK_FATAL(napi_create_string_utf8(env, content.c_str(), NAPI_AUTO_LENGTH, &handlerResult));
-        NAPI_CHECK_FATAL(napi_set_property(env, jsThis_, handlerResult, jsargs[0]));
-        napi_get_undefined(env, &handlerResult);
-    } else if (methodName == GET_INDEX_METHOD) {
-        int32_t idx;
-        NAPI_CHECK_FATAL(napi_get_value_int32(env, jsargs[0], &idx));
-        NAPI_CHECK_FATAL(napi_get_element(env, jsThis_, idx, &handlerResult));
-    } else if (methodName == SET_INDEX_METHOD) {
-        int32_t idx;
-        NAPI_CHECK_FATAL(napi_get_value_int32(env, jsargs[0], &idx));
-        NAPI_CHECK_FATAL(napi_set_element(env, jsThis_, idx, jsargs[1]));
-        napi_get_undefined(env, &handlerResult);
-    } else if (methodName == ITERATOR_METHOD) {
-        napi_value global;
-        NAPI_CHECK_FATAL(napi_get_global(env, &global));
-        napi_value symbol;
-        NAPI_CHECK_FATAL(napi_get_named_property(env, global, "Symbol", &symbol));
-        napi_value symbolIterator;
-        NAPI_CHECK_FATAL(napi_get_named_property(env, symbol, "iterator", &symbolIterator));
-        napi_value iteratorMethod;
-        NAPI_CHECK_FATAL(napi_get_property(env, jsThis_, symbolIterator, &iteratorMethod));
-        if (GetValueType(env, iteratorMethod) == napi_undefined) {
-            NAPI_CHECK_FATAL(napi_get_undefined(env, &handlerResult));
-            return handlerResult;
+    switch (stub_->GetSpecialMethod()) {
+        case CallJSStub::SpecialMethod::GETTER: {
+            NAPI_CHECK_FATAL(napi_get_named_property(env, jsThis_, stub_->GetPropertyName().c_str(), &handlerResult));
+            break;
+        }
+        case CallJSStub::SpecialMethod::SETTER: {
+            NAPI_CHECK_FATAL(
+                napi_create_string_utf8(env, stub_->GetPropertyName().c_str(), NAPI_AUTO_LENGTH, &handlerResult));
+            NAPI_CHECK_FATAL(napi_set_property(env, jsThis_, handlerResult, jsargs[0]));
+            napi_get_undefined(env, &handlerResult);
+            break;
+        }
+        case CallJSStub::SpecialMethod::GET_INDEX: {
+            int32_t idx;
+            NAPI_CHECK_FATAL(napi_get_value_int32(env, jsargs[0], &idx));
+            NAPI_CHECK_FATAL(napi_get_element(env, jsThis_, idx, &handlerResult));
+            break;
+        }
+        case CallJSStub::SpecialMethod::SET_INDEX: {
+            int32_t idx;
+            NAPI_CHECK_FATAL(napi_get_value_int32(env, jsargs[0], &idx));
+            NAPI_CHECK_FATAL(napi_set_element(env, jsThis_, idx, jsargs[1]));
+            napi_get_undefined(env, &handlerResult);
+            break;
+        }
+        case CallJSStub::SpecialMethod::ITERATOR: {
+            napi_value global;
+            NAPI_CHECK_FATAL(napi_get_global(env, &global));
+            napi_value symbol;
+            NAPI_CHECK_FATAL(napi_get_named_property(env, global, "Symbol", &symbol));
+            napi_value symbolIterator;
+            NAPI_CHECK_FATAL(napi_get_named_property(env, symbol, "iterator", &symbolIterator));
+            napi_value iteratorMethod;
+            NAPI_CHECK_FATAL(napi_get_property(env, jsThis_, symbolIterator, &iteratorMethod));
+            if (GetValueType(env, iteratorMethod) == napi_undefined) {
+                NAPI_CHECK_FATAL(napi_get_undefined(env, &handlerResult));
+                return handlerResult;
+            }
+            size_t jsArgc = 0;
+            NAPI_CHECK_FATAL(napi_call_function(env, jsThis_, iteratorMethod, jsArgc, nullptr, &handlerResult));
+            break;
         }
-        size_t jsArgc = 0;
-        NAPI_CHECK_FATAL(napi_call_function(env, jsThis_, iteratorMethod, jsArgc, nullptr, &handlerResult));
+        default:
+            UNREACHABLE();
     }
 
     return handlerResult;
 }
 
+Class *CallJSHandler::ResolveReturnClass()
+{
+    Class *klass = stub_->GetReturnClass();
+    if (UNLIKELY(klass == nullptr)) {
+        ProtoReader protoReader(stub_->GetMethod(), ctx_->GetClassLinker(), ctx_->LinkerCtx());
+        klass = protoReader.GetClass();
+        stub_->SetReturnClass(klass);
+    }
+    return klass;
+}
+
+Class *CallJSHandler::ResolveArgClass(uint32_t argIdx)
+{
+    ProtoReader protoReader(stub_->GetMethod(), ctx_->GetClassLinker(), ctx_->LinkerCtx());
+    protoReader.Advance();  // skip return type
+    for (uint32_t i = 0; i < argIdx; ++i) {
+        protoReader.Advance();
+    }
+    return protoReader.GetClass();
+}
+
 template <bool IS_NEWCALL>
 ALWAYS_INLINE inline std::optional<napi_value> CallJSHandler::CallConverted(Span<napi_value> jsargs)
 {
@@ -346,11 +433,10 @@ ALWAYS_INLINE inline std::optional<Value> CallJSHandler::ConvertRetval(napi_valu
     INTEROP_TRACE();
     [[maybe_unused]] napi_env env = ctx_->GetJSEnv();
     Value etsRet;
-    protoReader_.Reset();
 
     if constexpr (IS_NEWCALL) {
         INTEROP_TRACE();
-        ASSERT(protoReader_.GetClass() == PlatformTypes(executionCtx_)->interopJSValue->GetRuntimeClass());
+        ASSERT(ResolveReturnClass() == PlatformTypes(executionCtx_)->interopJSValue->GetRuntimeClass());
         auto res = JSConvertJSValue::Unwrap(ctx_, env, jsRet);
         if (UNLIKELY(!res.has_value())) {
             return std::nullopt;
@@ -359,7 +445,8 @@ ALWAYS_INLINE inline std::optional<Value> CallJSHandler::ConvertRetval(napi_valu
         etsRet = Value(res.value()->GetCoreType());
     } else {
         auto store = [&etsRet](auto val) { etsRet = Value(val); };
-        if (UNLIKELY(!ConvertArgToEts(ctx_, protoReader_, store, jsRet))) {
+        auto getClass = [this]() { return ResolveReturnClass(); };
+        if (UNLIKELY(!ConvertArgToEts(ctx_, stub_->GetReturnType(), store, getClass, jsRet))) {
             return std::nullopt;
         }
     }
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_PLUGINS_ETS_RUNTIME_INTEROP_JS_CALL_CALL_JS_STUB_H
+#define PANDA_PLUGINS_ETS_RUNTIME_INTEROP_JS_CALL_CALL_JS_STUB_H
+
+#include "libarkfile/include/type.h"
+#include "plugins/ets/runtime/interop_js/ets_proxy/wrappers_cache.h"
+#include "runtime/include/mem/panda_containers.h"
+#include "runtime/include/mem/panda_string.h"
+
+namespace ark {
+class Class;
+class Method;
+}  // namespace ark
+
+namespace ark::ets::interop::js {
+
+class InteropCtx;
+
+/**
+ * Signature of a method, which calls JS, specialized on the first call of the method.
+ * The proto is parsed once, so the call handler converts the arguments by the cached types
+ * and skips the checks of the special methods for the regular calls.
+ */
+class CallJSStub {
+public:
+    enum class SpecialMethod : uint8_t { NONE, GETTER, SETTER, GET_INDEX, SET_INDEX, ITERATOR };
+
+    static CallJSStub *GetOrCreate(InteropCtx *ctx, Method *method);
+
+    CallJSStub(Method *method, PandaVector<panda_file::Type> &&types, uint32_t refArgsEnd);
+    ~CallJSStub() = default;
+    NO_COPY_SEMANTIC(CallJSStub);
+    NO_MOVE_SEMANTIC(CallJSStub);
+
+    Method *GetMethod() const
+    {
+        return method_;
+    }
+
+    panda_file::Type GetReturnType() const
+    {
+        return types_[0];
+    }
+
+    /// @param idx is the index of the argument in the proto, the return type is not counted
+    panda_file::Type GetArgType(uint32_t idx) const
+    {
+        return types_[idx + 1];
+    }
+
+    uint32_t GetNumArgs() const
+    {
+        return static_cast<uint32_t>(types_.size() - 1);
+    }
+
+    /// Whether any argument starting from @param idx is a reference, which needs a handle scope to be converted
+    bool HasRefArgsFrom(uint32_t idx) const
+    {
+        return refArgsEnd_ > idx;
+    }
+
+    bool HasVarArgs() const
+    {
+        return hasVarArgs_;
+    }
+
+    SpecialMethod GetSpecialMethod() const
+    {
+        return specialMethod_;
+    }
+
+    const PandaString &GetPropertyName() const
+    {
+        return propertyName_;
+    }
+
+    /// Class of the reference return value, it is resolved on the first conversion of the return value
+    Class *GetReturnClass() const
+    {
+        return returnClass_;
+    }
+
+    void SetReturnClass(Class *klass)
+    {
+        returnClass_ = klass;
+    }
+
+private:
+    void InitSpecialMethod();
+
+    Method *const method_;
+    PandaVector<panda_file::Type> types_;
+    // index of the last reference argument plus one
+    uint32_t refArgsEnd_;
+    bool hasVarArgs_;
+    SpecialMethod specialMethod_ {SpecialMethod::NONE};
+    PandaString propertyName_;
+    Class *returnClass_ {};
+};
+
+using CallJSStubsCache = ets_proxy::WrappersCache<Method *, CallJSStub>;
+
+}  // namespace ark::ets::interop::js
+
+#endif  // PANDA_PLUGINS_ETS_RUNTIME_INTEROP_JS_CALL_CALL_JS_STUB_H
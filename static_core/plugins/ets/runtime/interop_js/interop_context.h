@@ -22,6 +22,7 @@
 #include "plugins/ets/runtime/ets_coroutine.h"
 #include "plugins/ets/runtime/ets_vm.h"
 #include "plugins/ets/runtime/interop_js/app_state_manager.h"
+#include "plugins/ets/runtime/interop_js/call/call_js_stub.h"
 #include "plugins/ets/runtime/interop_js/ets_proxy/ets_class_wrapper.h"
 #include "plugins/ets/runtime/interop_js/ets_proxy/ets_method_wrapper.h"
 #include "plugins/ets/runtime/interop_js/ets_proxy/shared_reference_storage.h"
@@ -419,6 +420,11 @@ public:
         return &etsClassWrappersCache_;
     }
 
+    CallJSStubsCache *GetCallJSStubsCache()
+    {
+        return &callJSStubsCache_;
+    }
+
     ets_proxy::SharedReferenceStorage *GetSharedRefStorage()
     {
         return sharedEtsVmState_->etsProxyRefStorage.get();
@@ -568,6 +574,9 @@ private:
     ets_proxy::EtsMethodWrappersCache etsMethodWrappersCache_ {};
     ets_proxy::EtsClassWrappersCache etsClassWrappersCache_ {};
 
+    // call_js data
+    CallJSStubsCache callJSStubsCache_ {};
+
     StackInfoManager stackInfoManager_;
     bool isInteropStackEnabled_ {};
     std::once_flag initStackFlag_;
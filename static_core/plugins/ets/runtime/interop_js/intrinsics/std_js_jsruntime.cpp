@@ -436,6 +436,11 @@ EtsObject *InteropTransferHelperTransferArrayBufferToDynamicImplIntrinsic(EtsStd
     return TransferArrayBufferToDynamic(object);
 }
 
+EtsStdCoreArrayBuffer *InteropTransferHelperCreateSharedArrayBufferImplIntrinsic(int32_t byteLength)
+{
+    return CreateSharedArrayBuffer(byteLength);
+}
+
 EtsObject *InteropTransferHelperCreateDynamicTypedArrayIntrinsic(EtsStdCoreArrayBuffer *object, int32_t typedArrayType,
                                                                  double length, double byteOffset)
 {
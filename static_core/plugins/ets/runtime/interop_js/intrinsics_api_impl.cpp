@@ -18,6 +18,7 @@
 #include "plugins/ets/runtime/ets_handle_scope.h"
 #include "plugins/ets/runtime/ets_platform_types.h"
 #include "runtime/include/class_linker-inl.h"
+#include "runtime/include/exceptions.h"
 #include "runtime/include/object_header.h"
 #include "runtime/execution/job_execution_context.h"
 #include "plugins/ets/runtime/ets_stubs-inl.h"
@@ -29,6 +30,7 @@
 #include "plugins/ets/runtime/interop_js/intrinsics_api_impl.h"
 #include "plugins/ets/runtime/interop_js/code_scopes.h"
 #include "plugins/ets/runtime/interop_js/logger.h"
+#include "plugins/ets/runtime/interop_js/shared_backing_store.h"
 #include "plugins/ets/runtime/interop_js/st_value/ets_vm_STValue.h"
 #include "plugins/ets/runtime/interop_js/xref_object_operator.h"
 #include "plugins/ets/runtime/types/ets_array.h"
@@ -1892,6 +1894,16 @@ EtsStdCoreArrayBuffer *TransferArrayBufferToStatic(ESValue *object)
     // NOTE(dslynko, #23919): finalize semantics of resizable ArrayBuffers
     NAPI_CHECK_FATAL(napi_get_arraybuffer_info(env, dynamicArrayBuffer, &data, &byteLength));
 
+    if (auto *store = SharedBackingStore::Acquire(data); store != nullptr) {
+        // The static buffer owns its own reference, so the memory outlives the JS buffer if needed
+        auto *sharedArrayBuffer = EtsStdCoreArrayBuffer::CreateFinalizable(executionCtx, data, byteLength,
+                                                                           SharedBackingStore::FinalizeStatic, store);
+        if (UNLIKELY(sharedArrayBuffer == nullptr)) {
+            store->Release();
+        }
+        return sharedArrayBuffer;
+    }
+
     auto *arrayBuffer = EtsStdCoreArrayBuffer::Create(executionCtx, byteLength);
     if (UNLIKELY(arrayBuffer == nullptr)) {
         return nullptr;
@@ -1903,6 +1915,47 @@ EtsStdCoreArrayBuffer *TransferArrayBufferToStatic(ESValue *object)
     return arrayBuffer;
 }
 
+// Shares the memory of the buffer created by `CreateSharedArrayBuffer`, copies the data of other buffers
+static napi_value CreateDynamicArrayBuffer(napi_env env, EtsStdCoreArrayBuffer *staticArrayBuffer)
+{
+    napi_value dynamicArrayBuffer = nullptr;
+    auto byteLength = static_cast<size_t>(staticArrayBuffer->GetByteLength());
+    if (staticArrayBuffer->IsExternal()) {
+        auto *store = SharedBackingStore::Acquire(staticArrayBuffer->GetData());
+        if (store != nullptr) {
+            // The JS buffer owns its own reference, which is released by the JS finalizer
+            NAPI_CHECK_FATAL(napi_create_external_arraybuffer(env, store->GetData(), byteLength,
+                                                              SharedBackingStore::FinalizeDynamic, store,
+                                                              &dynamicArrayBuffer));
+            return dynamicArrayBuffer;
+        }
+    }
+    void *data;
+    // NOTE(dslynko, #23919): finalize semantics of resizable ArrayBuffers
+    NAPI_CHECK_FATAL(napi_create_arraybuffer(env, byteLength, &data, &dynamicArrayBuffer));
+    std::copy_n(reinterpret_cast<const uint8_t *>(staticArrayBuffer->GetData()), byteLength,
+                reinterpret_cast<uint8_t *>(data));
+    return dynamicArrayBuffer;
+}
+
+EtsStdCoreArrayBuffer *CreateSharedArrayBuffer(int32_t byteLength)
+{
+    auto executionCtx = EtsExecutionContext::GetCurrent();
+    ASSERT(byteLength >= 0);
+    auto *store = SharedBackingStore::Create(static_cast<size_t>(byteLength));
+    if (UNLIKELY(store == nullptr)) {
+        ThrowOutOfMemoryError(executionCtx->GetMT(), "Cannot allocate shared ArrayBuffer memory");
+        return nullptr;
+    }
+    // The reference returned by `Create` is owned by the static buffer
+    auto *arrayBuffer = EtsStdCoreArrayBuffer::CreateFinalizable(
+        executionCtx, store->GetData(), store->GetByteLength(), SharedBackingStore::FinalizeStatic, store);
+    if (UNLIKELY(arrayBuffer == nullptr)) {
+        store->Release();
+    }
+    return arrayBuffer;
+}
+
 EtsObject *TransferArrayBufferToDynamic(EtsStdCoreArrayBuffer *staticArrayBuffer)
 {
     auto executionCtx = EtsExecutionContext::GetCurrent();
@@ -1915,12 +1968,7 @@ EtsObject *TransferArrayBufferToDynamic(EtsStdCoreArrayBuffer *staticArrayBuffer
     auto env = ctx->GetJSEnv();
     NapiScope jsHandleScope(env);
 
-    napi_value dynamicArrayBuffer = nullptr;
-    void *data;
-    // NOTE(dslynko, #23919): finalize semantics of resizable ArrayBuffers
-    NAPI_CHECK_FATAL(napi_create_arraybuffer(env, staticArrayBuffer->GetByteLength(), &data, &dynamicArrayBuffer));
-    std::copy_n(reinterpret_cast<const uint8_t *>(staticArrayBuffer->GetData()), staticArrayBuffer->GetByteLength(),
-                reinterpret_cast<uint8_t *>(data));
+    napi_value dynamicArrayBuffer = CreateDynamicArrayBuffer(env, staticArrayBuffer);
 
     JSValue *etsJSValue = JSValue::Create(executionCtx, ctx, dynamicArrayBuffer);
     return reinterpret_cast<EtsObject *>(etsJSValue);
@@ -1939,11 +1987,7 @@ EtsObject *CreateDynamicTypedArray(EtsStdCoreArrayBuffer *staticArrayBuffer, int
     auto env = ctx->GetJSEnv();
     NapiScope jsHandleScope(env);
 
-    napi_value dynamicArrayBuffer = nullptr;
-    void *data;
-    NAPI_CHECK_FATAL(napi_create_arraybuffer(env, staticArrayBuffer->GetByteLength(), &data, &dynamicArrayBuffer));
-    std::copy_n(reinterpret_cast<const uint8_t *>(staticArrayBuffer->GetData()), staticArrayBuffer->GetByteLength(),
-                reinterpret_cast<uint8_t *>(data));
+    napi_value dynamicArrayBuffer = CreateDynamicArrayBuffer(env, staticArrayBuffer);
 
     napi_value dynamicTypedArray = nullptr;
     napi_create_typedarray(env, static_cast<napi_typedarray_type>(typedArrayType), length, dynamicArrayBuffer,
@@ -1965,11 +2009,7 @@ EtsObject *CreateDynamicDataView(EtsStdCoreArrayBuffer *staticArrayBuffer, doubl
     auto env = ctx->GetJSEnv();
     NapiScope jsHandleScope(env);
 
-    napi_value dynamicArrayBuffer = nullptr;
-    void *data;
-    NAPI_CHECK_FATAL(napi_create_arraybuffer(env, staticArrayBuffer->GetByteLength(), &data, &dynamicArrayBuffer));
-    std::copy_n(reinterpret_cast<const uint8_t *>(staticArrayBuffer->GetData()), staticArrayBuffer->GetByteLength(),
-                reinterpret_cast<uint8_t *>(data));
+    napi_value dynamicArrayBuffer = CreateDynamicArrayBuffer(env, staticArrayBuffer);
 
     napi_value dynamicDataView = nullptr;
     napi_create_dataview(env, byteLength, dynamicArrayBuffer, byteOffset, &dynamicDataView);
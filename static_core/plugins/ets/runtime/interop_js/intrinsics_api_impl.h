@@ -99,6 +99,7 @@ EtsObject *CompilerConvertLocalToRefType(void *klassPtr, void *value);
 JSValue *JSRuntimeGetPropertyJSValueyByKey(JSValue *objectValue, JSValue *keyValue);
 EtsStdCoreArrayBuffer *TransferArrayBufferToStatic(ESValue *object);
 EtsObject *TransferArrayBufferToDynamic(EtsStdCoreArrayBuffer *staticArrayBuffer);
+EtsStdCoreArrayBuffer *CreateSharedArrayBuffer(int32_t byteLength);
 EtsObject *CreateDynamicTypedArray(EtsStdCoreArrayBuffer *staticArrayBuffer, int32_t typedArrayType, double length,
                                    double byteOffset);
 EtsObject *CreateDynamicDataView(EtsStdCoreArrayBuffer *staticArrayBuffer, double byteLength, double byteOffset);
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugins/ets/runtime/interop_js/shared_backing_store.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+
+#include "libarkbase/os/mutex.h"
+#include "libarkbase/utils/logger.h"
+#include "plugins/ets/runtime/interop_js/logger.h"
+
+namespace ark::ets::interop::js {
+
+std::atomic<size_t> SharedBackingStore::totalByteLength_ {0U};
+
+namespace {
+
+// The registry is not bound to a runtime allocator, because JS finalizers may run after the static VM is destroyed
+class SharedBackingStoreRegistry final {
+public:
+    static os::memory::Mutex &GetLock()
+    {
+        static os::memory::Mutex lock;
+        return lock;
+    }
+
+    static std::unordered_map<void *, SharedBackingStore *> &GetStores()
+    {
+        static std::unordered_map<void *, SharedBackingStore *> stores;
+        return stores;
+    }
+};
+
+}  // namespace
+
+/* static */
+SharedBackingStore *SharedBackingStore::Create(size_t byteLength)
+{
+    // Zero-length buffers still need a unique address to be found in the registry
+    void *data = std::calloc(std::max<size_t>(byteLength, 1U), 1U);  // NOLINT(cppcoreguidelines-no-malloc)
+    if (UNLIKELY(data == nullptr)) {
+        return nullptr;
+    }
+    // CC-OFFNXT(G.RES.09) private constructor
+    auto *store = new SharedBackingStore(data, byteLength);
+    {
+        os::memory::LockHolder lock(SharedBackingStoreRegistry::GetLock());
+        SharedBackingStoreRegistry::GetStores().emplace(data, store);
+    }
+    // Atomic with relaxed order reason: the value is used as a heuristic only
+    totalByteLength_.fetch_add(byteLength, std::memory_order_relaxed);
+    INTEROP_LOG(DEBUG) << "Created shared backing store " << data << " of " << byteLength << " bytes";
+    return store;
+}
+
+/* static */
+SharedBackingStore *SharedBackingStore::Acquire(void *data)
+{
+    if (data == nullptr) {
+        return nullptr;
+    }
+    os::memory::LockHolder lock(SharedBackingStoreRegistry::GetLock());
+    auto &stores = SharedBackingStoreRegistry::GetStores();
+    auto it = stores.find(data);
+    if (it == stores.end()) {
+        return nullptr;
+    }
+    ASSERT(it->second->refCount_ > 0U);
+    ++it->second->refCount_;
+    return it->second;
+}
+
+void SharedBackingStore::Release()
+{
+    {
+        os::memory::LockHolder lock(SharedBackingStoreRegistry::GetLock());
+        ASSERT(refCount_ > 0U);
+        if (--refCount_ > 0U) {
+            return;
+        }
+        SharedBackingStoreRegistry::GetStores().erase(data_);
+    }
+    // Atomic with relaxed order reason: the value is used as a heuristic only
+    totalByteLength_.fetch_sub(byteLength_, std::memory_order_relaxed);
+    INTEROP_LOG(DEBUG) << "Freed shared backing store " << data_;
+    std::free(data_);  // NOLINT(cppcoreguidelines-no-malloc)
+    delete this;
+}
+
+/* static */
+void SharedBackingStore::FinalizeStatic(void *store)
+{
+    reinterpret_cast<SharedBackingStore *>(store)->Release();
+}
+
+/* static */
+void SharedBackingStore::FinalizeDynamic([[maybe_unused]] napi_env env, [[maybe_unused]] void *data, void *hint)
+{
+    auto *store = reinterpret_cast<SharedBackingStore *>(hint);
+    ASSERT(store->GetData() == data);
+    store->Release();
+}
+
+}  // namespace ark::ets::interop::js
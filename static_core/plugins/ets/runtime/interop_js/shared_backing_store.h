@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_PLUGINS_ETS_RUNTIME_INTEROP_JS_SHARED_BACKING_STORE_H_
+#define PANDA_PLUGINS_ETS_RUNTIME_INTEROP_JS_SHARED_BACKING_STORE_H_
+
+#include <node_api.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "libarkbase/macros.h"
+
+namespace ark::ets::interop::js {
+
+/**
+ * Native memory shared by a static `ArrayBuffer` and a JS `ArrayBuffer` without copying.
+ * Each wrapper created on top of the store owns one reference, which is released by the finalizer of the wrapper,
+ * so the memory is freed only after both heaps have collected their wrappers.
+ * The stores are registered by the data address, so a buffer coming from the other side is recognized as shared.
+ */
+class SharedBackingStore final {
+public:
+    NO_COPY_SEMANTIC(SharedBackingStore);
+    NO_MOVE_SEMANTIC(SharedBackingStore);
+
+    /**
+     * Allocates zero-initialized memory and registers the store
+     * @return the store with one reference owned by the caller, nullptr if the allocation failed
+     */
+    static SharedBackingStore *Create(size_t byteLength);
+
+    /**
+     * Finds the store which owns @param data and acquires a reference to it
+     * @return nullptr if @param data does not belong to a shared store
+     */
+    static SharedBackingStore *Acquire(void *data);
+
+    /// Releases a reference, the last one frees the memory
+    void Release();
+
+    void *GetData() const
+    {
+        return data_;
+    }
+
+    size_t GetByteLength() const
+    {
+        return byteLength_;
+    }
+
+    /// @return size of the memory kept alive by all the registered stores
+    static size_t GetTotalByteLength()
+    {
+        // Atomic with relaxed order reason: the value is used as a heuristic only
+        return totalByteLength_.load(std::memory_order_relaxed);
+    }
+
+    /// Finalizer of a static `ArrayBuffer` wrapper, @param store is the finalizer argument
+    static void FinalizeStatic(void *store);
+
+    /// Finalizer of a JS `ArrayBuffer` wrapper, @param hint is the store
+    static void FinalizeDynamic(napi_env env, void *data, void *hint);
+
+private:
+    SharedBackingStore(void *data, size_t byteLength) : data_(data), byteLength_(byteLength) {}
+    ~SharedBackingStore() = default;
+
+    void *data_;
+    size_t byteLength_;
+    uint32_t refCount_ {1U};  // GUARDED_BY(registry lock)
+
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static std::atomic<size_t> totalByteLength_;
+};
+
+}  // namespace ark::ets::interop::js
+
+#endif  // PANDA_PLUGINS_ETS_RUNTIME_INTEROP_JS_SHARED_BACKING_STORE_H_
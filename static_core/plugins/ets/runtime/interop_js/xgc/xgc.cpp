@@ -19,6 +19,7 @@
 #include "runtime/mem/gc/g1/xgc-extension-data.h"
 #include "plugins/ets/runtime/ets_exceptions.h"
 #include "plugins/ets/runtime/interop_js/interop_context.h"
+#include "plugins/ets/runtime/interop_js/shared_backing_store.h"
 #include "plugins/ets/runtime/interop_js/xgc/xgc.h"
 #include "plugins/ets/runtime/interop_js/ets_proxy/shared_reference_storage_verifier.h"
 #ifdef PANDA_JS_ETS_HYBRID_MODE
@@ -242,6 +243,11 @@ void XGC::GCFinished(const GCTask &task, [[maybe_unused]] size_t heapSizeBeforeG
     // Atomic with relaxed order reason: data race with targetThreasholdSize_ with no synchronization or ordering
     // constraints imposed on other reads or writes
     targetThreasholdSize_.store(newTargetThreshold, std::memory_order_relaxed);
+    auto newSharedBackingThreshold = ComputeNewSharedBackingSize();
+    LOG(DEBUG, GC_TRIGGER) << "XGC's new target threshold shared ArrayBuffer size = " << newSharedBackingThreshold;
+    // Atomic with relaxed order reason: data race with targetSharedBackingSize_ with no synchronization or ordering
+    // constraints imposed on other reads or writes
+    targetSharedBackingSize_.store(newSharedBackingThreshold, std::memory_order_relaxed);
 }
 
 void XGC::GCPhaseStarted(mem::GCPhase phase)
@@ -384,6 +390,14 @@ size_t XGC::ComputeNewSize()
     return std::min(std::max(currentStorageSize + delta, minimalThresholdSize_), storage_->MaxSize());
 }
 
+size_t XGC::ComputeNewSharedBackingSize() const
+{
+    // JS buffers which are dead after XGC are freed by the next JS GC, so the size may still include them
+    size_t currentSize = SharedBackingStore::GetTotalByteLength();
+    size_t delta = (currentSize / PERCENT_100_D) * increaseThresholdPercent_;
+    return std::max(currentSize + delta, MIN_SHARED_BACKING_THRESHOLD_SIZE);
+}
+
 bool XGC::Trigger([[maybe_unused]] mem::GC *gc, [[maybe_unused]] PandaUniquePtr<GCTask> task)
 {
     ASSERT_MANAGED_CODE();
@@ -424,7 +438,10 @@ ALWAYS_INLINE bool XGC::NeedToTriggerXGC([[maybe_unused]] const mem::GC *gc) con
     }
     // Atomic with relaxed order reason: data race with targetThreasholdSize_ with no synchronization or ordering
     // constraints imposed on other reads or writes
-    if (storage_->Size() < targetThreasholdSize_.load(std::memory_order_relaxed)) {
+    if (storage_->Size() < targetThreasholdSize_.load(std::memory_order_relaxed) &&
+        // Atomic with relaxed order reason: data race with targetSharedBackingSize_ with no synchronization or
+        // ordering constraints imposed on other reads or writes
+        SharedBackingStore::GetTotalByteLength() < targetSharedBackingSize_.load(std::memory_order_relaxed)) {
         return false;
     }
 #if defined(PANDA_TARGET_OHOS)
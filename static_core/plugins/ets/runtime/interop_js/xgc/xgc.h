@@ -134,12 +134,17 @@ private:
     XGC(PandaEtsVM *vm, STSVMInterfaceImpl *stsVmIface, ets_proxy::SharedReferenceStorage *storage);
     static XGC *instance_;
 
+    static constexpr size_t MIN_SHARED_BACKING_THRESHOLD_SIZE = 64_MB;
+
     /// @return true if need to trigger XGC by policy and special conditions, false - otherwise
     bool NeedToTriggerXGC(const mem::GC *gc) const;
 
     /// @return new target threshold storage size for XGC trigger
     size_t ComputeNewSize();
 
+    /// @return new target threshold size of shared ArrayBuffer memory for XGC trigger
+    size_t ComputeNewSharedBackingSize() const;
+
     /// Unmark all cross references before initial mark
     void UnmarkAll();
 
@@ -194,6 +199,8 @@ private:
     const size_t increaseThresholdPercent_ {0U};
     // We can load a value of the variable from several threads, so need to use atomic
     std::atomic<size_t> targetThreasholdSize_ {0U};
+    // Shared ArrayBuffer memory is freed only after both heaps collect their buffers, so it is cross-heap pressure too
+    std::atomic<size_t> targetSharedBackingSize_ {MIN_SHARED_BACKING_THRESHOLD_SIZE};
     const TriggerPolicy treiggerPolicy_ {TriggerPolicy::INVALID};
     const bool enableXgcVerifier_ {false};
 };
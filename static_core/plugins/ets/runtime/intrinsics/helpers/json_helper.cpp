@@ -27,6 +27,10 @@
 #include "plugins/ets/runtime/types/ets_object.h"
 #include "intrinsics.h"
 
+#include <cstring>
+#include <limits>
+#include <string_view>
+
 namespace ark::ets::intrinsics::helpers {
 
 bool JSONStringifier::AppendJSONString(EtsHandle<EtsObject> &value, bool hasContent)
@@ -753,4 +757,399 @@ EtsString *JSONStringifier::Stringify(EtsHandle<EtsObject> &value)
     return EtsString::CreateFromUtf8(buffer_.c_str(), buffer_.length());
 }
 
+namespace {
+
+constexpr uint16_t JSON_CONTROL_CHAR_LIMIT = 0x20;
+constexpr uint32_t JSON_UNICODE_ESCAPE_DIGITS = 4U;
+constexpr uint32_t JSON_HEX_DIGIT_BITS = 4U;
+constexpr uint16_t JSON_HEX_LETTER_BASE = 10U;
+
+/**
+ * SWAR ("SIMD within a register") helpers: a 64-bit word holds 8 Latin-1 or 4 UTF-16 characters,
+ * so the plain part of a string is skipped a word at a time without target-specific vector code.
+ */
+template <typename CharT>
+struct SwarWord {
+    static constexpr uint32_t LANES = sizeof(uint64_t) / sizeof(CharT);
+    // Masks with the lowest and the highest bit of every lane set
+    static constexpr uint64_t LOW_BITS = std::numeric_limits<uint64_t>::max() / std::numeric_limits<CharT>::max();
+    static constexpr uint64_t HIGH_BITS = LOW_BITS << (sizeof(CharT) * BITS_PER_BYTE - 1U);
+
+    static uint64_t Load(const CharT *data)
+    {
+        uint64_t word;
+        // memcpy instead of a cast, the data is not aligned to the word size
+        std::memcpy(&word, data, sizeof(word));
+        return word;
+    }
+
+    // Non-zero if some lane is less than n (n must not exceed the highest lane bit)
+    static uint64_t HasLess(uint64_t word, uint64_t n)
+    {
+        return (word - LOW_BITS * n) & ~word & HIGH_BITS;
+    }
+
+    static uint64_t HasEqual(uint64_t word, uint64_t ch)
+    {
+        return HasLess(word ^ (LOW_BITS * ch), 1U);
+    }
+
+    // Whether some character of the word ends the plain run of a string: a quote, a backslash or a control character
+    static bool HasStringSpecial(uint64_t word)
+    {
+        return (HasLess(word, JSON_CONTROL_CHAR_LIMIT) | HasEqual(word, '"') | HasEqual(word, '\\')) != 0;
+    }
+};
+
+bool IsJsonWhitespace(uint16_t ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+bool IsDecDigit(uint16_t ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+bool IsShortEscape(uint16_t ch)
+{
+    switch (ch) {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+            return true;
+        default:
+            return false;
+    }
+}
+
+int32_t HexDigitValue(uint16_t ch)
+{
+    if (IsDecDigit(ch)) {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + JSON_HEX_LETTER_BASE;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + JSON_HEX_LETTER_BASE;
+    }
+    return -1;
+}
+
+template <typename CharT>
+uint32_t SkipWhitespace(const CharT *data, uint32_t length, uint32_t pos)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    while (pos < length && IsJsonWhitespace(data[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+template <typename CharT>
+uint32_t SkipDigits(const CharT *data, uint32_t length, uint32_t pos)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    while (pos < length && IsDecDigit(data[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+template <typename CharT>
+bool MatchLiteral(const CharT *data, uint32_t length, uint32_t pos, std::string_view literal)
+{
+    if (length - pos < literal.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < literal.size(); i++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (data[pos + i] != static_cast<CharT>(literal[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+template <typename CharT>
+bool JSONTapeScanner::ScanString(const CharT *data, uint32_t length, uint32_t *pos)
+{
+    using Swar = SwarWord<CharT>;
+    ASSERT(data[*pos] == '"');
+    uint32_t start = *pos + 1U;
+    uint32_t i = start;
+    bool escaped = false;
+    while (true) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        while (length - i >= Swar::LANES && !Swar::HasStringSpecial(Swar::Load(data + i))) {
+            i += Swar::LANES;
+        }
+        if (i >= length) {
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        uint16_t ch = data[i];
+        if (ch == '"') {
+            break;
+        }
+        if (ch < JSON_CONTROL_CHAR_LIMIT) {
+            return false;
+        }
+        i++;
+        if (ch != '\\') {
+            continue;
+        }
+        escaped = true;
+        if (i >= length) {
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ch = data[i++];
+        if (ch == 'u') {
+            for (uint32_t end = i + JSON_UNICODE_ESCAPE_DIGITS; i < end; i++) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if (i >= length || HexDigitValue(data[i]) < 0) {
+                    return false;
+                }
+            }
+        } else if (!IsShortEscape(ch)) {
+            return false;
+        }
+    }
+    PushToken(escaped ? Token::ESCAPED_STRING : Token::STRING, start, i);
+    *pos = i + 1U;
+    return true;
+}
+
+template <typename CharT>
+bool JSONTapeScanner::ScanNumber(const CharT *data, uint32_t length, uint32_t *pos)
+{
+    uint32_t start = *pos;
+    uint32_t i = start;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (data[i] == '-') {
+        i++;
+    }
+    if (i < length && data[i] == '0') {
+        i++;
+    } else if (i < length && IsDecDigit(data[i])) {
+        i = SkipDigits(data, length, i);
+    } else {
+        return false;
+    }
+    if (i < length && data[i] == '.') {
+        i++;
+        if (i >= length || !IsDecDigit(data[i])) {
+            return false;
+        }
+        i = SkipDigits(data, length, i);
+    }
+    if (i < length && (data[i] == 'e' || data[i] == 'E')) {
+        i++;
+        if (i < length && (data[i] == '+' || data[i] == '-')) {
+            i++;
+        }
+        if (i >= length || !IsDecDigit(data[i])) {
+            return false;
+        }
+        i = SkipDigits(data, length, i);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    PushToken(Token::NUMBER, start, i);
+    *pos = i;
+    return true;
+}
+
+template <typename CharT>
+bool JSONTapeScanner::ScanKey(const CharT *data, uint32_t length, uint32_t *pos)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (*pos >= length || data[*pos] != '"' || !ScanString(data, length, pos)) {
+        return false;
+    }
+    *pos = SkipWhitespace(data, length, *pos);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (*pos >= length || data[*pos] != ':') {
+        return false;
+    }
+    (*pos)++;
+    return true;
+}
+
+template <typename CharT>
+bool JSONTapeScanner::ScanValue(const CharT *data, uint32_t length, uint32_t *pos, bool *opened)
+{
+    *opened = false;
+    if (*pos >= length) {
+        return false;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    switch (data[*pos]) {
+        case '{':
+            PushToken(Token::OBJECT_START);
+            *pos = SkipWhitespace(data, length, *pos + 1U);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (*pos < length && data[*pos] == '}') {
+                PushToken(Token::OBJECT_END);
+                (*pos)++;
+                return true;
+            }
+            containers_.push_back(Token::OBJECT_START);
+            *opened = true;
+            return ScanKey(data, length, pos);
+        case '[':
+            PushToken(Token::ARRAY_START);
+            *pos = SkipWhitespace(data, length, *pos + 1U);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (*pos < length && data[*pos] == ']') {
+                PushToken(Token::ARRAY_END);
+                (*pos)++;
+                return true;
+            }
+            containers_.push_back(Token::ARRAY_START);
+            *opened = true;
+            return true;
+        case '"':
+            return ScanString(data, length, pos);
+        case 't':
+            return ScanLiteral(data, length, pos, "true", Token::TRUE_VALUE);
+        case 'f':
+            return ScanLiteral(data, length, pos, "false", Token::FALSE_VALUE);
+        case 'n':
+            return ScanLiteral(data, length, pos, "null", Token::NUL);
+        default:
+            return ScanNumber(data, length, pos);
+    }
+}
+
+template <typename CharT>
+bool JSONTapeScanner::ScanLiteral(const CharT *data, uint32_t length, uint32_t *pos, std::string_view literal,
+                                  Token token)
+{
+    if (!MatchLiteral(data, length, *pos, literal)) {
+        return false;
+    }
+    PushToken(token);
+    *pos += literal.size();
+    return true;
+}
+
+template <typename CharT>
+bool JSONTapeScanner::ScanText(const CharT *data, uint32_t length)
+{
+    tape_.clear();
+    containers_.clear();
+    uint32_t pos = 0;
+    while (true) {
+        pos = SkipWhitespace(data, length, pos);
+        bool opened = false;
+        if (!ScanValue(data, length, &pos, &opened)) {
+            return false;
+        }
+        if (opened) {
+            continue;
+        }
+        // Close the containers completed by the value, stop at the separator before the next value
+        while (true) {
+            pos = SkipWhitespace(data, length, pos);
+            if (containers_.empty()) {
+                return pos == length;
+            }
+            if (pos >= length) {
+                return false;
+            }
+            bool inObject = containers_.back() == Token::OBJECT_START;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            uint16_t ch = data[pos++];
+            if (ch == ',') {
+                if (inObject) {
+                    pos = SkipWhitespace(data, length, pos);
+                    if (!ScanKey(data, length, &pos)) {
+                        return false;
+                    }
+                }
+                break;
+            }
+            if (ch != (inObject ? '}' : ']')) {
+                return false;
+            }
+            PushToken(inObject ? Token::OBJECT_END : Token::ARRAY_END);
+            containers_.pop_back();
+        }
+    }
+}
+
+bool JSONTapeScanner::Scan(Span<const uint8_t> text)
+{
+    return ScanText(text.data(), text.size());
+}
+
+bool JSONTapeScanner::Scan(Span<const uint16_t> text)
+{
+    return ScanText(text.data(), text.size());
+}
+
+template <typename CharT>
+void JSONTapeScanner::DecodeStringImpl(Span<const CharT> content, PandaVector<uint16_t> *decoded)
+{
+    decoded->clear();
+    decoded->reserve(content.size());
+    for (size_t i = 0; i < content.size(); i++) {
+        uint16_t ch = content[i];
+        if (ch != '\\') {
+            decoded->push_back(ch);
+            continue;
+        }
+        // The content is validated by the scanner, escapes are complete
+        ch = content[++i];
+        switch (ch) {
+            case 'b':
+                decoded->push_back('\b');
+                break;
+            case 'f':
+                decoded->push_back('\f');
+                break;
+            case 'n':
+                decoded->push_back('\n');
+                break;
+            case 'r':
+                decoded->push_back('\r');
+                break;
+            case 't':
+                decoded->push_back('\t');
+                break;
+            case 'u': {
+                uint16_t code = 0;
+                for (uint32_t digit = 0; digit < JSON_UNICODE_ESCAPE_DIGITS; digit++) {
+                    code = static_cast<uint16_t>((code << JSON_HEX_DIGIT_BITS) | HexDigitValue(content[++i]));
+                }
+                decoded->push_back(code);
+                break;
+            }
+            default:
+                // '"', '\\' and '/' stand for themselves
+                decoded->push_back(ch);
+                break;
+        }
+    }
+}
+
+void JSONTapeScanner::DecodeString(Span<const uint8_t> content, PandaVector<uint16_t> *decoded)
+{
+    DecodeStringImpl(content, decoded);
+}
+
+void JSONTapeScanner::DecodeString(Span<const uint16_t> content, PandaVector<uint16_t> *decoded)
+{
+    DecodeStringImpl(content, decoded);
+}
+
 }  // namespace ark::ets::intrinsics::helpers
@@ -18,6 +18,8 @@
 
 #include "types/ets_string.h"
 
+#include <string_view>
+
 namespace ark::ets::intrinsics::helpers {
 class JSONStringifier {
 public:
@@ -103,5 +105,79 @@ private:
     // NOLINTNEXTLINE(modernize-avoid-c-arrays)
     static constexpr char HEX_DIGIT[] = "0123456789abcdef";
 };
+
+/**
+ * Validating JSON scanner used by the native JSON.parse fast path.
+ *
+ * The input is scanned into a tape of tokens which is walked by managed code to build the JSONValue tree,
+ * so the character-level work (structure, string and number validation) is done natively. Token kinds
+ * must be in sync with the JSON_TAPE_* constants in std/core/json.ets. Literals and container brackets
+ * take one slot, strings and numbers take three: the kind and the [start, end) range of the raw text,
+ * string ranges exclude the quotes.
+ *
+ * Only strict RFC 8259 texts are accepted. For anything else the scan fails and the caller falls back to
+ * the managed parser, which reports the error (or accepts the input) exactly as before.
+ */
+class JSONTapeScanner {
+public:
+    enum class Token : int32_t {
+        NUL = 0,
+        TRUE_VALUE = 1,
+        FALSE_VALUE = 2,
+        NUMBER = 3,
+        STRING = 4,
+        ESCAPED_STRING = 5,
+        OBJECT_START = 6,
+        OBJECT_END = 7,
+        ARRAY_START = 8,
+        ARRAY_END = 9,
+    };
+
+    /// @return false if @param text is not a strict JSON text
+    bool Scan(Span<const uint8_t> text);
+    bool Scan(Span<const uint16_t> text);
+
+    const PandaVector<int32_t> &GetTape() const
+    {
+        return tape_;
+    }
+
+    /// Decodes the escape sequences of the string @param content validated by the scan into @param decoded
+    static void DecodeString(Span<const uint8_t> content, PandaVector<uint16_t> *decoded);
+    static void DecodeString(Span<const uint16_t> content, PandaVector<uint16_t> *decoded);
+
+private:
+    template <typename CharT>
+    static void DecodeStringImpl(Span<const CharT> content, PandaVector<uint16_t> *decoded);
+
+    template <typename CharT>
+    bool ScanText(const CharT *data, uint32_t length);
+    template <typename CharT>
+    bool ScanValue(const CharT *data, uint32_t length, uint32_t *pos, bool *opened);
+    template <typename CharT>
+    bool ScanKey(const CharT *data, uint32_t length, uint32_t *pos);
+    template <typename CharT>
+    bool ScanString(const CharT *data, uint32_t length, uint32_t *pos);
+    template <typename CharT>
+    bool ScanNumber(const CharT *data, uint32_t length, uint32_t *pos);
+    template <typename CharT>
+    bool ScanLiteral(const CharT *data, uint32_t length, uint32_t *pos, std::string_view literal, Token token);
+
+    void PushToken(Token token)
+    {
+        tape_.push_back(static_cast<int32_t>(token));
+    }
+
+    void PushToken(Token token, uint32_t start, uint32_t end)
+    {
+        PushToken(token);
+        tape_.push_back(static_cast<int32_t>(start));
+        tape_.push_back(static_cast<int32_t>(end));
+    }
+
+    PandaVector<int32_t> tape_;
+    // Kinds of the open containers, OBJECT_START or ARRAY_START
+    PandaVector<Token> containers_;
+};
 }  // namespace ark::ets::intrinsics::helpers
 #endif  // PANDA_PLUGINS_ETS_RUNTIME_JSON_HELPER
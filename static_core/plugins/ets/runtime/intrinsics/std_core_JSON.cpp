@@ -16,6 +16,7 @@
 #include "intrinsics.h"
 #include "intrinsics/helpers/reflection_helpers.h"
 #include "plugins/ets/runtime/ets_utils.h"
+#include "plugins/ets/runtime/types/ets_array.h"
 #include "plugins/ets/runtime/types/ets_field.h"
 #include "plugins/ets/runtime/types/ets_method.h"
 #include "plugins/ets/runtime/types/ets_object.h"
@@ -26,6 +27,7 @@
 #include "libarkfile/method_data_accessor-inl.h"
 #include "runtime/common_interfaces/objects/string/base_string-inl.h"
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <vector>
@@ -499,6 +501,58 @@ extern "C" EtsString *StdCoreJSONStringifyStringFast(EtsString *str)
     return resultHandle.GetPtr();
 }
 
+// Calls @param visitor with the characters of @param str, a tree string is flattened into a temporary buffer.
+// The visitor must not allocate managed objects, the span points into the managed heap.
+template <typename Visitor>
+static auto VisitStringData(EtsString *str, Visitor visitor)
+{
+    auto readBarrier = [](void *obj, size_t offset) {
+        return reinterpret_cast<ark::mem::BaseString *>(ObjectAccessor::GetObject(obj, offset));
+    };
+    const uint32_t len = str->GetLength();
+    if (str->IsUtf16()) {
+        std::vector<uint16_t> flatBuf;
+        const uint16_t *data = str->IsLineString() ? str->GetDataUtf16()
+                                                   : ark::mem::BaseString::GetUtf16DataFlat(
+                                                         readBarrier, str->GetCoreType()->ToStringConst(), flatBuf);
+        return visitor(Span<const uint16_t>(data, len));
+    }
+    std::vector<uint8_t> flatBuf;
+    const uint8_t *data = str->IsLineString() ? str->GetDataMUtf8()
+                                              : ark::mem::BaseString::GetUtf8DataFlat(
+                                                    readBarrier, str->GetCoreType()->ToStringConst(), flatBuf);
+    return visitor(Span<const uint8_t>(data, len));
+}
+
+extern "C" EtsIntArray *StdCoreJSONScanTapeFast(EtsString *source)
+{
+    ASSERT(EtsExecutionContext::GetCurrent()->GetMT()->HasPendingException() == false);
+
+    helpers::JSONTapeScanner scanner;
+    bool scanned = VisitStringData(source, [&scanner](auto text) { return scanner.Scan(text); });
+    // An empty tape makes the caller fall back to the managed parser
+    const auto &tape = scanner.GetTape();
+    auto *result = EtsIntArray::Create(scanned ? tape.size() : 0U);
+    if (UNLIKELY(result == nullptr) || !scanned) {
+        return result;
+    }
+    std::copy(tape.begin(), tape.end(), result->GetData<EtsInt>());
+    return result;
+}
+
+extern "C" EtsString *StdCoreJSONDecodeStringFast(EtsString *source, EtsInt start, EtsInt end)
+{
+    ASSERT(EtsExecutionContext::GetCurrent()->GetMT()->HasPendingException() == false);
+    ASSERT(start >= 0 && start <= end && static_cast<uint32_t>(end) <= source->GetLength());
+
+    PandaVector<uint16_t> decoded;
+    VisitStringData(source, [&decoded, start, end](auto text) {
+        helpers::JSONTapeScanner::DecodeString(text.SubSpan(start, end - start), &decoded);
+        return true;
+    });
+    return EtsString::CreateFromUtf16(decoded.data(), decoded.size());
+}
+
 extern "C" EtsString *StdCoreJSONStringifyFast(EtsObject *value)
 {
     auto executionCtx = EtsExecutionContext::GetCurrent();
@@ -308,6 +308,9 @@ bool HeapDumpCoordinator::ExecuteDumpWithFork(const DumpRequest &request, DumpPa
         if (participants.dynamicDumper != nullptr) {
             participants.dynamicDumper->PrepareForkChild();
         }
+        if (participants.staticDumper != nullptr) {
+            participants.staticDumper->PrepareForkChild();
+        }
         // The dump must use the inherited VM snapshot and therefore cannot
         // exec. Keep all participant work on the thread that called fork;
         // creating worker threads here can enter copied synchronization state
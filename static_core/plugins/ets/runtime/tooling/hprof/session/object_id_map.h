@@ -18,6 +18,7 @@
 
 #include "plugins/ets/runtime/tooling/hprof/session/dump_format.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <unordered_map>
@@ -174,6 +175,36 @@ public:
         }
     }
 
+    /**
+     * @brief Number of hash buckets of the underlying map.
+     *
+     * Buckets partition the entries, so disjoint bucket ranges passed to
+     * ForEachLiveInBuckets() can be iterated concurrently after Freeze().
+     */
+    size_t BucketCount() const
+    {
+        return seen_.bucket_count();
+    }
+
+    /**
+     * @brief Iterate live entries of the buckets [beginBucket, endBucket): callback(addr, nodeId).
+     *
+     * Read-only - safe after Freeze(), including concurrent calls for disjoint
+     * or overlapping ranges.
+     */
+    template <class F>
+    void ForEachLiveInBuckets(size_t beginBucket, size_t endBucket, F &&callback) const
+    {
+        endBucket = std::min(endBucket, seen_.bucket_count());
+        for (size_t bucket = beginBucket; bucket < endBucket; ++bucket) {
+            for (auto it = seen_.begin(bucket); it != seen_.end(bucket); ++it) {
+                if (it->second.live) {
+                    callback(it->first, it->second.nodeId);
+                }
+            }
+        }
+    }
+
     /// @brief Number of live entries (== Count() after PruneDead).
     size_t CountLive() const;
 
@@ -15,11 +15,18 @@
 
 #include "plugins/ets/runtime/tooling/hprof/static_dump.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <limits>
 #include <new>
 #include <string_view>
+#include <thread>
 #include <vector>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
 
 #if defined(ENABLE_DUMP_IN_FAULTLOG)
 #include "faultloggerd_client.h"
@@ -36,6 +43,7 @@
 #include "runtime/include/managed_thread.h"
 #include "runtime/include/language_config.h"
 #include "runtime/mem/heap_manager.h"
+#include "runtime/mem/gc/gc.h"
 #include "runtime/mem/gc/gc_root.h"
 #include "runtime/mem/rendezvous.h"
 #include "runtime/tooling/hprof/heap_dump.h"
@@ -53,6 +61,23 @@
 namespace ark::tooling::hprof {
 namespace {
 
+int64_t GetPeakRssKb()
+{
+#if defined(__linux__)
+    rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return static_cast<int64_t>(usage.ru_maxrss);
+    }
+#endif
+    return 0;
+}
+
+uint64_t ElapsedUs(std::chrono::steady_clock::time_point start)
+{
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
 using ReferenceVisitor = std::function<void(ark::ObjectHeader *, bool)>;
 
 bool IsWeakReferentField(ark::ObjectHeader *object, const ark::Field &field)
@@ -170,6 +195,10 @@ StaticDump::StaticDump(ark::PandaVM *pandaVm, StringIdPool *stringPool, ObjectId
       identity_(request.identity),
       outputPath_(request.output.staticPath)
 {
+    if (pandaVm_ != nullptr && pandaVm_->GetGC() != nullptr) {
+        // The world is stopped for the whole dump, so the GC workers budget is free to use
+        dumpThreads_ = pandaVm_->GetGC()->GetSettings()->GCWorkersCount() + 1U;
+    }
 }
 
 StaticDump::~StaticDump()
@@ -458,43 +487,89 @@ bool StaticDump::DumpInstance()
     // Iterate the live (root-reachable) set captured during Prepare's BFS.
     // After PrepareRound -> BFS -> PruneDead, ObjectIdMap holds exactly the
     // reachable objects, so no second full-heap walk is needed.
-    //
+    size_t bucketCount = objectIdMap_->BucketCount();
+    size_t threadsCount = std::min(dumpThreads_, (bucketCount + dumpChunkBuckets_ - 1U) / dumpChunkBuckets_);
+    if (threadsCount <= 1U) {
+        DumpInstanceRange(writer_, 0, bucketCount);
+    } else {
+        DumpInstanceParallel(threadsCount);
+    }
+    return true;
+}
+
+void StaticDump::DumpInstanceParallel(size_t threadsCount)
+{
+    ASSERT(threadsCount > 1U);
+    size_t bucketCount = objectIdMap_->BucketCount();
+    std::atomic<size_t> nextBucket {0};
+    size_t chunkBuckets = dumpChunkBuckets_;
+    auto dumpChunks = [this, &nextBucket, bucketCount, chunkBuckets](StaticWriter *writer) {
+        while (true) {
+            // Atomic with relaxed order reason: only the chunk index is shared, the dumped state is frozen
+            size_t beginBucket = nextBucket.fetch_add(chunkBuckets, std::memory_order_relaxed);
+            if (beginBucket >= bucketCount) {
+                return;
+            }
+            DumpInstanceRange(writer, beginBucket, std::min(beginBucket + chunkBuckets, bucketCount));
+        }
+    };
+    // Each thread batches its items in its own writer, so the shared stream
+    // is locked once per flushed record rather than per item.
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1U);
+    for (size_t i = 1U; i < threadsCount; ++i) {
+        workers.emplace_back([this, &dumpChunks]() {
+            StaticWriter writer(staticStream_);
+            dumpChunks(&writer);
+        });
+    }
+    dumpChunks(writer_);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void StaticDump::DumpInstanceRange(StaticWriter *writer, size_t beginBucket, size_t endBucket)
+{
+    auto forEachLiveObject = [this, beginBucket, endBucket](const auto &visitor) {
+        objectIdMap_->ForEachLiveInBuckets(beginBucket, endBucket,
+                                           [&visitor](uintptr_t addr, [[maybe_unused]] uint32_t nodeId) {
+                                               auto *obj = reinterpret_cast<ark::ObjectHeader *>(addr);
+                                               auto *cls = obj->ClassAddr<ark::Class>();
+                                               if (cls != nullptr) {
+                                                   visitor(obj, cls);
+                                               }
+                                           });
+    };
+
     // INSTANCE_DUMP - all normal (non-array, non-string) instances in one batch
-    writer_->BeginRecord(TAG_STATIC_INSTANCE_DUMP);
-    objectIdMap_->ForEachLive([this](uintptr_t addr, [[maybe_unused]] uint32_t nodeId) {
-        auto *obj = reinterpret_cast<ark::ObjectHeader *>(addr);
-        auto *cls = obj->ClassAddr<ark::Class>();
-        if (cls != nullptr && !cls->IsArrayClass() && !cls->IsStringClass()) {
-            WriteNormalInstance(obj, cls);
+    writer->BeginRecord(TAG_STATIC_INSTANCE_DUMP);
+    forEachLiveObject([this, writer](ark::ObjectHeader *obj, ark::Class *cls) {
+        if (!cls->IsArrayClass() && !cls->IsStringClass()) {
+            WriteNormalInstance(writer, obj, cls);
         }
     });
-    writer_->EndRecord();
+    writer->EndRecord();
 
     // STRING_DUMP - string objects carry their UTF-8 content so the translator
     // can name each node by its value. Excluded from INSTANCE_DUMP above so the
     // string's raw character buffer (not a named instance field) is not lost.
-    writer_->BeginRecord(TAG_STATIC_STRING_DUMP);
-    objectIdMap_->ForEachLive([this](uintptr_t addr, [[maybe_unused]] uint32_t nodeId) {
-        auto *obj = reinterpret_cast<ark::ObjectHeader *>(addr);
-        auto *cls = obj->ClassAddr<ark::Class>();
-        if (cls != nullptr && cls->IsStringClass()) {
-            WriteStringInstance(obj, cls);
+    writer->BeginRecord(TAG_STATIC_STRING_DUMP);
+    forEachLiveObject([this, writer](ark::ObjectHeader *obj, ark::Class *cls) {
+        if (cls->IsStringClass()) {
+            WriteStringInstance(writer, obj, cls);
         }
     });
-    writer_->EndRecord();
+    writer->EndRecord();
 
     // ARRAY_DUMP - all array instances in a separate batch
-    writer_->BeginRecord(TAG_STATIC_ARRAY_DUMP);
-    objectIdMap_->ForEachLive([this](uintptr_t addr, [[maybe_unused]] uint32_t nodeId) {
-        auto *obj = reinterpret_cast<ark::ObjectHeader *>(addr);
-        auto *cls = obj->ClassAddr<ark::Class>();
-        if (cls != nullptr && cls->IsArrayClass()) {
-            WriteArrayInstance(obj, cls);
+    writer->BeginRecord(TAG_STATIC_ARRAY_DUMP);
+    forEachLiveObject([this, writer](ark::ObjectHeader *obj, ark::Class *cls) {
+        if (cls->IsArrayClass()) {
+            WriteArrayInstance(writer, obj, cls);
         }
     });
-    writer_->EndRecord();
-
-    return true;
+    writer->EndRecord();
 }
 
 // ============================================================================
@@ -732,7 +807,7 @@ ark::PandaVector<uint32_t> StaticDump::ComputeMethodData(ark::Class *cls)
 // Per-object write helpers (called from DumpInstance ForEachLive callbacks)
 // ============================================================================
 
-void StaticDump::WriteNormalInstance(ark::ObjectHeader *obj, ark::Class *cls)
+void StaticDump::WriteNormalInstance(StaticWriter *writer, ark::ObjectHeader *obj, ark::Class *cls)
 {
     auto [objectId, classObjectId] = GetInstanceIds(obj, cls);
     // Emit values for own + inherited instance fields (CollectInstanceFieldsChain
@@ -750,10 +825,10 @@ void StaticDump::WriteNormalInstance(ark::ObjectHeader *obj, ark::Class *cls)
     }
 
     auto objectSize = static_cast<uint32_t>(HeapDump::GetObjectSize(obj));
-    writer_->WriteInstanceDumpItem(objectId, classObjectId, objectSize, fieldValues.data(), fieldCount);
+    writer->WriteInstanceDumpItem(objectId, classObjectId, objectSize, fieldValues.data(), fieldCount);
 }
 
-void StaticDump::WriteStringInstance(ark::ObjectHeader *obj, ark::Class *cls)
+void StaticDump::WriteStringInstance(StaticWriter *writer, ark::ObjectHeader *obj, ark::Class *cls)
 {
     auto [objectId, classObjectId] = GetInstanceIds(obj, cls);
     auto *strObject = ark::coretypes::String::Cast(obj);
@@ -769,11 +844,11 @@ void StaticDump::WriteStringInstance(ark::ObjectHeader *obj, ark::Class *cls)
         }
     }
     auto objectSize = static_cast<uint32_t>(HeapDump::GetObjectSize(obj));
-    writer_->WriteStringDumpItem(objectId, classObjectId, objectSize, reinterpret_cast<const uint8_t *>(content.data()),
-                                 static_cast<uint32_t>(content.size()));
+    writer->WriteStringDumpItem(objectId, classObjectId, objectSize, reinterpret_cast<const uint8_t *>(content.data()),
+                                static_cast<uint32_t>(content.size()));
 }
 
-void StaticDump::WriteArrayInstance(ark::ObjectHeader *obj, ark::Class *cls)
+void StaticDump::WriteArrayInstance(StaticWriter *writer, ark::ObjectHeader *obj, ark::Class *cls)
 {
     auto [objectId, classObjectId] = GetInstanceIds(obj, cls);
     auto *arr = reinterpret_cast<const ark::coretypes::Array *>(obj);
@@ -783,7 +858,7 @@ void StaticDump::WriteArrayInstance(ark::ObjectHeader *obj, ark::Class *cls)
     auto objectSize = static_cast<uint32_t>(HeapDump::GetObjectSize(obj));
 
     if (arrayLength == 0) {
-        WriteEmptyArrayInstance(objectId, classObjectId, objectSize, elementType);
+        WriteEmptyArrayInstance(writer, objectId, classObjectId, objectSize, elementType);
         return;
     }
 
@@ -794,12 +869,12 @@ void StaticDump::WriteArrayInstance(ark::ObjectHeader *obj, ark::Class *cls)
     }
 
     if (elementType == FieldType::OBJECT || elementType == FieldType::ARRAY) {
-        WriteReferenceArrayInstance(arr, objectId, classObjectId, objectSize, arrayLength, elementType);
+        WriteReferenceArrayInstance(writer, arr, objectId, classObjectId, objectSize, arrayLength, elementType);
         return;
     }
 
     if (elementType == FieldType::TAGGED) {
-        WriteTaggedArrayInstance(arr, objectId, classObjectId, objectSize, arrayLength);
+        WriteTaggedArrayInstance(writer, arr, objectId, classObjectId, objectSize, arrayLength);
         return;
     }
 
@@ -809,23 +884,23 @@ void StaticDump::WriteArrayInstance(ark::ObjectHeader *obj, ark::Class *cls)
         return;
     }
     uint32_t arrayDataSize = arrayLength * elementSize;
-    writer_->WriteArrayDumpItem(objectId, classObjectId, objectSize, arrayLength, static_cast<uint8_t>(elementType),
-                                dataPtr, arrayDataSize);
+    writer->WriteArrayDumpItem(objectId, classObjectId, objectSize, arrayLength, static_cast<uint8_t>(elementType),
+                               dataPtr, arrayDataSize);
 }
 
-void StaticDump::WriteEmptyArrayInstance(uint32_t objectId, uint32_t classObjectId, uint32_t objectSize,
-                                         FieldType elementType)
+void StaticDump::WriteEmptyArrayInstance(StaticWriter *writer, uint32_t objectId, uint32_t classObjectId,
+                                         uint32_t objectSize, FieldType elementType)
 {
     if (elementType == FieldType::TAGGED) {
-        writer_->WriteTaggedArrayDumpItem(objectId, classObjectId, objectSize, nullptr, 0);
+        writer->WriteTaggedArrayDumpItem(objectId, classObjectId, objectSize, nullptr, 0);
         return;
     }
-    writer_->WriteArrayDumpItem(objectId, classObjectId, objectSize, 0, static_cast<uint8_t>(elementType), nullptr, 0);
+    writer->WriteArrayDumpItem(objectId, classObjectId, objectSize, 0, static_cast<uint8_t>(elementType), nullptr, 0);
 }
 
-void StaticDump::WriteReferenceArrayInstance(const ark::coretypes::Array *array, uint32_t objectId,
-                                             uint32_t classObjectId, uint32_t objectSize, uint32_t arrayLength,
-                                             FieldType elementType)
+void StaticDump::WriteReferenceArrayInstance(StaticWriter *writer, const ark::coretypes::Array *array,
+                                             uint32_t objectId, uint32_t classObjectId, uint32_t objectSize,
+                                             uint32_t arrayLength, FieldType elementType)
 {
     ark::PandaVector<uint32_t> nodeIds;
     nodeIds.reserve(arrayLength);
@@ -834,12 +909,13 @@ void StaticDump::WriteReferenceArrayInstance(const ark::coretypes::Array *array,
         auto nodeId = object == nullptr ? 0U : objectIdMap_->Find(reinterpret_cast<uintptr_t>(object));
         nodeIds.push_back(nodeId);
     }
-    writer_->WriteArrayDumpItem(objectId, classObjectId, objectSize, arrayLength, static_cast<uint8_t>(elementType),
-                                reinterpret_cast<const uint8_t *>(nodeIds.data()), nodeIds.size() * sizeof(uint32_t));
+    writer->WriteArrayDumpItem(objectId, classObjectId, objectSize, arrayLength, static_cast<uint8_t>(elementType),
+                               reinterpret_cast<const uint8_t *>(nodeIds.data()), nodeIds.size() * sizeof(uint32_t));
 }
 
-void StaticDump::WriteTaggedArrayInstance(const ark::coretypes::Array *array, uint32_t objectId, uint32_t classObjectId,
-                                          uint32_t objectSize, uint32_t arrayLength)
+void StaticDump::WriteTaggedArrayInstance(StaticWriter *writer, const ark::coretypes::Array *array,
+                                          uint32_t objectId, uint32_t classObjectId, uint32_t objectSize,
+                                          uint32_t arrayLength)
 {
     ark::PandaVector<FieldValueData> elements;
     elements.reserve(arrayLength);
@@ -847,7 +923,7 @@ void StaticDump::WriteTaggedArrayInstance(const ark::coretypes::Array *array, ui
         auto rawValue = array->Get<ark::coretypes::TaggedType, false, true>(index);
         elements.push_back(EncodeTaggedValue(ark::coretypes::TaggedValue(rawValue)));
     }
-    writer_->WriteTaggedArrayDumpItem(objectId, classObjectId, objectSize, elements.data(), arrayLength);
+    writer->WriteTaggedArrayDumpItem(objectId, classObjectId, objectSize, elements.data(), arrayLength);
 }
 
 // ============================================================================
@@ -886,7 +962,8 @@ void StaticDump::TriggerGC()
 
 class StaticDump::RuntimeStateScope final {
 public:
-    explicit RuntimeStateScope(ark::PandaVM *pandaVm) : ownerPid_(getpid())
+    explicit RuntimeStateScope(ark::PandaVM *pandaVm)
+        : ownerPid_(getpid()), pauseStart_(std::chrono::steady_clock::now())
     {
         auto *thread = ark::ManagedThread::GetCurrent();
         ASSERT(thread != nullptr);
@@ -912,6 +989,7 @@ public:
             return;
         }
         suspendScope_.reset();
+        LOG(INFO, RUNTIME) << "[HybDump][Sta] Runtime resumed: pause=" << ElapsedUs(pauseStart_) << "us";
         if (enteredManagedCode_) {
             auto *thread = ark::ManagedThread::GetCurrent();
             ASSERT(thread != nullptr);
@@ -924,6 +1002,7 @@ public:
 
 private:
     pid_t ownerPid_;
+    std::chrono::steady_clock::time_point pauseStart_;
     bool enteredManagedCode_ {false};
     std::unique_ptr<ark::ScopedSuspendAllThreadsRunning> suspendScope_;
 };
@@ -1001,10 +1080,16 @@ bool StaticDump::CreateOutputWriter()
 
 DumpResult StaticDump::Dump()
 {
+    dumpCost_ = DumpCost {};
+    dumpCost_.threads = dumpThreads_;
+    int64_t peakRssBefore = GetPeakRssKb();
+    auto prepareStart = std::chrono::steady_clock::now();
     DumpStatistics statistics = Prepare();
+    dumpCost_.prepareTimeUs = ElapsedUs(prepareStart);
     if (!AcquireOutput() || !CreateOutputWriter()) {
         return {statistics, false};
     }
+    auto writeStart = std::chrono::steady_clock::now();
 
     stringPool_->Freeze();
     objectIdMap_->Freeze();
@@ -1015,6 +1100,11 @@ DumpResult StaticDump::Dump()
     }
     bool executeSuccess = Execute();
     bool finalizeSuccess = Finalize();
+    dumpCost_.writeTimeUs = ElapsedUs(writeStart);
+    dumpCost_.peakRssDeltaKb = GetPeakRssKb() - peakRssBefore;
+    LOG(INFO, RUNTIME) << "[HybDump][Sta] Dump cost: prepare=" << dumpCost_.prepareTimeUs
+                       << "us, write=" << dumpCost_.writeTimeUs << "us, peak_rss_delta=" << dumpCost_.peakRssDeltaKb
+                       << "KB, threads=" << dumpCost_.threads;
     return {statistics, executeSuccess && finalizeSuccess};
 }
 
@@ -70,6 +70,22 @@ class StaticDump : public AbstractDumper {
 public:
     using RootCallback = std::function<void(ark::ObjectHeader *)>;
 
+    /**
+     * @brief Live set part claimed by a dump thread at once. Objects are hashed
+     * over the ObjectIdMap buckets, so chunks are of similar size and the
+     * threads stay balanced.
+     */
+    static constexpr size_t DEFAULT_DUMP_CHUNK_BUCKETS = 1024U;
+
+    /// @brief Cost of the last Dump(), logged after the dump to compare the serial and parallel modes.
+    struct DumpCost {
+        uint64_t prepareTimeUs = 0;
+        uint64_t writeTimeUs = 0;
+        // Growth of the process peak RSS during Dump(), i.e. the transient memory of the dumper
+        int64_t peakRssDeltaKb = 0;
+        size_t threads = 1;
+    };
+
     StaticDump(ark::PandaVM *pandaVm, StringIdPool *stringPool, ObjectIdMap *objectIdMap, const DumpRequest &request);
 
     ~StaticDump() override;
@@ -89,6 +105,17 @@ public:
     }
     DumpResult Dump() override;
 
+    /// @brief Heap records are written on this thread only, the copied runtime has no other threads after fork.
+    void PrepareForkChild() override
+    {
+        dumpThreads_ = 1;
+    }
+
+    const DumpCost &GetDumpCost() const
+    {
+        return dumpCost_;
+    }
+
     /**
      * @brief Return the OutputStream owned by StaticDump.
      * Used by HeapDumpCoordinator for CommonWriter operations.
@@ -267,29 +294,45 @@ private:
      */
     ark::PandaVector<uint32_t> ComputeMethodData(ark::Class *cls);
 
-    // -- Per-object write helpers (called from DumpInstance WalkHeap callbacks) --
+    /**
+     * @brief Write INSTANCE_DUMP, STRING_DUMP and ARRAY_DUMP records for the
+     * live objects of the ObjectIdMap buckets [beginBucket, endBucket).
+     *
+     * Only reads the frozen shared state, so disjoint ranges may be dumped
+     * concurrently, each with its own writer over the shared OutputStream.
+     * Every flushed record is complete, so records of different writers may
+     * interleave in the stream.
+     */
+    void DumpInstanceRange(StaticWriter *writer, size_t beginBucket, size_t endBucket);
+
+    /// @brief Split the live set in bucket chunks dumped by @param threadsCount threads including this one.
+    void DumpInstanceParallel(size_t threadsCount);
+
+    // -- Per-object write helpers (called from DumpInstanceRange callbacks) --
 
     /// @brief Write one INSTANCE_DUMP item for a non-array object.
-    void WriteNormalInstance(ark::ObjectHeader *obj, ark::Class *cls);
+    void WriteNormalInstance(StaticWriter *writer, ark::ObjectHeader *obj, ark::Class *cls);
 
     /**
      * @brief Write one STATIC_STRING_DUMP item for a string object, embedding
      * the UTF-8 content so the translator can name the node by its value.
      */
-    void WriteStringInstance(ark::ObjectHeader *obj, ark::Class *cls);
+    void WriteStringInstance(StaticWriter *writer, ark::ObjectHeader *obj, ark::Class *cls);
 
     /**
      * @brief Write one ARRAY_DUMP item for an array object.
      * Handles element type resolution, zero-length arrays, overflow guard,
      * null data check, and 32-bit managed pointer expansion.
      */
-    void WriteArrayInstance(ark::ObjectHeader *obj, ark::Class *cls);
+    void WriteArrayInstance(StaticWriter *writer, ark::ObjectHeader *obj, ark::Class *cls);
 
-    void WriteEmptyArrayInstance(uint32_t objectId, uint32_t classObjectId, uint32_t objectSize, FieldType elementType);
-    void WriteReferenceArrayInstance(const ark::coretypes::Array *array, uint32_t objectId, uint32_t classObjectId,
-                                     uint32_t objectSize, uint32_t arrayLength, FieldType elementType);
-    void WriteTaggedArrayInstance(const ark::coretypes::Array *array, uint32_t objectId, uint32_t classObjectId,
-                                  uint32_t objectSize, uint32_t arrayLength);
+    void WriteEmptyArrayInstance(StaticWriter *writer, uint32_t objectId, uint32_t classObjectId, uint32_t objectSize,
+                                 FieldType elementType);
+    void WriteReferenceArrayInstance(StaticWriter *writer, const ark::coretypes::Array *array, uint32_t objectId,
+                                     uint32_t classObjectId, uint32_t objectSize, uint32_t arrayLength,
+                                     FieldType elementType);
+    void WriteTaggedArrayInstance(StaticWriter *writer, const ark::coretypes::Array *array, uint32_t objectId,
+                                  uint32_t classObjectId, uint32_t objectSize, uint32_t arrayLength);
 
     // -- Helpers --
 
@@ -331,6 +374,10 @@ private:
     std::string outputPath_;
     std::unique_ptr<RuntimeStateScope> runtimeStateScope_;
     uint32_t classSerialNumber_ = 0;
+    // Threads writing the heap records: this one plus the GC workers count of the VM
+    size_t dumpThreads_ = 1;
+    size_t dumpChunkBuckets_ = DEFAULT_DUMP_CHUNK_BUCKETS;
+    DumpCost dumpCost_ {};
     // Unique classes collected during Prepare - reused by DumpClass to avoid a redundant WalkHeap
     // traversal. Maps Class* -> representative ObjectHeader*.
     ark::PandaUnorderedMap<ark::Class *, ark::ObjectHeader *> uniqueClasses_;
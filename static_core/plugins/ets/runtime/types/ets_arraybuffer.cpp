@@ -18,6 +18,7 @@
 #include "plugins/ets/runtime/ets_platform_types.h"
 #include "plugins/ets/runtime/types/ets_array.h"
 #include "plugins/ets/runtime/types/ets_arraybuffer.h"
+#include "plugins/ets/runtime/types/ets_finalizable_weak_ref.h"
 #include "plugins/ets/runtime/types/ets_primitives.h"
 #include "runtime/arch/memory_helpers.h"
 
@@ -69,6 +70,36 @@ EtsStdCoreArrayBuffer *EtsStdCoreArrayBuffer::CreateNonMovable(EtsExecutionConte
     return handle.GetPtr();
 }
 
+/*static*/
+EtsStdCoreArrayBuffer *EtsStdCoreArrayBuffer::CreateFinalizable(EtsExecutionContext *executionCtx, void *data,
+                                                                size_t length, void (*finalizer)(void *),
+                                                                void *finalizerArg)
+{
+    ASSERT_MANAGED_CODE();
+    ASSERT(!executionCtx->GetMT()->HasPendingException());
+    ASSERT(data != nullptr);
+
+    [[maybe_unused]] EtsHandleScope scope(executionCtx);
+    auto *cls = PlatformTypes(executionCtx)->coreArrayBuffer;
+    EtsHandle<EtsObject> handle(executionCtx, EtsObject::Create(cls));
+    if (UNLIKELY(handle.GetPtr() == nullptr)) {
+        ASSERT(executionCtx->GetMT()->HasPendingException());
+        return nullptr;
+    }
+    auto *weakRef =
+        executionCtx->GetPandaVM()->RegisterFinalizerForObject(executionCtx, handle, finalizer, finalizerArg);
+    auto *self = FromEtsObject(handle.GetPtr());
+    ObjectAccessor::SetObject(executionCtx->GetMT(), self, GetManagedDataOffset(), nullptr);
+    ObjectAccessor::SetObject(executionCtx->GetMT(), self, GetWeakRefOffset(), weakRef->GetCoreType());
+    ObjectAccessor::SetPrimitive(self, GetNativeDataOffset(), reinterpret_cast<EtsLong>(data));
+    ObjectAccessor::SetPrimitive(self, GetByteLengthOffset(), static_cast<decltype(byteLength_)>(length));
+    ObjectAccessor::SetPrimitive(self, GetIsResizableOffset(), ToEtsBoolean(false));
+
+    // Same as in `Initialize`, the fields must be visible before the buffer is published
+    arch::FullMemoryBarrier();
+    return self;
+}
+
 /*static*/
 bool EtsStdCoreArrayBuffer::IsNonMovableArray(EtsExecutionContext *executionCtx, EtsStdCoreArrayBuffer *self)
 {
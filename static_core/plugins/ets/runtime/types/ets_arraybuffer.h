@@ -76,6 +76,13 @@ public:
     /// Creates ArrayBuffer with managed buffer.
     static EtsStdCoreArrayBuffer *Create(EtsExecutionContext *executionCtx, size_t length);
     static EtsStdCoreArrayBuffer *CreateNonMovable(EtsExecutionContext *executionCtx, size_t length, void **resultData);
+    /**
+     * Creates ArrayBuffer over external @param data, @param finalizer is called with @param finalizerArg
+     * when the buffer is collected.
+     * NOTE: behavior of this method must repeat ArkTS `createFinalizable` constructor.
+     */
+    static EtsStdCoreArrayBuffer *CreateFinalizable(EtsExecutionContext *executionCtx, void *data, size_t length,
+                                                    void (*finalizer)(void *), void *finalizerArg);
 
     static bool IsNonMovableArray(EtsExecutionContext *executionCtx, EtsStdCoreArrayBuffer *self);
     static bool IsNativeArray(EtsStdCoreArrayBuffer *self);
@@ -142,6 +149,11 @@ public:
         return MEMBER_OFFSET(EtsStdCoreArrayBuffer, managedData_);
     }
 
+    static constexpr size_t GetWeakRefOffset()
+    {
+        return MEMBER_OFFSET(EtsStdCoreArrayBuffer, weakRef_);
+    }
+
     static constexpr size_t GetIsResizableOffset()
     {
         return MEMBER_OFFSET(EtsStdCoreArrayBuffer, isResizable_);
@@ -18,6 +18,7 @@
 
 #include "plugins/ets/stdlib/native/core/regexp/regexp_group_meta.h"
 #include "plugins/ets/stdlib/native/core/regexp/regexp_exec_result.h"
+#include "plugins/ets/stdlib/native/core/regexp/regexp_pattern_cache.h"
 
 #include <cstdint>
 
@@ -45,6 +46,8 @@ public:
                           int32_t &endIndex);
     static void ExtractGroups(Pcre2Obj expression, int count, RegExpExecResult &result, void *data);
     static void FreePcre2Object(Pcre2Obj re);
+    // Statistics of the calling thread's compiled pattern cache used by CompileAndTest
+    static RegExpPatternCacheStats GetPatternCacheStats();
     static bool HasCapturingGroups(Pcre2Obj re);
     static void ApplyGroupMeta(const PatternGroupMeta &groupMeta, RegExpExecResult &result);
     static void SanitizeGroupCaptureResults(const std::vector<bool> &countableGroups,
@@ -15,6 +15,7 @@
 
 #include "regexp_8.h"
 #include "regexp_common.h"
+#include "regexp_pattern_cache.h"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define PCRE2_CODE_UNIT_WIDTH 8
@@ -122,6 +123,62 @@ MatchDataHandle8 AcquireTestMatchData8()
     return {&tlsMdata, pcre2_match_data_create(1U, nullptr), false};
 }
 
+using PatternCache8 = RegExpPatternCache<uint8_t, pcre2_code, pcre2_code_free>;
+
+PatternCache8 &GetTlsPatternCache8()
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local PatternCache8 sCache;
+    return sCache;
+}
+
+bool IsJitSupported8()
+{
+    static const bool JIT_SUPPORTED = [] {
+        uint32_t jit = 0U;
+        return pcre2_config(PCRE2_CONFIG_JIT, &jit) >= 0 && jit != 0U;
+    }();
+    return JIT_SUPPORTED;
+}
+
+// JIT is requested only for patterns that turned out to be hot, since it is considerably slower than compilation
+void TryJitCompile8(PatternCache8 &cache, PatternCache8::Entry &entry)
+{
+    if (!cache.ShouldJitCompile(entry)) {
+        return;
+    }
+    if (!IsJitSupported8()) {
+        cache.RecordJitResult(entry, false);
+        return;
+    }
+    cache.RecordJitResult(entry, pcre2_jit_compile(entry.code, PCRE2_JIT_COMPLETE) == 0);
+}
+
+pcre2_code *GetOrCompileCode8(const RegExp8CompileAndTestData &data)
+{
+    auto &cache = GetTlsPatternCache8();
+    auto patternLen = static_cast<size_t>(data.patternLen);
+    auto *entry = cache.Find(data.pattern, patternLen, data.compileFlags, data.extraFlags);
+    if (entry != nullptr) {
+        TryJitCompile8(cache, *entry);
+        return entry->code;
+    }
+
+    auto *compileContext = GetOrCreateCompileCtx8();
+    if (compileContext == nullptr) {
+        return nullptr;
+    }
+    int errorNumber;
+    PCRE2_SIZE errorOffset;
+    pcre2_set_compile_extra_options(compileContext, data.extraFlags | EXTRA_FLAGS_MASK);
+    auto *code = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(data.pattern), data.patternLen, data.compileFlags,
+                               &errorNumber, &errorOffset, compileContext);
+    if (code == nullptr) {
+        return nullptr;
+    }
+    return cache.Insert(data.pattern, patternLen, data.compileFlags, data.extraFlags, code)->code;
+}
+
 }  // namespace
 
 constexpr int PCRE2_MATCH_DATA_UNIT_WIDTH = 2;
@@ -151,21 +208,12 @@ Pcre2Obj RegExp8::CreatePcre2Object(const uint8_t *pattern, uint32_t flags, uint
 // CC-OFFNXT(G.FUN.01, huge_method) solid logic
 bool RegExp8::CompileAndTest(const RegExp8CompileAndTestData &data, int32_t &endIndex)
 {
-    int errorNumber;
-    PCRE2_SIZE errorOffset;
-    auto *compileContext = GetOrCreateCompileCtx8();
-    if (compileContext == nullptr) {
-        return false;
-    }
-    pcre2_set_compile_extra_options(compileContext, data.extraFlags | EXTRA_FLAGS_MASK);
-    auto *code = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(data.pattern), data.patternLen, data.compileFlags,
-                               &errorNumber, &errorOffset, compileContext);
+    // Compiled code is owned by the thread local pattern cache
+    auto *code = GetOrCompileCode8(data);
     if (code == nullptr) {
         return false;
     }
 
-    std::unique_ptr<pcre2_code, decltype(&pcre2_code_free)> codeGuard(code, &pcre2_code_free);
-
     auto matchDataHandle = AcquireTestMatchData8();
     auto *matchData = matchDataHandle.data;
     if (matchData == nullptr) {
@@ -293,6 +341,11 @@ void RegExp8::ExtractGroups(Pcre2Obj expression, int count, RegExpExecResult &re
     }
 }
 
+RegExpPatternCacheStats RegExp8::GetPatternCacheStats()
+{
+    return GetTlsPatternCache8().GetStats();
+}
+
 void RegExp8::FreePcre2Object(Pcre2Obj re)
 {
     if (re == nullptr) {
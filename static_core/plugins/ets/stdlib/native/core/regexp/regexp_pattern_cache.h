@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_PLUGINS_ETS_STDLIB_NATIVE_CORE_REGEXP_REGEXP_PATTERN_CACHE_H
+#define PANDA_PLUGINS_ETS_STDLIB_NATIVE_CORE_REGEXP_REGEXP_PATTERN_CACHE_H
+
+#include "libarkbase/macros.h"
+#include "libarkbase/utils/hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace ark::ets::stdlib {
+
+struct RegExpPatternCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t jitCompilations = 0;
+    uint64_t jitFailures = 0;
+};
+
+/**
+ * LRU cache of compiled PCRE2 patterns keyed by (pattern, compile flags, extra compile flags).
+ * It is used by RegExp.test, where the pattern is recompiled on every call otherwise.
+ * Instances are expected to be thread local, so no synchronization is performed.
+ * @tparam CharT - code unit of the pattern (uint8_t or uint16_t)
+ * @tparam CodeT - PCRE2 code type of the corresponding width
+ * @tparam CODE_FREE - function releasing the compiled code
+ */
+template <typename CharT, typename CodeT, void (*CODE_FREE)(CodeT *)>
+class RegExpPatternCache {
+public:
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr size_t DEFAULT_CAPACITY = 64U;
+    // Number of hits after which JIT compilation of the pattern is requested
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr uint32_t DEFAULT_JIT_THRESHOLD = 16U;
+
+    struct Entry {
+        CodeT *code = nullptr;
+        uint32_t hits = 0;
+        bool jitRequested = false;
+    };
+
+    explicit RegExpPatternCache(size_t capacity = DEFAULT_CAPACITY, uint32_t jitThreshold = DEFAULT_JIT_THRESHOLD)
+        : capacity_(capacity), jitThreshold_(jitThreshold)
+    {
+        ASSERT(capacity_ > 0U);
+    }
+
+    ~RegExpPatternCache()
+    {
+        Clear();
+    }
+
+    NO_COPY_SEMANTIC(RegExpPatternCache);
+    NO_MOVE_SEMANTIC(RegExpPatternCache);
+
+    /**
+     * Looks up the compiled code and marks it as the most recently used one.
+     * @return cache entry or nullptr on miss
+     */
+    Entry *Find(const CharT *pattern, size_t len, uint32_t flags, uint32_t extraFlags)
+    {
+        // Reuse the lookup key storage to avoid an allocation per call on the hot path
+        lookupKey_.pattern.assign(pattern, pattern + len);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        lookupKey_.flags = flags;
+        lookupKey_.extraFlags = extraFlags;
+        auto it = index_.find(lookupKey_);
+        if (it == index_.end()) {
+            stats_.misses++;
+            return nullptr;
+        }
+        stats_.hits++;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        auto &entry = it->second->second;
+        entry.hits++;
+        return &entry;
+    }
+
+    /**
+     * Takes ownership of @param code. The least recently used entry is evicted when the cache is full.
+     * @return entry of the inserted code
+     */
+    Entry *Insert(const CharT *pattern, size_t len, uint32_t flags, uint32_t extraFlags, CodeT *code)
+    {
+        ASSERT(code != nullptr);
+        if (lru_.size() >= capacity_) {
+            EvictLast();
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        Key key {std::vector<CharT>(pattern, pattern + len), flags, extraFlags};
+        lru_.emplace_front(key, Entry {code, 0, false});
+        index_.emplace(std::move(key), lru_.begin());
+        return &lru_.front().second;
+    }
+
+    /// @return true if JIT compilation of the entry should be attempted now
+    bool ShouldJitCompile(const Entry &entry) const
+    {
+        return jitThreshold_ != 0U && !entry.jitRequested && entry.hits >= jitThreshold_;
+    }
+
+    void RecordJitResult(Entry &entry, bool success)
+    {
+        entry.jitRequested = true;
+        if (success) {
+            stats_.jitCompilations++;
+        } else {
+            stats_.jitFailures++;
+        }
+    }
+
+    void Clear()
+    {
+        for (auto &item : lru_) {
+            CODE_FREE(item.second.code);
+        }
+        lru_.clear();
+        index_.clear();
+    }
+
+    size_t Size() const
+    {
+        return lru_.size();
+    }
+
+    const RegExpPatternCacheStats &GetStats() const
+    {
+        return stats_;
+    }
+
+private:
+    struct Key {
+        std::vector<CharT> pattern;
+        uint32_t flags = 0;
+        uint32_t extraFlags = 0;
+
+        bool operator==(const Key &other) const
+        {
+            return flags == other.flags && extraFlags == other.extraFlags && pattern == other.pattern;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const
+        {
+            auto hash = GetHash32WithSeed(reinterpret_cast<const uint8_t *>(key.pattern.data()),
+                                          key.pattern.size() * sizeof(CharT), key.flags);
+            return static_cast<size_t>(hash ^ key.extraFlags);
+        }
+    };
+
+    using LruList = std::list<std::pair<Key, Entry>>;
+
+    void EvictLast()
+    {
+        ASSERT(!lru_.empty());
+        auto &last = lru_.back();
+        index_.erase(last.first);
+        CODE_FREE(last.second.code);
+        lru_.pop_back();
+        stats_.evictions++;
+    }
+
+    size_t capacity_;
+    uint32_t jitThreshold_;
+    LruList lru_;
+    std::unordered_map<Key, typename LruList::iterator, KeyHash> index_;
+    Key lookupKey_ {};
+    RegExpPatternCacheStats stats_;
+};
+
+}  // namespace ark::ets::stdlib
+
+#endif  // PANDA_PLUGINS_ETS_STDLIB_NATIVE_CORE_REGEXP_REGEXP_PATTERN_CACHE_H
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ani_gtest.h"
+
+#include <vector>
+
+namespace ark::ets::ani::testing {
+
+/**
+ * Updates a byte array in place through the pinned data, as the native code would do it instead of copying
+ * the array out and back with the region accessors. The throughput is measured by the ANI benchmarks.
+ */
+class PinnedAccessTest : public AniTest {
+public:
+    static constexpr ani_size ARRAY_SIZE = 4096U;
+    static constexpr ani_size ITERATIONS = 3U;
+
+    static void Update(ani_byte *data, ani_size size)
+    {
+        for (ani_size i = 0; i < size; ++i) {
+            data[i] = static_cast<ani_byte>(data[i] + 1);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+};
+
+TEST_F(PinnedAccessTest, UpdateByteArray)
+{
+    ani_valuearray_byte array = nullptr;
+    ASSERT_EQ(env_->ValueArray_New_Byte(ARRAY_SIZE, &array), ANI_OK);
+    for (ani_size i = 0; i < ITERATIONS; ++i) {
+        void *data = nullptr;
+        ani_size length = 0;
+        ASSERT_EQ(env_->ValueArray_Pin(array, &data, &length), ANI_OK);
+        ASSERT_NE(data, nullptr);
+        ASSERT_EQ(length, ARRAY_SIZE);
+        Update(static_cast<ani_byte *>(data), length);
+        ASSERT_EQ(env_->ValueArray_Unpin(array, data), ANI_OK);
+    }
+
+    std::vector<ani_byte> buffer(ARRAY_SIZE);
+    ASSERT_EQ(env_->ValueArray_GetRegion_Byte(array, 0, ARRAY_SIZE, buffer.data()), ANI_OK);
+    for (ani_byte value : buffer) {
+        ASSERT_EQ(value, static_cast<ani_byte>(ITERATIONS));
+    }
+    ASSERT_EQ(env_->Reference_Delete(array), ANI_OK);
+}
+
+TEST_F(PinnedAccessTest, MatchesRegionAccess)
+{
+    ani_valuearray_byte array = nullptr;
+    ASSERT_EQ(env_->ValueArray_New_Byte(ARRAY_SIZE, &array), ANI_OK);
+    std::vector<ani_byte> buffer(ARRAY_SIZE);
+    for (ani_size i = 0; i < ARRAY_SIZE; ++i) {
+        buffer[i] = static_cast<ani_byte>(i);
+    }
+    ASSERT_EQ(env_->ValueArray_SetRegion_Byte(array, 0, ARRAY_SIZE, buffer.data()), ANI_OK);
+
+    void *data = nullptr;
+    ani_size length = 0;
+    ASSERT_EQ(env_->ValueArray_Pin(array, &data, &length), ANI_OK);
+    ASSERT_EQ(length, ARRAY_SIZE);
+    auto *elements = static_cast<ani_byte *>(data);
+    for (ani_size i = 0; i < length; ++i) {
+        ASSERT_EQ(elements[i], buffer[i]);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    Update(elements, length);
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data), ANI_OK);
+    // The data must not be unpinned twice
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data), ANI_INVALID_ARGS);
+
+    std::vector<ani_byte> updated(ARRAY_SIZE);
+    ASSERT_EQ(env_->ValueArray_GetRegion_Byte(array, 0, ARRAY_SIZE, updated.data()), ANI_OK);
+    for (ani_size i = 0; i < ARRAY_SIZE; ++i) {
+        ASSERT_EQ(updated[i], static_cast<ani_byte>(buffer[i] + 1));
+    }
+    ASSERT_EQ(env_->Reference_Delete(array), ANI_OK);
+}
+
+}  // namespace ark::ets::ani::testing
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ani_gtest.h"
+
+#include <string_view>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-vararg, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+namespace ark::ets::ani::testing {
+
+class StringPinTest : public AniTest {};
+
+TEST_F(StringPinTest, PinCompressedString)
+{
+    const std::string example {"example"};
+    ani_string string = nullptr;
+    ASSERT_EQ(env_->String_NewUTF8(example.c_str(), example.size(), &string), ANI_OK);
+    const void *data = nullptr;
+    ani_size length = 0;
+    ani_boolean isUtf16 = ANI_TRUE;
+    ASSERT_EQ(env_->String_Pin(string, &data, &length, &isUtf16), ANI_OK);
+    ASSERT_EQ(isUtf16, ANI_FALSE);
+    ASSERT_EQ(length, example.size());
+    ASSERT_EQ(std::string_view(static_cast<const char *>(data), length), example);
+    ASSERT_EQ(env_->String_Unpin(string, data), ANI_OK);
+}
+
+TEST_F(StringPinTest, PinUtf16String)
+{
+    const std::u16string example {u"пример"};
+    ani_string string = nullptr;
+    ASSERT_EQ(env_->String_NewUTF16(reinterpret_cast<const uint16_t *>(example.data()), example.size(), &string),
+              ANI_OK);
+    const void *data = nullptr;
+    ani_size length = 0;
+    ani_boolean isUtf16 = ANI_FALSE;
+    ASSERT_EQ(env_->String_Pin(string, &data, &length, &isUtf16), ANI_OK);
+    ASSERT_EQ(isUtf16, ANI_TRUE);
+    ASSERT_EQ(length, example.size());
+    ASSERT_EQ(std::u16string_view(static_cast<const char16_t *>(data), length), example);
+    ASSERT_EQ(env_->String_Unpin(string, data), ANI_OK);
+}
+
+TEST_F(StringPinTest, PinConcatString)
+{
+    const std::string prefix {"abc"};
+    const ani_int count = 100;
+    ani_string prefixString = nullptr;
+    ASSERT_EQ(env_->String_NewUTF8(prefix.c_str(), prefix.size(), &prefixString), ANI_OK);
+    auto string =
+        static_cast<ani_string>(CallEtsFunction<ani_ref>("string_pin_test", "getConcatString", prefixString, count));
+
+    const void *data = nullptr;
+    ani_size length = 0;
+    ani_boolean isUtf16 = ANI_TRUE;
+    ASSERT_EQ(env_->String_Pin(string, &data, &length, &isUtf16), ANI_OK);
+    ASSERT_EQ(isUtf16, ANI_FALSE);
+    ASSERT_EQ(length, prefix.size() * (count + 1));
+    // The flattened copy of the string is kept alive until it is unpinned
+    CallEtsFunction<void>("string_pin_test", "doFullGC");
+    auto *chars = static_cast<const char *>(data);
+    for (ani_size i = 0; i < length; ++i) {
+        ASSERT_EQ(chars[i], prefix[i % prefix.size()]);
+    }
+    ASSERT_EQ(env_->String_Unpin(string, data), ANI_OK);
+}
+
+TEST_F(StringPinTest, InvalidArgs)
+{
+    const std::string example {"example"};
+    ani_string string = nullptr;
+    ASSERT_EQ(env_->String_NewUTF8(example.c_str(), example.size(), &string), ANI_OK);
+    const void *data = nullptr;
+    ani_size length = 0;
+    ani_boolean isUtf16 = ANI_FALSE;
+    ASSERT_EQ(env_->c_api->String_Pin(nullptr, string, &data, &length, &isUtf16), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->String_Pin(nullptr, &data, &length, &isUtf16), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->String_Pin(string, nullptr, &length, &isUtf16), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->String_Pin(string, &data, nullptr, &isUtf16), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->String_Pin(string, &data, &length, nullptr), ANI_INVALID_ARGS);
+
+    ASSERT_EQ(env_->String_Unpin(string, example.c_str()), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->String_Unpin(string, nullptr), ANI_INVALID_ARGS);
+}
+
+TEST_F(StringPinTest, UnpinOtherString)
+{
+    const std::string example {"example"};
+    ani_string string = nullptr;
+    ani_string other = nullptr;
+    ASSERT_EQ(env_->String_NewUTF8(example.c_str(), example.size(), &string), ANI_OK);
+    ASSERT_EQ(env_->String_NewUTF8(example.c_str(), example.size(), &other), ANI_OK);
+    const void *data = nullptr;
+    ani_size length = 0;
+    ani_boolean isUtf16 = ANI_TRUE;
+    ASSERT_EQ(env_->String_Pin(string, &data, &length, &isUtf16), ANI_OK);
+    ASSERT_EQ(env_->String_Unpin(other, data), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->String_Unpin(string, data), ANI_OK);
+}
+
+TEST_F(StringPinTest, UnpinConcatStringByFlatString)
+{
+    const std::string prefix {"abc"};
+    const ani_int count = 10;
+    ani_string prefixString = nullptr;
+    ASSERT_EQ(env_->String_NewUTF8(prefix.c_str(), prefix.size(), &prefixString), ANI_OK);
+    auto string =
+        static_cast<ani_string>(CallEtsFunction<ani_ref>("string_pin_test", "getConcatString", prefixString, count));
+
+    const void *data = nullptr;
+    ani_size length = 0;
+    ani_boolean isUtf16 = ANI_TRUE;
+    ASSERT_EQ(env_->String_Pin(string, &data, &length, &isUtf16), ANI_OK);
+    // The other string with the same characters is not the one the data was pinned from
+    ani_string other = nullptr;
+    ASSERT_EQ(env_->String_NewUTF8(static_cast<const char *>(data), length, &other), ANI_OK);
+    ASSERT_EQ(env_->String_Unpin(other, data), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->String_Unpin(string, data), ANI_OK);
+}
+
+}  // namespace ark::ets::ani::testing
+// NOLINTEND(cppcoreguidelines-pro-type-vararg, cppcoreguidelines-pro-bounds-pointer-arithmetic)
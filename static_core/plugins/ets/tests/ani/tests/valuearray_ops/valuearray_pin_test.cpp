@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "valuearray_gtest_ops.h"
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-vararg, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+namespace ark::ets::ani::testing {
+
+class ValueArrayPinTest : public AniGTestValueArrayOps {
+protected:
+    static constexpr ani_int TEST_UPDATE1 = 30;
+    static constexpr ani_int TEST_UPDATE2 = 50;
+};
+
+TEST_F(ValueArrayPinTest, PinWriteUnpin)
+{
+    const auto array = static_cast<ani_valuearray_int>(CallEtsFunction<ani_ref>("valuearray_pin_test", "getArray"));
+    void *data = nullptr;
+    ani_size length = 0;
+    ASSERT_EQ(env_->ValueArray_Pin(array, &data, &length), ANI_OK);
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(length, LENGTH_5);
+    auto *elements = static_cast<ani_int *>(data);
+    ASSERT_EQ(elements[0U], 1);
+    ASSERT_EQ(elements[4U], 5);
+    elements[2U] = TEST_UPDATE1;
+    elements[4U] = TEST_UPDATE2;
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data), ANI_OK);
+    ASSERT_EQ(CallEtsFunction<ani_boolean>("valuearray_pin_test", "checkArray", array), ANI_TRUE);
+}
+
+TEST_F(ValueArrayPinTest, PinSurvivesGC)
+{
+    ani_valuearray_int array = nullptr;
+    ASSERT_EQ(env_->ValueArray_New_Int(LENGTH_10, &array), ANI_OK);
+    void *data = nullptr;
+    ani_size length = 0;
+    ASSERT_EQ(env_->ValueArray_Pin(array, &data, &length), ANI_OK);
+    ASSERT_EQ(length, LENGTH_10);
+    auto *elements = static_cast<ani_int *>(data);
+    for (ani_size i = 0; i < length; ++i) {
+        elements[i] = static_cast<ani_int>(i);
+    }
+    CallEtsFunction<void>("valuearray_pin_test", "doFullGC");
+    for (ani_size i = 0; i < length; ++i) {
+        ASSERT_EQ(elements[i], static_cast<ani_int>(i));
+    }
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data), ANI_OK);
+
+    std::array<ani_int, LENGTH_10> region {};
+    ASSERT_EQ(env_->ValueArray_GetRegion_Int(array, OFFSET_0, LENGTH_10, region.data()), ANI_OK);
+    for (ani_size i = 0; i < LENGTH_10; ++i) {
+        ASSERT_EQ(region[i], static_cast<ani_int>(i));
+    }
+}
+
+TEST_F(ValueArrayPinTest, NestedPins)
+{
+    ani_valuearray_double array = nullptr;
+    ASSERT_EQ(env_->ValueArray_New_Double(LENGTH_3, &array), ANI_OK);
+    void *data1 = nullptr;
+    void *data2 = nullptr;
+    ani_size length = 0;
+    ASSERT_EQ(env_->ValueArray_Pin(array, &data1, &length), ANI_OK);
+    ASSERT_EQ(env_->ValueArray_Pin(array, &data2, &length), ANI_OK);
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data2), ANI_OK);
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data1), ANI_OK);
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data1), ANI_INVALID_ARGS);
+}
+
+TEST_F(ValueArrayPinTest, InvalidArgs)
+{
+    ani_valuearray_int array = nullptr;
+    ASSERT_EQ(env_->ValueArray_New_Int(LENGTH_5, &array), ANI_OK);
+    void *data = nullptr;
+    ani_size length = 0;
+    ASSERT_EQ(env_->c_api->ValueArray_Pin(nullptr, array, &data, &length), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->ValueArray_Pin(nullptr, &data, &length), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->ValueArray_Pin(array, nullptr, &length), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->ValueArray_Pin(array, &data, nullptr), ANI_INVALID_ARGS);
+
+    ani_int unknown = 0;
+    ASSERT_EQ(env_->ValueArray_Unpin(array, &unknown), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->ValueArray_Unpin(array, nullptr), ANI_INVALID_ARGS);
+}
+
+TEST_F(ValueArrayPinTest, UnpinOtherArray)
+{
+    ani_valuearray_int array = nullptr;
+    ani_valuearray_int other = nullptr;
+    ASSERT_EQ(env_->ValueArray_New_Int(LENGTH_5, &array), ANI_OK);
+    ASSERT_EQ(env_->ValueArray_New_Int(LENGTH_5, &other), ANI_OK);
+    void *data = nullptr;
+    ani_size length = 0;
+    ASSERT_EQ(env_->ValueArray_Pin(array, &data, &length), ANI_OK);
+    static_cast<ani_int *>(data)[0U] = TEST_UPDATE1;
+    // The data stays pinned after the unpin of another array is rejected
+    ASSERT_EQ(env_->ValueArray_Unpin(other, data), ANI_INVALID_ARGS);
+    ASSERT_EQ(env_->ValueArray_Unpin(array, data), ANI_OK);
+
+    std::array<ani_int, LENGTH_5> region {};
+    ASSERT_EQ(env_->ValueArray_GetRegion_Int(array, OFFSET_0, LENGTH_5, region.data()), ANI_OK);
+    ASSERT_EQ(region[0U], TEST_UPDATE1);
+    ASSERT_EQ(env_->ValueArray_GetRegion_Int(other, OFFSET_0, LENGTH_5, region.data()), ANI_OK);
+    ASSERT_EQ(region[0U], 0);
+}
+
+}  // namespace ark::ets::ani::testing
+// NOLINTEND(cppcoreguidelines-pro-type-vararg, cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugins/ets/runtime/ani/ani.h"
+#include <iostream>
+#include <array>
+#include <vector>
+
+static void Update(ani_byte *data, ani_size size)
+{
+    for (ani_size i = 0; i < size; ++i) {
+        data[i] = static_cast<ani_byte>(data[i] + 1);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+}
+
+extern "C" {
+// NOLINTBEGIN(readability-named-parameter, cppcoreguidelines-pro-type-vararg, readability-identifier-naming)
+void pinned_access_region(ani_env *env, [[maybe_unused]] ani_class, ani_valuearray_byte array)
+{
+    ani_size length = 0;
+    if (ANI_OK != env->ValueArray_GetLength(array, &length)) {
+        return;
+    }
+    std::vector<ani_byte> buffer(length);
+    if (ANI_OK != env->ValueArray_GetRegion_Byte(array, 0, length, buffer.data())) {
+        return;
+    }
+    Update(buffer.data(), length);
+    env->ValueArray_SetRegion_Byte(array, 0, length, buffer.data());
+}
+
+void pinned_access_pin(ani_env *env, [[maybe_unused]] ani_class, ani_valuearray_byte array)
+{
+    void *data = nullptr;
+    ani_size length = 0;
+    if (ANI_OK != env->ValueArray_Pin(array, &data, &length)) {
+        return;
+    }
+    Update(static_cast<ani_byte *>(data), length);
+    env->ValueArray_Unpin(array, data);
+}
+
+ANI_EXPORT ani_status ANI_Constructor(ani_vm *vm, uint32_t *result)
+{
+    ani_env *env;
+    if (ANI_OK != vm->GetEnv(ANI_VERSION_1, &env)) {
+        std::cout << "Wrong version of ANI!\n";
+        return ANI_ERROR;
+    }
+    ani_class cls;
+    if (ANI_OK != env->FindClass("bench_$bench_name.PinnedAccess", &cls)) {
+        std::cout << "Class PinnedAccess not found!\n";
+        return ANI_ERROR;
+    }
+    std::array staticMethods = {
+        ani_native_function {"pinned_access_region", "A{b}:", reinterpret_cast<void *>(pinned_access_region)},
+        ani_native_function {"pinned_access_pin", "A{b}:", reinterpret_cast<void *>(pinned_access_pin)},
+    };
+    if (ANI_OK != env->Class_BindStaticNativeMethods(cls, staticMethods.data(), staticMethods.size())) {
+        std::cout << "Binding native methods failed!\n";
+        return ANI_ERROR;
+    }
+    *result = ANI_VERSION_1;
+    return ANI_OK;
+}
+
+// NOLINTEND(readability-named-parameter, cppcoreguidelines-pro-type-vararg, readability-identifier-naming)
+
+}  // extern "C"
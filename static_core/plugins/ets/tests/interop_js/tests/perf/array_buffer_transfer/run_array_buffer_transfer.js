@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+const helper = requireNapiPreview('libinterop_test_helper.so', false);
+
+// Every run transfers about the same amount of memory, so small buffers get more round trips
+const BYTES_PER_RUN = 1024 * 1024 * 1024;
+const MIN_ITERS = 4;
+
+function runTest(test, byteLength) {
+	print('Running test ' + test + ' (' + byteLength + ' bytes)');
+
+	const gtestAbcPath = helper.getEnvironmentVar('ARK_ETS_INTEROP_JS_GTEST_ABC_PATH');
+	const stdlibPath = helper.getEnvironmentVar('ARK_ETS_STDLIB_PATH');
+
+	let etsVm = requireNapiPreview('ets_interop_js_napi.so', false);
+	const etsOpts = {
+		'log-level': 'info',
+		'log-components': 'ets_interop_js',
+		'panda-files': gtestAbcPath,
+		'boot-panda-files': `${stdlibPath}:${gtestAbcPath}`,
+		'gc-trigger-type': 'heap-trigger',
+		'compiler-enable-jit': 'false',
+		'run-gc-in-place': 'true',
+	};
+
+	if (!etsVm.createRuntime(etsOpts)) {
+		throw Error('Cannot create ETS runtime');
+	}
+
+	const runTestImpl = etsVm.getFunction('Larray_buffer_transfer/ETSGLOBAL;', test);
+	const iters = Math.max(MIN_ITERS, Math.floor(BYTES_PER_RUN / byteLength));
+	// Warmup
+	runTestImpl(byteLength, MIN_ITERS);
+
+	let start = Date.now();
+	runTestImpl(byteLength, iters);
+	let timeMs = Math.max(Date.now() - start, 1);
+	const MS2NS = 1000000;
+	const MB = 1024 * 1024;
+	const S2MS = 1000;
+	print('round trip ' + test + ': ' + (timeMs * MS2NS) / iters + ' ns/iter, iters: ' + iters);
+	// Each round trip moves the buffer in both directions
+	print('throughput ' + test + ': ' + Math.round((2 * byteLength * iters * S2MS) / (timeMs * MB)) + ' MB/s');
+
+	return null;
+}
+
+let args = helper.getArgv();
+if (args.length !== 7) {
+	throw Error('Expected <test name> <buffer byte length>');
+}
+runTest(args[5], parseInt(args[6], 10));
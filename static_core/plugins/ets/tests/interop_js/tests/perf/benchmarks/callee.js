@@ -29,3 +29,6 @@ module.exports.GetArray = function GetArray() {
     return [1, 2, 5];
 };
 module.exports.Pass = function Pass() {};
+module.exports.IsPositive = function IsPositive(x) {
+    return x > 0;
+};
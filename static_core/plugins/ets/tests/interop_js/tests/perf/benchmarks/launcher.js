@@ -66,6 +66,8 @@ function runTest() {
     caller(iters);
     timeNs = (Date.now() - start) * MS2NS;
     print('iters  ' + bench + ': ' + timeNs / iters + ' ns/iter, iters: ' + iters);
+    const S2NS = 1000000000;
+    print('calls  ' + bench + ': ' + Math.round(iters * S2NS / timeNs) + ' calls/s');
 
     return null;
 }
@@ -495,6 +495,33 @@ TEST_F(ObjectIdMapTest, ForEachLive_IteratesOnlyLiveEntries)
     ASSERT_EQ(seen[ADDRESS_B], 4U);
 }
 
+TEST_F(ObjectIdMapTest, ForEachLiveInBuckets_RangesCoverLiveEntriesOnce)
+{
+    Map().MarkLive<Language::STATIC>(ADDRESS_A);
+    Map().MarkLive<Language::STATIC>(ADDRESS_B);
+    Map().MarkLive<Language::STATIC>(ADDRESS_C);
+    Map().MarkLive<Language::STATIC>(ADDRESS_D);
+    Map().PrepareRound();
+    ASSERT_TRUE(Map().MarkLive<Language::STATIC>(ADDRESS_A));
+    ASSERT_TRUE(Map().MarkLive<Language::STATIC>(ADDRESS_C));
+    ASSERT_TRUE(Map().MarkLive<Language::STATIC>(ADDRESS_D));
+    Map().Freeze();
+
+    // Split the buckets into two ranges, as the parallel dump does per worker
+    size_t bucketCount = Map().BucketCount();
+    ASSERT_GT(bucketCount, 0U);
+    std::unordered_map<uintptr_t, size_t> visits;
+    auto visitor = [&visits](uintptr_t addr, [[maybe_unused]] ObjectIdMap::NodeId id) { visits[addr]++; };
+    Map().ForEachLiveInBuckets(0, bucketCount / 2U, visitor);
+    Map().ForEachLiveInBuckets(bucketCount / 2U, bucketCount + 1U, visitor);
+
+    ASSERT_EQ(visits.size(), 3U);
+    ASSERT_EQ(visits[ADDRESS_A], 1U);
+    ASSERT_EQ(visits[ADDRESS_C], 1U);
+    ASSERT_EQ(visits[ADDRESS_D], 1U);
+    ASSERT_EQ(visits.count(ADDRESS_B), 0U);
+}
+
 TEST_F(ObjectIdMapTest, CountOf_ReflectsLiveAfterPruneDead)
 {
     Map().MarkLive<Language::STATIC>(ADDRESS_A);
@@ -418,6 +418,12 @@ public:
         dump->writer_ = new StaticWriter(dump->staticStream_);
     }
 
+    static void SetDumpThreads(StaticDump *dump, size_t threads, size_t chunkBuckets)
+    {
+        dump->dumpThreads_ = threads;
+        dump->dumpChunkBuckets_ = chunkBuckets;
+    }
+
     static FieldValueData EncodeTaggedValue(StaticDump *dump, coretypes::TaggedValue value)
     {
         return dump->EncodeTaggedValue(value);
@@ -1624,7 +1630,9 @@ protected:
     // Run the real dumper to produce .rawheap, then drive the real translator
     // (rawheap_translate_static) to emit a .heapsnapshot and wrap it in the
     // cJSON graph reader. No hand-written binary parser.
-    static std::unique_ptr<HeapsnapshotGraph> DumpAndTranslate()
+    // dumpThreads == 0 keeps the dumper's own threads count.
+    static std::unique_ptr<HeapsnapshotGraph> DumpAndTranslate(size_t dumpThreads = 0,
+                                                               StaticDump::DumpCost *cost = nullptr)
     {
         auto &profiler = HeapDumpCoordinator::GetInstance();
         DumpRequest request;
@@ -1643,6 +1651,10 @@ protected:
             return nullptr;
         }
         StaticDumpTest::SetOutput(staticDump, fd);
+        if (dumpThreads != 0) {
+            // Single bucket chunks, so that even the small test heap is split between all the threads
+            StaticDumpTest::SetDumpThreads(staticDump, dumpThreads, 1U);
+        }
 
         profiler.GetStringIdPool().Unfreeze();
         profiler.GetObjectIdMap().Unfreeze();
@@ -1652,6 +1664,9 @@ protected:
             LOG(ERROR, RUNTIME) << "[StaDumpTest] static dump lifecycle failed";
             return nullptr;
         }
+        if (cost != nullptr) {
+            *cost = staticDump->GetDumpCost();
+        }
         // StaticDump owns and closes the injected descriptor on destruction.
         dump.reset();
 
@@ -2395,6 +2410,34 @@ TEST_F(StaticDumpIntegrationTest, HeapsnapshotCircularReference_NoInfiniteLoop)
     EXPECT_TRUE(reachable[friendB]) << "CircularFriendB is unreachable";
 }
 
+// Heap records written by several threads interleave in the stream, the
+// translated graph must be the same as for the single-threaded dump.
+TEST_F(StaticDumpIntegrationTest, ParallelDumpMatchesSerialDump)
+{
+    constexpr size_t PARALLEL_DUMP_THREADS = 4U;
+
+    StaticDump::DumpCost serialCost;
+    auto serial = DumpAndTranslate(1U, &serialCost);
+    ASSERT_NE(serial, nullptr);
+    StaticDump::DumpCost parallelCost;
+    auto parallel = DumpAndTranslate(PARALLEL_DUMP_THREADS, &parallelCost);
+    ASSERT_NE(parallel, nullptr);
+
+    EXPECT_EQ(serialCost.threads, 1U);
+    EXPECT_EQ(parallelCost.threads, PARALLEL_DUMP_THREADS);
+    EXPECT_EQ(parallel->NodeCount(), serial->NodeCount());
+    EXPECT_EQ(parallel->EdgeCount(), serial->EdgeCount());
+    for (const auto &ec : kExpectedClasses) {
+        if (!ec.optional) {
+            EXPECT_GE(parallel->FindClassBySimpleName(ec.simpleName), 0) << ec.simpleName;
+        }
+    }
+    auto serialReachable = serial->ReachableFrom(0);
+    auto parallelReachable = parallel->ReachableFrom(0);
+    EXPECT_EQ(std::count(parallelReachable.begin(), parallelReachable.end(), true),
+              std::count(serialReachable.begin(), serialReachable.end(), true));
+}
+
 #endif  // STATIC_DUMP_TEST_ABC_DIR
 
 }  // namespace ark::tooling::hprof
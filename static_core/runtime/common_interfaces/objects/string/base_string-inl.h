@@ -24,6 +24,7 @@
 #include "common_interfaces/objects/string/base_string.h"
 #include "common_interfaces/objects/string/line_string-inl.h"
 #include "common_interfaces/objects/string/sliced_string-inl.h"
+#include "common_interfaces/objects/string/string_kernels.h"
 #include "common_interfaces/objects/string/tree_string-inl.h"
 #include "common_interfaces/objects/utils/utf_utils.h"
 #include "common_interfaces/objects/utils/span.h"
@@ -803,26 +804,8 @@ template <typename T1, typename T2>
 int32_t BaseString::LastIndexOf(ark::common_vm::Span<const T1> &lhsSp, ark::common_vm::Span<const T2> &rhsSp,
                                 int32_t pos)
 {
-    int rhsSize = static_cast<int>(rhsSp.size());
-    DCHECK(rhsSize > 0);
-    auto first = rhsSp[0];
-    for (int32_t i = pos; i >= 0; i--) {
-        if (lhsSp[i] != first) {
-            continue;
-        }
-        /* Found first character, now look at the rest of rhsSp */
-        int j = 1;
-        while (j < rhsSize) {
-            if (rhsSp[j] != lhsSp[i + j]) {
-                break;
-            }
-            j++;
-        }
-        if (j == rhsSize) {
-            return i;
-        }
-    }
-    return -1;
+    DCHECK(rhsSp.size() > 0);
+    return string_kernels::LastIndexOf(lhsSp.data(), rhsSp.data(), rhsSp.size(), pos);
 }
 
 /* static */
@@ -830,28 +813,7 @@ template <typename T1, typename T2>
 int32_t BaseString::IndexOf(ark::common_vm::Span<const T1> &lhsSp, ark::common_vm::Span<const T2> &rhsSp, int32_t pos,
                             int32_t max)
 {
-    auto first = static_cast<int32_t>(rhsSp[0]);
-    for (int32_t i = pos; i <= max; i++) {
-        if (static_cast<int32_t>(lhsSp[i]) != first) {
-            i++;
-            while (i <= max && static_cast<int32_t>(lhsSp[i]) != first) {
-                i++;
-            }
-        }
-        /* Found first character, now look at the rest of rhsSp */
-        if (i <= max) {
-            int j = i + 1;
-            int end = j + static_cast<int>(rhsSp.size()) - 1;
-
-            for (int k = 1; j < end && static_cast<int32_t>(lhsSp[j]) == static_cast<int32_t>(rhsSp[k]); j++, k++) {
-            }
-            if (j == end) {
-                /* Found whole string. */
-                return i;
-            }
-        }
-    }
-    return -1;
+    return string_kernels::IndexOf(lhsSp.data(), rhsSp.data(), rhsSp.size(), pos, max);
 }
 
 // static
@@ -905,14 +867,11 @@ inline bool BaseString::CanBeCompressed(const uint16_t *utf16Data, uint32_t utf1
 template <typename T1, typename T2>
 int32_t CompareStringSpan(ark::common_vm::Span<T1> &lhsSp, ark::common_vm::Span<T2> &rhsSp, int32_t count)
 {
-    for (int32_t i = 0; i < count; ++i) {
-        auto left = static_cast<int32_t>(lhsSp[i]);
-        auto right = static_cast<int32_t>(rhsSp[i]);
-        if (left != right) {
-            return left - right;
-        }
+    auto i = string_kernels::Mismatch(lhsSp.data(), rhsSp.data(), static_cast<size_t>(count));
+    if (i == static_cast<size_t>(count)) {
+        return 0;
     }
-    return 0;
+    return static_cast<int32_t>(lhsSp[i]) - static_cast<int32_t>(rhsSp[i]);
 }
 
 #if defined(PANDA_32_BIT_MANAGED_POINTER)
@@ -22,6 +22,7 @@
 #include "common_interfaces/objects/readonly_handle.h"
 #include "libarkbase/utils/bit_field.h"
 #include "common_interfaces/objects/utils/span.h"
+#include "common_interfaces/objects/string/string_kernels.h"
 
 #include <type_traits>
 #include <vector>
@@ -827,14 +828,7 @@ bool BaseString::StringsAreEquals(ark::common_vm::Span<const T> &str1, ark::comm
     if constexpr (std::is_same_v<T, T1>) {
         return !memcmp(str1.data(), str2.data(), size * sizeof(T));
     } else {
-        for (size_t i = 0; i < size; i++) {
-            auto left = static_cast<uint16_t>(str1[i]);
-            auto right = static_cast<uint16_t>(str2[i]);
-            if (left != right) {
-                return false;
-            }
-        }
-        return true;
+        return string_kernels::Mismatch(str1.data(), str2.data(), size) == size;
     }
 }
 
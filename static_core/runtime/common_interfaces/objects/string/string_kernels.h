@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMMON_RUNTIME_COMMON_INTERFACES_OBJECTS_STRING_STRING_KERNELS_H
+#define COMMON_RUNTIME_COMMON_INTERFACES_OBJECTS_STRING_STRING_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "common_interfaces/base/common.h"
+#include "libarkbase/utils/vector_helpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+/**
+ * Search and comparison kernels for the string data, both compressed (uint8_t) and uncompressed (uint16_t).
+ * The substring search filters the candidate positions by the first and the last chars of the pattern, 16 bytes
+ * of the subject at once, and compares the rest of the pattern only at the candidates.
+ */
+namespace ark::mem::string_kernels {
+
+using ark::helpers::vector::AnyLane;
+using ark::helpers::vector::Vector;
+using ark::helpers::vector::VECTOR_BYTES;
+using ark::helpers::vector::VectorType;
+
+/// Loads LANES elements of type T as a vector of type Wide, narrower elements are zero extended
+template <typename Wide, typename T>
+ALWAYS_INLINE inline VectorType<Wide> LoadVector(const T *data)
+{
+    static_assert(std::is_unsigned_v<T> && sizeof(T) <= sizeof(Wide));
+    if constexpr (sizeof(T) == sizeof(Wide)) {
+        VectorType<Wide> vec;
+        memcpy(&vec, data, VECTOR_BYTES);
+        return vec;
+    } else {
+        static_assert(sizeof(T) == sizeof(uint8_t));
+        typename Vector<Wide>::HalfType half;
+        memcpy(&half, data, sizeof(half));
+        return __builtin_convertvector(half, VectorType<Wide>);
+    }
+}
+
+template <typename T>
+ALWAYS_INLINE inline VectorType<T> Broadcast(T value)
+{
+    return VectorType<T> {} + value;
+}
+
+/// @return index of the first element which differs in @param lhs and @param rhs, or @param count if they are equal
+template <typename T1, typename T2>
+size_t Mismatch(const T1 *lhs, const T2 *rhs, size_t count)
+{
+    using Wide = std::remove_cv_t<std::conditional_t<(sizeof(T1) > sizeof(T2)), T1, T2>>;
+    constexpr size_t LANES = Vector<Wide>::LANES;
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        if (AnyLane(LoadVector<Wide>(lhs + i) != LoadVector<Wide>(rhs + i))) {
+            break;
+        }
+    }
+    while (i < count && static_cast<Wide>(lhs[i]) == static_cast<Wide>(rhs[i])) {
+        ++i;
+    }
+    return i;
+}
+
+template <typename T>
+ALWAYS_INLINE inline bool FitsIn(int32_t value)
+{
+    return value >= 0 && value <= static_cast<int32_t>(std::numeric_limits<T>::max());
+}
+
+/// @return index of the first @param value in @param data in [begin, end), or @param end if there is no such element
+template <typename T>
+size_t FindChar(const T *data, size_t begin, size_t end, int32_t value)
+{
+    if (!FitsIn<T>(value)) {
+        return end;
+    }
+    constexpr size_t LANES = Vector<T>::LANES;
+    auto valueVec = Broadcast(static_cast<T>(value));
+    size_t i = begin;
+    for (; i + LANES <= end; i += LANES) {
+        if (AnyLane(LoadVector<T>(data + i) == valueVec)) {
+            break;
+        }
+    }
+    while (i < end && data[i] != static_cast<T>(value)) {
+        ++i;
+    }
+    return i;
+}
+
+/// @return the first index in [pos, max] where @param pattern occurs in @param subj, or -1
+template <typename S, typename P>
+int32_t IndexOf(const S *subj, const P *pattern, size_t patternLength, int32_t pos, int32_t max)
+{
+    DCHECK(patternLength > 0);
+    auto first = static_cast<int32_t>(pattern[0]);
+    auto last = static_cast<int32_t>(pattern[patternLength - 1U]);
+    if (!FitsIn<S>(first) || !FitsIn<S>(last)) {
+        // the subject has no such chars
+        return -1;
+    }
+    constexpr auto LANES = static_cast<int32_t>(Vector<S>::LANES);
+    auto firstVec = Broadcast(static_cast<S>(first));
+    auto lastVec = Broadcast(static_cast<S>(last));
+    int32_t i = pos;
+    for (; i + LANES - 1 <= max; i += LANES) {
+        auto candidates =
+            (LoadVector<S>(subj + i) == firstVec) & (LoadVector<S>(subj + i + patternLength - 1U) == lastVec);
+        if (!AnyLane(candidates)) {
+            continue;
+        }
+        for (int32_t k = 0; k < LANES; ++k) {
+            if (candidates[k] != 0 && Mismatch(subj + i + k, pattern, patternLength) == patternLength) {
+                return i + k;
+            }
+        }
+    }
+    for (; i <= max; ++i) {
+        if (static_cast<int32_t>(subj[i]) == first && Mismatch(subj + i, pattern, patternLength) == patternLength) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/// @return the last index in [0, pos] where @param pattern occurs in @param subj, or -1
+template <typename S, typename P>
+int32_t LastIndexOf(const S *subj, const P *pattern, size_t patternLength, int32_t pos)
+{
+    DCHECK(patternLength > 0);
+    auto first = static_cast<int32_t>(pattern[0]);
+    auto last = static_cast<int32_t>(pattern[patternLength - 1U]);
+    if (!FitsIn<S>(first) || !FitsIn<S>(last)) {
+        // the subject has no such chars
+        return -1;
+    }
+    constexpr auto LANES = static_cast<int32_t>(Vector<S>::LANES);
+    auto firstVec = Broadcast(static_cast<S>(first));
+    auto lastVec = Broadcast(static_cast<S>(last));
+    int32_t i = pos;
+    for (; i - LANES + 1 >= 0; i -= LANES) {
+        int32_t base = i - LANES + 1;
+        auto candidates =
+            (LoadVector<S>(subj + base) == firstVec) & (LoadVector<S>(subj + base + patternLength - 1U) == lastVec);
+        if (!AnyLane(candidates)) {
+            continue;
+        }
+        for (int32_t k = LANES - 1; k >= 0; --k) {
+            if (candidates[k] != 0 && Mismatch(subj + base + k, pattern, patternLength) == patternLength) {
+                return base + k;
+            }
+        }
+    }
+    for (; i >= 0; --i) {
+        if (static_cast<int32_t>(subj[i]) == first && Mismatch(subj + i, pattern, patternLength) == patternLength) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+}  // namespace ark::mem::string_kernels
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+#endif  // COMMON_RUNTIME_COMMON_INTERFACES_OBJECTS_STRING_STRING_KERNELS_H
@@ -30,6 +30,7 @@
 #include "runtime/include/runtime.h"
 #include "runtime/include/thread_scopes.h"
 #include "runtime/include/coretypes/native_pointer.h"
+#include "runtime/mem/gc/allocation_site_tracker.h"
 #include "runtime/mem/heap_manager.h"
 #include "runtime/mem/refstorage/reference.h"
 #include "compiler/inplace_task_runner.h"
@@ -659,6 +660,21 @@ size_t PandaRuntimeInterface::GetTLABMaxSize() const
     return Mutator::GetCurrent()->GetVM()->GetHeapManager()->GetTLABMaxAllocSize();
 }
 
+bool PandaRuntimeInterface::IsAllocationSitePretenured(MethodPtr method, uint32_t pc) const
+{
+    auto *tracker = Runtime::GetCurrent()->GetPandaVM()->GetGC()->GetAllocationSiteTracker();
+    if (tracker == nullptr) {
+        return false;
+    }
+    // Sites are the bytecode addresses, as they are recorded by the interpreter
+    return tracker->IsPretenured(ToUintPtr(MethodCast(method)->GetInstructions()) + pc);
+}
+
+size_t PandaRuntimeInterface::GetTenuredTLABMaxSize() const
+{
+    return Mutator::GetCurrent()->GetVM()->GetHeapManager()->GetTenuredTLABMaxAllocSize();
+}
+
 bool PandaRuntimeInterface::CanScalarReplaceObject(ClassPtr klass) const
 {
     auto cls = ClassCast(klass);
@@ -487,6 +487,10 @@ public:
                Logger::IsLoggingOn(Logger::Level::DEBUG, Logger::Component::MM_OBJECT_EVENTS);
     }
 
+    bool IsAllocationSitePretenured(MethodPtr method, uint32_t pc) const override;
+
+    size_t GetTenuredTLABMaxSize() const override;
+
     /**********************************************************************************/
     /// Object information
     ClassPtr GetClass(MethodPtr method, IdType id) const override;
@@ -747,7 +751,7 @@ public:
             compilerWorker_ = internalAllocator_->New<CompilerTaskManagerWorker>(internalAllocator_, this);
         }
         InitializeWorker();
-        if (compiler::g_options.WasSetCompilerDumpJitStatsCsv()) {
+        if (compiler::JITStats::IsEnabled()) {
             jitStats_ = internalAllocator_->New<compiler::JITStats>(internalAllocator_);
         }
     }
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PANDA_RUNTIME_COMPILER_QUEUE_COST_PRIORITY_H_
+#define PANDA_RUNTIME_COMPILER_QUEUE_COST_PRIORITY_H_
+
+#include <limits>
+
+#include "libarkfile/bytecode_instruction-inl.h"
+#include "runtime/compiler_queue_counter_priority.h"
+#include "runtime/include/method-inl.h"
+
+namespace ark {
+
+/**
+ * The cost priority queue works mostly as counter priority queue (see description),
+ * but it sorts the methods by hotness per estimated compilation cost, so that a burst of small hot methods
+ * is not stuck behind a few huge ones.
+ * The hotness is the number of calls since the method was put into the queue plus one.
+ * The cost is estimated once, when the task is added, from the bytecode size and the number of call instructions,
+ * as every call is a possible inlining candidate.
+ * The estimation is passed with the task to the JIT statistics, so it can be compared with the real compilation time.
+ * This queue is thread unsafe (should be used under lock).
+ */
+class CompilerPriorityCostQueue : public CompilerPriorityCounterQueue {
+public:
+    explicit CompilerPriorityCostQueue(mem::InternalAllocatorPtr allocator, uint64_t maxLength, uint64_t taskLifeSpan,
+                                       uint32_t callCost)
+        : CompilerPriorityCounterQueue(allocator, maxLength, taskLifeSpan), callCost_(callCost)
+    {
+        SetQueueName("priority cost compilation queue");
+    }
+
+    /// @return estimated compilation cost of @param method in bytecode bytes, at least 1
+    static uint32_t EstimateCost(const Method *method, uint32_t callCost)
+    {
+        uint64_t cost = method->GetCodeSize();
+        Span<const uint8_t> instructions(method->GetInstructions(), method->GetCodeSize());
+        for (BytecodeInstruction inst(instructions.begin()); inst.GetAddress() < instructions.end();
+             inst = inst.GetNext()) {
+            if (inst.HasFlag(BytecodeInstruction::Flags::CALL)) {
+                cost += callCost;
+            }
+        }
+        return static_cast<uint32_t>(std::clamp<uint64_t>(cost, 1U, std::numeric_limits<uint32_t>::max()));
+    }
+
+protected:
+    void InitElement(CompilationQueueElement *element) override
+    {
+        auto &task = element->GetContext();
+        task.SetEstimatedCost(EstimateCost(task.GetMethod(), callCost_));
+    }
+
+    bool HasLowerPriority(const CompilationQueueElement *a, const CompilationQueueElement *b) const override
+    {
+        // Compare hotness(a) / cost(a) with hotness(b) / cost(b) as products to avoid division
+        auto lhs = static_cast<double>(GetHotness(a)) * b->GetContext().GetEstimatedCost();
+        auto rhs = static_cast<double>(GetHotness(b)) * a->GetContext().GetEstimatedCost();
+        if (lhs != rhs) {
+            return lhs < rhs;
+        }
+        return CompilerPriorityCounterQueue::HasLowerPriority(a, b);
+    }
+
+private:
+    static uint64_t GetHotness(const CompilationQueueElement *element)
+    {
+        // The counter is 0 when the method is put into the queue and is decremented by every call while waiting
+        auto counter = element->GetCounter();
+        return counter < 0 ? 1U + static_cast<uint64_t>(-counter) : 1U;
+    }
+
+    uint32_t callCost_;
+};
+
+}  // namespace ark
+
+#endif  // PANDA_RUNTIME_COMPILER_QUEUE_COST_PRIORITY_H_
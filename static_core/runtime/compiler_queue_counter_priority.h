@@ -92,9 +92,13 @@ public:
             LOG(DEBUG, COMPILATION_QUEUE) << "Empty " << queueName_ << ", return nothing";
             return CompilerTask();
         }
-        sort(queue_.begin(), queue_.end(), comparator_);
+        // Lower priority tasks go first, the task to compile is pulled from the end
+        sort(queue_.begin(), queue_.end(), [this](const CompilationQueueElement *a, const CompilationQueueElement *b) {
+            return HasLowerPriority(a, b);
+        });
         auto element = queue_.back();
         auto task = std::move(element->GetContext());
+        task.SetQueueWaitTime(time::GetCurrentTimeInMillis() - element->GetTimestamp());
         queue_.pop_back();
         allocator_->Delete(element);
         LOG(DEBUG, COMPILATION_QUEUE) << "Extract a task from a " << queueName_ << ": " << GetTaskDescription(task);
@@ -118,6 +122,7 @@ public:
         }
         LOG(DEBUG, COMPILATION_QUEUE) << "Add an element to a " << queueName_ << ": " << GetTaskDescription(ctx);
         auto element = allocator_->New<CompilationQueueElement>(std::move(ctx));
+        InitElement(element);
         // Sorting will be in Get function
         queue_.push_back(element);
     }
@@ -150,27 +155,28 @@ protected:
         queueName_ = name;
     }
 
-private:
-    class Comparator {
-    public:
-        bool operator()(CompilationQueueElement *a, CompilationQueueElement *b) const
-        {
-            if (a->GetCounter() == b->GetCounter()) {
-                // Use method name just in case?
-                if (a->GetTimestamp() == b->GetTimestamp()) {
-                    // The only way is a name
-                    // Again, as we pull from the end return reversed compare
-                    return strcmp(reinterpret_cast<const char *>(a->GetContext().GetMethod()->GetName().data),
-                                  reinterpret_cast<const char *>(b->GetContext().GetMethod()->GetName().data)) > 0;
-                }
-                // Low time is high priority (pull from the end)
-                return a->GetTimestamp() > b->GetTimestamp();
+    /// Called once for a new element before it is put into the queue
+    virtual void InitElement([[maybe_unused]] CompilationQueueElement *element) {}
+
+    /// Strict weak ordering of the queue, @return true if @param a should be compiled after @param b
+    virtual bool HasLowerPriority(const CompilationQueueElement *a, const CompilationQueueElement *b) const
+    {
+        if (a->GetCounter() == b->GetCounter()) {
+            // Use method name just in case?
+            if (a->GetTimestamp() == b->GetTimestamp()) {
+                // The only way is a name
+                // Again, as we pull from the end return reversed compare
+                return strcmp(reinterpret_cast<const char *>(a->GetContext().GetMethod()->GetName().data),
+                              reinterpret_cast<const char *>(b->GetContext().GetMethod()->GetName().data)) > 0;
             }
-            // First, handle a method with higher hotness (less counter)
-            return (a->GetCounter() > b->GetCounter());
+            // Low time is high priority (pull from the end)
+            return a->GetTimestamp() > b->GetTimestamp();
         }
-    };
+        // First, handle a method with higher hotness (less counter)
+        return (a->GetCounter() > b->GetCounter());
+    }
 
+private:
     void UpdateQueue()
     {
         // Remove expired tasks
@@ -193,7 +199,6 @@ private:
     }
     mem::InternalAllocatorPtr allocator_;
     PandaVector<CompilationQueueElement *> queue_;
-    Comparator comparator_;
     uint64_t maxLength_;
     // In milliseconds
     uint64_t taskLifeSpan_;
@@ -17,6 +17,7 @@
 #include "runtime/compiler_thread_pool_worker.h"
 #include "runtime/compiler_queue_simple.h"
 #include "runtime/compiler_queue_aged_counter_priority.h"
+#include "runtime/compiler_queue_cost_priority.h"
 #include "runtime/include/mutator.h"
 #include "compiler/inplace_task_runner.h"
 
@@ -28,7 +29,8 @@ CompilerThreadPoolWorker::CompilerThreadPoolWorker(mem::InternalAllocatorPtr int
 {
     queue_ = CreateJITTaskQueue(noAsyncJit ? "simple" : options.GetCompilerQueueType(),
                                 options.GetCompilerQueueMaxLength(), options.GetCompilerTaskLifeSpan(),
-                                options.GetCompilerDeathCounterValue(), options.GetCompilerEpochDuration());
+                                options.GetCompilerDeathCounterValue(), options.GetCompilerEpochDuration(),
+                                options.GetCompilerQueueCallCost());
     if (queue_ == nullptr) {
         // Because of problems (no memory) in allocator
         LOG(ERROR, COMPILER) << "Cannot create a compiler queue";
@@ -46,7 +48,7 @@ CompilerThreadPoolWorker::~CompilerThreadPoolWorker()
 
 CompilerQueueInterface *CompilerThreadPoolWorker::CreateJITTaskQueue(const std::string &queueType, uint64_t maxLength,
                                                                      uint64_t taskLife, uint64_t deathCounter,
-                                                                     uint64_t epochDuration)
+                                                                     uint64_t epochDuration, uint32_t callCost)
 {
     LOG(DEBUG, COMPILER) << "Creating " << queueType << " task queue";
     if (queueType == "simple") {
@@ -59,6 +61,9 @@ CompilerQueueInterface *CompilerThreadPoolWorker::CreateJITTaskQueue(const std::
         return internalAllocator_->New<CompilerPriorityAgedCounterQueue>(internalAllocator_, taskLife, deathCounter,
                                                                          epochDuration);
     }
+    if (queueType == "cost-priority") {
+        return internalAllocator_->New<CompilerPriorityCostQueue>(internalAllocator_, maxLength, taskLife, callCost);
+    }
     LOG(FATAL, COMPILER) << "Unknown queue type";
     return nullptr;
 }
@@ -76,6 +81,8 @@ void CompilerProcessor::InPlaceCompileMethod(CompilerTask &&ctx)
     compilerCtx.SetMethod(ctx.GetMethod());
     compilerCtx.SetOsr(ctx.IsOsr());
     compilerCtx.SetVM(ctx.GetVM());
+    compilerCtx.SetQueueWaitTime(ctx.GetQueueWaitTime());
+    compilerCtx.SetEstimatedCost(ctx.GetEstimatedCost());
 
     // Set current thread to have access to vm during compilation
     Mutator compilerThread(ctx.GetVM(), Mutator::MutatorType::COMPILER);
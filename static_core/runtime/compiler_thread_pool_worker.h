@@ -79,7 +79,7 @@ public:
 
 private:
     CompilerQueueInterface *CreateJITTaskQueue(const std::string &queueType, uint64_t maxLength, uint64_t taskLife,
-                                               uint64_t deathCounter, uint64_t epochDuration);
+                                               uint64_t deathCounter, uint64_t epochDuration, uint32_t callCost);
 
     // This queue is used only in ThreadPool. Do not use it from this class.
     CompilerQueueInterface *queue_ {nullptr};
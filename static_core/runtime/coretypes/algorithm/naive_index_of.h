@@ -16,6 +16,7 @@
 #ifndef PANDA_RUNTIME_CORETYPES_ALGORITHM_NAIVE_INDEXOF
 #define PANDA_RUNTIME_CORETYPES_ALGORITHM_NAIVE_INDEXOF
 
+#include "common_interfaces/objects/string/string_kernels.h"
 #include "runtime/coretypes/algorithm/safepoint_provider.h"
 #include "runtime/coretypes/algorithm/string_handle_view.h"
 #include "runtime/include/coretypes/string_flatten.h"
@@ -113,6 +114,13 @@ int32_t TestTheKey(int i, Span<const S> &lhs, int32_t first, Span<const P> &rhs,
     return -1;
 }
 
+// Skips the chars of the subject which differ from the first char of the pattern
+template <typename S>
+int32_t NextCandidate(Span<const S> &lhs, int32_t from, int32_t end, int32_t first)
+{
+    return static_cast<int32_t>(ark::mem::string_kernels::FindChar(lhs.data(), from, end, first));
+}
+
 template <typename S, typename P>
 int32_t IndexOf(StringHandleView subj, StringHandleView pattern, int32_t pos, int32_t max, ManagedThread *mThread)
 {
@@ -123,9 +131,9 @@ int32_t IndexOf(StringHandleView subj, StringHandleView pattern, int32_t pos, in
     int i = pos;
     int e = 0;
     for (int n = 0; n < batches; ++n) {
-        for (i = pos + n * CMP_FIRST_BETWEEN_SAFEPOINTS_THRESHOLD,
-            e = pos + (n + 1) * CMP_FIRST_BETWEEN_SAFEPOINTS_THRESHOLD;
-             i < e; ++i) {
+        e = pos + (n + 1) * CMP_FIRST_BETWEEN_SAFEPOINTS_THRESHOLD;
+        for (i = NextCandidate(lhsSp, pos + n * CMP_FIRST_BETWEEN_SAFEPOINTS_THRESHOLD, e, first); i < e;
+             i = NextCandidate(lhsSp, i + 1, e, first)) {
             auto ret = TestTheKey(i, lhsSp, first, rhsSp, sp);
             if (ret != -1) {
                 return ret;
@@ -134,7 +142,7 @@ int32_t IndexOf(StringHandleView subj, StringHandleView pattern, int32_t pos, in
         sp.PutSafepoint(lhsSp, rhsSp);
     }
     ASSERT(max - pos - i < CMP_FIRST_BETWEEN_SAFEPOINTS_THRESHOLD);
-    for (; i <= max; ++i) {
+    for (i = NextCandidate(lhsSp, i, max + 1, first); i <= max; i = NextCandidate(lhsSp, i + 1, max + 1, first)) {
         auto ret = TestTheKey(i, lhsSp, first, rhsSp, sp);
         if (ret != -1) {
             return ret;
@@ -415,6 +415,25 @@ extern "C" ObjectHeader *CreateObjectByClassEntrypoint(Class *klass)
     UNREACHABLE();
 }
 
+extern "C" ObjectHeader *CreateTenuredObjectByClassEntrypoint(Class *klass)
+{
+    BEGIN_ENTRYPOINT();
+
+    // We need annotation here for the FullMemoryBarrier used in ClassLinker::AvoidLoadedClassPointerLeak
+    TSAN_ANNOTATE_HAPPENS_AFTER(klass);
+    auto *thread = ManagedThread::GetCurrent();
+    if (klass->IsStringClass() || !klass->IsInstantiable() ||
+        thread->GetVM()->GetGC()->GetAllocationSiteTracker() == nullptr) {
+        return CreateObjectByClassEntrypoint(klass);
+    }
+    auto *obj = thread->GetVM()->GetHeapManager()->AllocateTenuredObject(klass, klass->GetObjectSize(), thread);
+    if (UNLIKELY(obj == nullptr)) {
+        HandlePendingException();
+        UNREACHABLE();
+    }
+    return obj;
+}
+
 extern "C" ObjectHeader *CloneObjectEntrypoint(ObjectHeader *obj)
 {
     BEGIN_ENTRYPOINT();
@@ -1438,7 +1457,7 @@ extern "C" coretypes::Array *CreateMultiDimensionalArrayById(ManagedThread *thre
     return nullptr;
 }
 
-extern "C" ObjectHeader *CreateObjectByClassInterpreter(ManagedThread *thread, Class *klass)
+extern "C" ObjectHeader *CreateObjectByClassInterpreter(ManagedThread *thread, Class *klass, const uint8_t *pc)
 {
     ASSERT(klass != nullptr);
     ASSERT(!klass->IsArrayClass());
@@ -1450,7 +1469,7 @@ extern "C" ObjectHeader *CreateObjectByClassInterpreter(ManagedThread *thread, C
         }
     }
 
-    return interpreter::RuntimeInterface::CreateObject(thread, klass);
+    return interpreter::RuntimeInterface::CreateObject(thread, klass, pc);
 }
 
 extern "C" uint32_t CheckCastByIdEntrypoint(ObjectHeader *obj, Class *klass)
@@ -1589,8 +1608,13 @@ extern "C" Method *ResolveVirtualMethod(const Method *callee, Frame *frame, cons
     ASSERT(IsAddressInObjectsHeap(obj));
     auto *cls = obj->ClassAddr<Class>();
     ASSERT(cls != nullptr);
-    auto *resolved = cls->ResolveVirtualMethod(callee);
-    ASSERT(resolved != nullptr);
+    auto *cache = ManagedThread::GetCurrent()->GetInterpreterCache();
+    auto *resolved = cache->GetVirtualMethod(pc, caller, cls);
+    if (resolved == nullptr) {
+        resolved = cls->ResolveVirtualMethod(callee);
+        ASSERT(resolved != nullptr);
+        cache->SetVirtualMethod(pc, caller, cls, resolved);
+    }
 
     ProfilingData *profData = caller->GetProfilingData();
     auto bytecodeOffset = pc - frame->GetInstruction();
@@ -50,6 +50,8 @@ struct CoroutineManagerConfig {
     const bool enableExternalTimer = false;
     /// Number of exclusive workers created for runtime needs
     const uint32_t preallocatedExclusiveWorkersCount = 0;
+    /// Launch coroutines on the current worker and let idle workers steal them
+    const bool enableWorkStealing = false;
 
     CoroutineManagerConfig() = delete;
 };
@@ -71,7 +73,9 @@ enum class WorkerSelectionPolicy {
     /// choose the least busy worker
     LEAST_LOADED,
     /// choose the busiest worker
-    MOST_LOADED
+    MOST_LOADED,
+    /// choose the current worker if possible and rely on idle workers stealing the work, otherwise LEAST_LOADED
+    WORK_STEALING
 };
 
 /**
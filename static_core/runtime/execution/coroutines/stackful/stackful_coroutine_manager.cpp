@@ -529,7 +529,9 @@ StackfulCoroutineWorker *StackfulCoroutineManager::ChooseWorkerForCoroutine(Coro
 {
     ASSERT(co != nullptr);
     auto maskValue = co->GetJob()->GetAffinityMask();
-    return ChooseWorkerImpl(WorkerSelectionPolicy::LEAST_LOADED, maskValue);
+    auto policy =
+        GetConfig().enableWorkStealing ? WorkerSelectionPolicy::WORK_STEALING : WorkerSelectionPolicy::LEAST_LOADED;
+    return ChooseWorkerImpl(policy, maskValue);
 }
 
 AffinityMask StackfulCoroutineManager::CalcAffinityMask(const JobWorkerThreadGroup::Id &groupId)
@@ -604,7 +606,13 @@ LaunchResult StackfulCoroutineManager::LaunchImpl(Job *job, const JobWorkerThrea
         }
         Coroutine::GetCurrent()->OnChildCoroutineCreated(co);
         if (startEvent == nullptr) {
-            w->AddRunnableCoroutine(co);
+            bool isStealable = GetConfig().enableWorkStealing && (w == GetCurrentWorker()) &&
+                               w->TryAddStealableCoroutine(co);
+            if (isStealable) {
+                WakeUpWorkerForStealing(w);
+            } else {
+                w->AddRunnableCoroutine(co);
+            }
         } else {
             w->AddCoroutineWaitingForStart(startEvent, co);
         }
@@ -1044,15 +1052,62 @@ bool StackfulCoroutineManager::MigrateCoroutinesInward(StackfulCoroutineWorker *
     return res;
 }
 
+bool StackfulCoroutineManager::StealCoroutinesInward(StackfulCoroutineWorker *thief)
+{
+    if (!GetConfig().enableWorkStealing || !thief->CanStealCoroutines()) {
+        return false;
+    }
+
+    os::memory::LockHolder lkWorkers(workersLock_);
+    if (workers_.size() < 2U) {
+        return false;
+    }
+    // start from different victims on different thieves in order to reduce the contention
+    auto it = std::next(workers_.begin(), static_cast<ptrdiff_t>(thief->GetId() % workers_.size()));
+    for (size_t i = 0; i < workers_.size(); ++i, ++it) {
+        if (it == workers_.end()) {
+            it = workers_.begin();
+        }
+        auto *victim = *it;
+        if (victim == thief) {
+            continue;
+        }
+        auto *co = victim->StealCoroutine();
+        if (co == nullptr) {
+            continue;
+        }
+        if (!co->GetJob()->GetAffinityMask().IsWorkerAllowed(thief->GetId())) {
+            // the victim will execute the coroutine by itself
+            victim->AddRunnableCoroutine(co);
+            continue;
+        }
+        LOG(DEBUG, COROUTINES) << "steal coro " << co->GetCoroutineId() << " from " << victim->GetId() << " to "
+                               << thief->GetId();
+        // the coroutine has not been started yet, so there is no need to update its cached objects
+        thief->AddRunnableCoroutine(co);
+        return true;
+    }
+    return false;
+}
+
+void StackfulCoroutineManager::WakeUpWorkerForStealing(StackfulCoroutineWorker *victim)
+{
+    for (auto *w : workers_) {
+        if (w != victim && w->CanStealCoroutines() && w->WakeUpIfWaiting()) {
+            return;
+        }
+    }
+}
+
 StackfulCoroutineWorker *StackfulCoroutineManager::ChooseWorkerImpl(WorkerSelectionPolicy policy, AffinityMask mask)
 {
     auto preferFirstOverSecond = [policy](const StackfulCoroutineWorker *first, const StackfulCoroutineWorker *second) {
-        // choosing the least loaded worker from the allowed worker set
-        if (policy == WorkerSelectionPolicy::LEAST_LOADED) {
-            return first->GetLoadFactor() < second->GetLoadFactor();
-        }
         // choosing the most loaded worker from the allowed worker set
-        return first->GetLoadFactor() > second->GetLoadFactor();
+        if (policy == WorkerSelectionPolicy::MOST_LOADED) {
+            return first->GetLoadFactor() > second->GetLoadFactor();
+        }
+        // choosing the least loaded worker from the allowed worker set
+        return first->GetLoadFactor() < second->GetLoadFactor();
     };
 
     if (workers_.empty()) {
@@ -1074,6 +1129,15 @@ StackfulCoroutineWorker *StackfulCoroutineManager::ChooseWorkerImpl(WorkerSelect
     if (UNLIKELY(suitableWorkers.empty())) {
         return nullptr;
     }
+    if (policy == WorkerSelectionPolicy::WORK_STEALING) {
+        // keep the coroutine on the current worker, idle workers will steal it if needed
+        auto *current = GetCurrentWorker();
+        if (current != nullptr && current->CanStealCoroutines() &&
+            std::find(suitableWorkers.begin(), suitableWorkers.end(), current) != suitableWorkers.end()) {
+            LOG(DEBUG, COROUTINES) << "Chose current worker: " << current->GetName();
+            return current;
+        }
+    }
     auto wIt = std::min_element(suitableWorkers.begin(), suitableWorkers.end(), preferFirstOverSecond);
     LOG(DEBUG, COROUTINES) << "Chose worker: " << (*wIt)->GetName();
 
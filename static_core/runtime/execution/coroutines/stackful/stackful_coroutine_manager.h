@@ -121,6 +121,8 @@ public:
 
     /// migrate coroutines from other workers to the 'to' worker
     bool MigrateCoroutinesInward(StackfulCoroutineWorker *to);
+    /// steal a not yet started coroutine from other workers to the 'thief' worker (work stealing mode only)
+    bool StealCoroutinesInward(StackfulCoroutineWorker *thief);
 
     /// trigger the managerThread to migrate
     void TriggerMigration();
@@ -217,6 +219,8 @@ private:
 
     StackfulCoroutineWorker *ChooseWorkerImpl(WorkerSelectionPolicy policy, AffinityMask maskValue)
         REQUIRES(workersLock_);
+    /// wake up an idle worker, so it could steal the coroutines launched on the 'victim' worker
+    void WakeUpWorkerForStealing(StackfulCoroutineWorker *victim) REQUIRES(workersLock_);
 
     /**
      * @brief Calculate worker limits based on configuration
@@ -56,6 +56,43 @@ void StackfulCoroutineWorker::AddRunnableCoroutine(Coroutine *newCoro)
     RegisterIncomingActiveCoroutine(newCoro);
 }
 
+bool StackfulCoroutineWorker::TryAddStealableCoroutine(Coroutine *newCoro)
+{
+    ASSERT(newCoro != nullptr);
+    // precondition: called within the current worker, no cross-worker calls allowed
+    ASSERT(GetCurrentContext()->GetWorker() == this);
+    if (!CanStealCoroutines() || newCoro->GetType() != Coroutine::Type::MUTATOR ||
+        newCoro->GetPriority() != CoroutinePriority::MEDIUM_PRIORITY ||
+        newCoro->GetJob()->GetAffinityMask().NumAllowedWorkers() <= 1U) {
+        return false;
+    }
+    RegisterIncomingActiveCoroutine(newCoro);
+    // no runnablesLock_ here: the load factor gets updated on the next scheduling step
+    stealables_.PushBottom(newCoro);
+    return true;
+}
+
+Coroutine *StackfulCoroutineWorker::StealCoroutine()
+{
+    return stealables_.Steal();
+}
+
+bool StackfulCoroutineWorker::CanStealCoroutines() const
+{
+    return !IsMainWorker() && !InExclusiveMode() && !IsDisabledForCrossWorkersLaunch();
+}
+
+bool StackfulCoroutineWorker::WakeUpIfWaiting()
+{
+    // Atomic with relaxed order reason: the flag is a hint, the signal itself is sent under the lock
+    if (!waitingForRunnables_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    os::memory::LockHolder lock(runnablesLock_);
+    runnablesCv_.Signal();
+    return true;
+}
+
 void StackfulCoroutineWorker::AddRunningCoroutine(Coroutine *newCoro)
 {
     ASSERT(newCoro != nullptr);
@@ -227,7 +264,7 @@ void StackfulCoroutineWorker::ExecuteJobsUntilIdle()
     // CC-OFFNXT(G.CTL.03): false positive
     while (true) {
         lock(waitersLock_, runnablesLock_);
-        if (runnables_.Size() > 1) {
+        if (runnables_.Size() + stealables_.SizeApprox() > 1) {
             unlock(waitersLock_, runnablesLock_);
             coroManager_->ExecuteJobs();
         } else if (!waiters_.empty()) {
@@ -256,7 +293,7 @@ void StackfulCoroutineWorker::CompleteAllAffinedCoroutines()
 bool StackfulCoroutineWorker::HasPendingLocalJobs()
 {
     os::memory::ScopedLock lock(waitersLock_, runnablesLock_);
-    if (!waiters_.empty()) {
+    if (!waiters_.empty() || !stealables_.IsEmptyApprox()) {
         return true;
     }
 
@@ -314,6 +351,9 @@ size_t StackfulCoroutineWorker::GetRunnablesCount(Coroutine::Type type)
             runnablesCount++;
         }
     });
+    if (type == Coroutine::Type::MUTATOR) {
+        runnablesCount += stealables_.SizeApprox();
+    }
     return runnablesCount;
 }
 
@@ -373,6 +413,7 @@ void StackfulCoroutineWorker::PushToRunnableQueue(Coroutine *co, CoroutinePriori
 Coroutine *StackfulCoroutineWorker::PopFromRunnableQueue()
 {
     os::memory::LockHolder lock(runnablesLock_);
+    StageStealableCoroutine();
     ASSERT(!runnables_.Empty());
     auto [co, _] = runnables_.Pop();
     UpdateLoadFactor();
@@ -385,17 +426,33 @@ bool StackfulCoroutineWorker::RunnableCoroutinesExist() const
     return !runnables_.Empty();
 }
 
+void StackfulCoroutineWorker::StageStealableCoroutine()
+{
+    // take from the top end in order to keep the launch order
+    auto *co = stealables_.Steal();
+    if (co != nullptr) {
+        runnables_.Push(co, co->GetPriority());
+    }
+}
+
 void StackfulCoroutineWorker::WaitForRunnables(uint64_t waitingTimeMs)
 {
-    // NOTE(konstanting): in case of work stealing, use timed wait and try periodically to steal some runnables
+    // in case of work stealing, use timed wait and try periodically to steal some runnables
+    if (coroManager_->GetConfig().enableWorkStealing && CanStealCoroutines()) {
+        waitingTimeMs = std::min(waitingTimeMs, STEAL_POLL_INTERVAL_MS);
+    }
     while (!RunnableCoroutinesExist() && IsActive()) {
         // profiling: no need to profile the SLEEPING state, closing the interval
         stats_.FinishInterval(JobTimeStats::SCH_ALL);
+        // Atomic with relaxed order reason: the flag is a hint, it is read before taking runnablesLock_
+        waitingForRunnables_.store(true, std::memory_order_relaxed);
         if (waitingTimeMs != WAITING_TIME_UNLIMITED) {
             runnablesCv_.TimedWait(&runnablesLock_, waitingTimeMs);
         } else {
             runnablesCv_.Wait(&runnablesLock_);
         }
+        // Atomic with relaxed order reason: the flag is a hint, it is read before taking runnablesLock_
+        waitingForRunnables_.store(false, std::memory_order_relaxed);
 
         // profiling: reopening the interval after the sleep
         stats_.StartInterval(JobTimeStats::SCH_ALL);
@@ -425,7 +482,10 @@ void StackfulCoroutineWorker::RequestScheduleImpl()
     ASSERT(GetCurrentContext()->GetWorker() == this);
     ASSERT_NATIVE_CODE();
 
-    // NOTE(konstanting): implement coro migration, work stealing, etc.
+    {
+        os::memory::LockHolder lock(runnablesLock_);
+        StageStealableCoroutine();
+    }
     if (RunnableCoroutinesExist()) {
         runnablesLock_.Lock();
         SuspendCurrentCoroAndScheduleNext();
@@ -439,6 +499,10 @@ void StackfulCoroutineWorker::RequestScheduleImpl()
             allCoroutinesExecuted_.Happen();
         }
 
+        if (coroManager_->StealCoroutinesInward(this)) {
+            return;
+        }
+
         bool migrationHappened = coroManager_->MigrateCoroutinesInward(this);
         if (migrationHappened) {
             return;
@@ -577,7 +641,7 @@ void StackfulCoroutineWorker::FinalizeTerminatedCoros()
 
 void StackfulCoroutineWorker::UpdateLoadFactor()
 {
-    loadFactor_ = (loadFactor_ + runnables_.Size()) / 2U;
+    loadFactor_ = (loadFactor_ + runnables_.Size() + stealables_.SizeApprox()) / 2U;
 }
 
 void StackfulCoroutineWorker::EnsureCoroutineSwitchEnabled(Coroutine *coro)
@@ -674,6 +738,7 @@ void StackfulCoroutineWorker::OnAfterContextSwitch(StackfulCoroutineContext *to)
 void StackfulCoroutineWorker::CacheLocalObjectsInExecutionCtx()
 {
     os::memory::LockHolder lock(runnablesLock_);
+    // stealables_ are skipped: the coroutines there have not been started yet and update the objects on startup
     runnables_.IterateOverElements([](Coroutine *co) { co->UpdateCachedObjects(); });
     {
         os::memory::LockHolder lh(waitersLock_);
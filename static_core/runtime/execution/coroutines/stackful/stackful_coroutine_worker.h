@@ -22,6 +22,7 @@
 #include "runtime/execution/coroutines/stackful/stackful_common.h"
 #include "runtime/execution/job_stats.h"
 #include "runtime/execution/priority_queue.h"
+#include "runtime/execution/work_stealing_deque.h"
 #include "runtime/include/external_callback_poster.h"
 
 #include "runtime/execution/coroutines/stackful/stackful_coroutine_state_info.h"
@@ -87,6 +88,30 @@ public:
      */
     void AddRunnableCoroutine(Coroutine *newCoro);
 
+    /**
+     * @brief Adds a newly launched coroutine to the worker-local lock-free queue, so that idle workers can steal it.
+     * Only not yet started MUTATOR coroutines with the default priority are accepted.
+     * NOTE: precondition: called within the current worker, no cross-worker calls allowed
+     * @param newCoro coroutine to add
+     * @return false if the coroutine cannot be stolen, the caller should use AddRunnableCoroutine() then
+     */
+    bool TryAddStealableCoroutine(Coroutine *newCoro);
+
+    /**
+     * @brief Takes the oldest coroutine from the stealable queue. Can be called from any thread.
+     * @return the coroutine or nullptr if there is nothing to steal
+     */
+    Coroutine *StealCoroutine();
+
+    /// @return true if the worker can host coroutines stolen from other workers
+    bool CanStealCoroutines() const;
+
+    /**
+     * @brief Wakes the worker up if it waits for runnables, so it could try to steal some
+     * @return true if the worker was waiting
+     */
+    bool WakeUpIfWaiting();
+
     /**
      * @brief Registers the RUNNING coroutine in the worker's structures.
      * Any incoming running coroutine should be added via this interface! And vice versa: no
@@ -199,6 +224,8 @@ private:
     void PushToRunnableQueue(Coroutine *co, CoroutinePriority priority) REQUIRES(runnablesLock_);
     Coroutine *PopFromRunnableQueue();
     bool RunnableCoroutinesExist() const;
+    /// owner only: move the oldest coroutine from the stealable queue to the runnables queue
+    void StageStealableCoroutine() REQUIRES(runnablesLock_);
     /**
      * @brief Method waits for @param waitingTime ms, if waitingTimeMs == WAITING_TIME_UNLIMITED, will wait until signal
      * of runnablesCv_ condvar
@@ -269,6 +296,13 @@ private:  // data members
     mutable os::memory::RecursiveMutex runnablesLock_;
     os::memory::ConditionVariable runnablesCv_;
     PriorityQueue<Coroutine> runnables_ GUARDED_BY(runnablesLock_);
+    /**
+     * Not yet started coroutines launched by this worker in the work stealing mode. The owner pushes to and stages
+     * from it, idle workers steal from it. The coroutines from here are moved to runnables_ before execution.
+     */
+    WorkStealingDeque<Coroutine> stealables_;
+    // true while the worker waits for runnables in WaitForRunnables()
+    std::atomic<bool> waitingForRunnables_ = false;
     // blocked coros-related members: Coroutine AWAITS JobEvent
     mutable os::memory::Mutex waitersLock_;
     PandaMap<JobEvent *, Coroutine *> waiters_ GUARDED_BY(waitersLock_);
@@ -296,6 +330,9 @@ private:  // data members
     static constexpr uint32_t MAX_EXECUTION_DURATION_MS = 6000;
 
     static constexpr uint64_t WAITING_TIME_UNLIMITED = std::numeric_limits<uint64_t>::max();
+
+    // the interval between steal attempts of an idle worker in the work stealing mode
+    static constexpr uint64_t STEAL_POLL_INTERVAL_MS = 10;
 };
 
 }  // namespace ark
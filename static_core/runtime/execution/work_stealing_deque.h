@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_RUNTIME_EXECUTION_WORK_STEALING_DEQUE_H
+#define PANDA_RUNTIME_EXECUTION_WORK_STEALING_DEQUE_H
+
+#include "libarkbase/generated/coherency_line_size.h"
+#include "libarkbase/macros.h"
+#include "libarkbase/utils/math_helpers.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ark {
+
+/**
+ * @brief Lock-free work stealing deque (Chase-Lev).
+ *
+ * The owner thread pushes and pops elements at the bottom end, any other thread ("thief") takes elements from the
+ * top end. The owner may also take elements from the top end via Steal() when FIFO order is needed.
+ * The storage grows on demand. Retired buffers are kept until the deque is destroyed, because a concurrent thief
+ * may still read from them.
+ *
+ * See "Correct and Efficient Work-Stealing for Weak Memory Models" (Le, Pop, Cohen, Zappa Nardelli, PPoPP'13).
+ *
+ * @tparam Element type of the stored elements, the deque stores pointers to them
+ */
+template <typename Element>
+class WorkStealingDeque {
+    class Buffer {
+    public:
+        explicit Buffer(size_t capacity) : mask_(capacity - 1U), slots_(capacity)
+        {
+            ASSERT(helpers::math::IsPowerOfTwo(capacity));
+        }
+
+        size_t Capacity() const
+        {
+            return mask_ + 1U;
+        }
+
+        Element *Get(int64_t index) const
+        {
+            // Atomic with relaxed order reason: ordering is provided by the top/bottom accesses
+            return slots_[static_cast<size_t>(index) & mask_].load(std::memory_order_relaxed);
+        }
+
+        void Put(int64_t index, Element *elem)
+        {
+            // Atomic with relaxed order reason: ordering is provided by the top/bottom accesses
+            slots_[static_cast<size_t>(index) & mask_].store(elem, std::memory_order_relaxed);
+        }
+
+    private:
+        size_t mask_;
+        std::vector<std::atomic<Element *>> slots_;
+    };
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64U;
+
+    explicit WorkStealingDeque(size_t capacity = DEFAULT_CAPACITY)
+    {
+        buffers_.push_back(std::make_unique<Buffer>(capacity));
+        // Atomic with relaxed order reason: the deque is not shared yet
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque() = default;
+
+    NO_COPY_SEMANTIC(WorkStealingDeque);
+    NO_MOVE_SEMANTIC(WorkStealingDeque);
+
+    /// Owner only: add an element to the bottom end
+    void PushBottom(Element *elem)
+    {
+        ASSERT(elem != nullptr);
+        // Atomic with relaxed order reason: only the owner modifies bottom
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        // Atomic with acquire order reason: synchronizes with thieves advancing top
+        int64_t top = top_.load(std::memory_order_acquire);
+        // Atomic with relaxed order reason: only the owner replaces the buffer
+        Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<int64_t>(buffer->Capacity()) - 1) {
+            buffer = Grow(buffer, top, bottom);
+        }
+        buffer->Put(bottom, elem);
+        std::atomic_thread_fence(std::memory_order_release);
+        // Atomic with relaxed order reason: published by the release fence above
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Owner only: take the most recently pushed element.
+     * @return the element or nullptr if the deque is empty
+     */
+    Element *PopBottom()
+    {
+        // Atomic with relaxed order reason: only the owner modifies bottom
+        int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        // Atomic with relaxed order reason: only the owner replaces the buffer
+        Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+        // Atomic with relaxed order reason: ordered by the seq_cst fence below
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // Atomic with relaxed order reason: ordered by the seq_cst fence above
+        int64_t top = top_.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            // the deque was empty
+            // Atomic with relaxed order reason: only the owner modifies bottom
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Element *elem = buffer->Get(bottom);
+        if (top == bottom) {
+            // the last element, compete with thieves for it
+            // Atomic with seq_cst order reason: total order with the thieves' CAS is required
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                elem = nullptr;
+            }
+            // Atomic with relaxed order reason: only the owner modifies bottom
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return elem;
+    }
+
+    /**
+     * Any thread: take the least recently pushed element.
+     * @return the element or nullptr if the deque is empty or the race for the element was lost
+     */
+    Element *Steal()
+    {
+        // Atomic with acquire order reason: synchronizes with other thieves and the owner
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // Atomic with acquire order reason: synchronizes with the owner's release fence in PushBottom
+        int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        // Atomic with acquire order reason: the buffer contents must be visible
+        Buffer *buffer = buffer_.load(std::memory_order_acquire);
+        Element *elem = buffer->Get(top);
+        // Atomic with seq_cst order reason: total order with the owner's CAS is required
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return elem;
+    }
+
+    /// @return the number of elements, the value may be outdated when the deque is accessed concurrently
+    size_t SizeApprox() const
+    {
+        // Atomic with relaxed order reason: the value is approximate by design
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        // Atomic with relaxed order reason: the value is approximate by design
+        int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0U;
+    }
+
+    bool IsEmptyApprox() const
+    {
+        return SizeApprox() == 0U;
+    }
+
+private:
+    Buffer *Grow(Buffer *old, int64_t top, int64_t bottom)
+    {
+        auto newBuffer = std::make_unique<Buffer>(old->Capacity() * 2U);
+        for (int64_t i = top; i < bottom; ++i) {
+            newBuffer->Put(i, old->Get(i));
+        }
+        Buffer *result = newBuffer.get();
+        buffers_.push_back(std::move(newBuffer));
+        // Atomic with release order reason: thieves must see the copied contents
+        buffer_.store(result, std::memory_order_release);
+        return result;
+    }
+
+    alignas(ark::COHERENCY_LINE_SIZE) std::atomic<int64_t> top_ {0};
+    alignas(ark::COHERENCY_LINE_SIZE) std::atomic<int64_t> bottom_ {0};
+    std::atomic<Buffer *> buffer_ {nullptr};
+    // owns the current buffer and all the retired ones
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+}  // namespace ark
+
+#endif  // PANDA_RUNTIME_EXECUTION_WORK_STEALING_DEQUE_H
@@ -46,6 +46,8 @@ public:
         method_ = task.method_;
         isOsr_ = task.isOsr_;
         vm_ = task.vm_;
+        queueWaitTime_ = task.queueWaitTime_;
+        estimatedCost_ = task.estimatedCost_;
         task.vm_ = nullptr;
         task.method_ = nullptr;
     }
@@ -55,6 +57,8 @@ public:
         method_ = task.method_;
         isOsr_ = task.isOsr_;
         vm_ = task.vm_;
+        queueWaitTime_ = task.queueWaitTime_;
+        estimatedCost_ = task.estimatedCost_;
         task.vm_ = nullptr;
         task.method_ = nullptr;
         return *this;
@@ -79,10 +83,34 @@ public:
         return vm_;
     }
 
+    /// Time in milliseconds the task spent in the compiler queue, set when the queue extracts it
+    uint64_t GetQueueWaitTime() const
+    {
+        return queueWaitTime_;
+    }
+
+    void SetQueueWaitTime(uint64_t queueWaitTime)
+    {
+        queueWaitTime_ = queueWaitTime;
+    }
+
+    /// Compilation cost estimated by a cost-aware queue, 0 if the queue does not estimate it
+    uint32_t GetEstimatedCost() const
+    {
+        return estimatedCost_;
+    }
+
+    void SetEstimatedCost(uint32_t estimatedCost)
+    {
+        estimatedCost_ = estimatedCost;
+    }
+
 private:
     Method *method_ {nullptr};
     bool isOsr_ {false};
     PandaVM *vm_ {nullptr};
+    uint64_t queueWaitTime_ {0};
+    uint32_t estimatedCost_ {0};
 };
 
 class Method;
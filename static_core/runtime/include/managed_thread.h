@@ -29,6 +29,10 @@
 namespace ark {
 class MTThreadManager;
 
+namespace mem {
+struct AllocationSamples;
+}  // namespace mem
+
 namespace test {
 class ThreadTest;
 class StackOverflowTest;
@@ -254,8 +258,33 @@ public:
 
     void UpdateTLAB(mem::TLAB *tlab);
 
+    /// Clear both the young and the tenured TLABs
     void ClearTLAB();
 
+    /// TLAB in tenured space used by the pretenured allocation sites
+    mem::TLAB *GetTenuredTLAB() const
+    {
+        ASSERT(tenuredTlab_ != nullptr);
+        return tenuredTlab_;
+    }
+
+    /**
+     * The objects allocated in the tenured TLAB are marked in the live bitmap of the region by the allocating code,
+     * so the words of the bitmap and the address of the first bit are cached with the TLAB
+     */
+    void UpdateTenuredTLAB(mem::TLAB *tlab, uintptr_t *liveBitmap, uintptr_t liveBitmapBegin);
+
+    void ClearTenuredTLAB();
+
+    /// @return objects sampled by the pretenuring, which are not passed to AllocationSiteTracker yet, or nullptr
+    mem::AllocationSamples *GetAllocationSamples() const
+    {
+        return allocationSamples_;
+    }
+
+    /// The samples are allocated on the first sampled object, so only the threads which run bytecode pay for them
+    mem::AllocationSamples *GetOrCreateAllocationSamples();
+
     void SetStringClassPtr(void *p)
     {
         stringClassPtr_ = p;
@@ -372,6 +401,18 @@ public:
     {
         return MEMBER_OFFSET(ManagedThread, tlab_);
     }
+    static constexpr uint32_t GetTenuredTLABOffset()
+    {
+        return MEMBER_OFFSET(ManagedThread, tenuredTlab_);
+    }
+    static constexpr uint32_t GetTenuredTLABLiveBitmapOffset()
+    {
+        return MEMBER_OFFSET(ManagedThread, tenuredTlabLiveBitmap_);
+    }
+    static constexpr uint32_t GetTenuredTLABLiveBitmapBeginOffset()
+    {
+        return MEMBER_OFFSET(ManagedThread, tenuredTlabLiveBitmapBegin_);
+    }
     static constexpr uint32_t GetTlsStringClassPointerOffset()
     {
         return MEMBER_OFFSET(ManagedThread, stringClassPtr_);
@@ -818,6 +859,10 @@ private:
     ObjectHeader *longToStringCache_ {nullptr};
 
     mem::TLAB *tlab_ {nullptr};
+    mem::TLAB *tenuredTlab_ {nullptr};
+    uintptr_t *tenuredTlabLiveBitmap_ {nullptr};
+    uintptr_t tenuredTlabLiveBitmapBegin_ {0};
+    mem::AllocationSamples *allocationSamples_ {nullptr};
     // Thread local storages to avoid locks in heap manager
     mem::StackFrameAllocator *stackFrameAllocator_;
     mem::InternalAllocator<>::LocalSmallObjectAllocator *internalLocalAllocator_;
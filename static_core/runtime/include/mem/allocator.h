@@ -783,6 +783,16 @@ public:
     virtual void *AllocateTenured(size_t size) = 0;
     virtual void *AllocateTenuredWithoutLocks(size_t size) = 0;
 
+    /**
+     * @brief Create a TLAB in tenured space for the pretenured objects.
+     * The allocating code must mark the objects in the live bitmap of the region.
+     * @return nullptr if the allocator doesn't support tenured TLABs or there is no memory
+     */
+    virtual TLAB *CreateNewTenuredTLAB([[maybe_unused]] size_t tlabSize)
+    {
+        return nullptr;
+    }
+
     NO_COPY_SEMANTIC(ObjectAllocatorGenBase);
     NO_MOVE_SEMANTIC(ObjectAllocatorGenBase);
 
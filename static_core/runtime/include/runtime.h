@@ -459,6 +459,8 @@ public:
 
     PandaString GetMemoryStatistics();
 
+    PandaString GetInterpreterCacheStatistics();
+
     Expected<LanguageContext, Error> ExtractLanguageContext(const panda_file::File *pf, std::string_view entryPoint);
 
     UnwindStackFn GetUnwindStackFn() const
@@ -516,6 +518,10 @@ private:
 
     void SetPandaPath();
 
+    void PrewarmPandaCache();
+
+    void SavePandaCacheSnapshot() const;
+
     void SetThreadClassPointers();
 
     bool Initialize();
@@ -16,13 +16,31 @@
 #define PANDA_INTERPRETER_CACHE_H_
 
 #include <array>
+#include <atomic>
 #include "libarkbase/utils/math_helpers.h"
+#include "runtime/include/mem/panda_smart_pointers.h"
 #include "runtime/include/method.h"
 
+// Hits and misses of the call site cache are counted in the debug builds or with PANDA_INTERPRETER_CACHE_STATISTICS
+#if !defined(NDEBUG) && !defined(PANDA_INTERPRETER_CACHE_STATISTICS)
+#define PANDA_INTERPRETER_CACHE_STATISTICS
+#endif
+
 namespace ark {
 
 class InterpreterCache {
 public:
+    InterpreterCache() = default;
+    ~InterpreterCache()
+    {
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+        // Keep the counters of the finished threads for the statistics
+        RetireCallSiteStats();
+#endif
+    }
+    NO_COPY_SEMANTIC(InterpreterCache);
+    NO_MOVE_SEMANTIC(InterpreterCache);
+
     bool Has(const void *pc, Method *caller) const
     {
         const auto &entry = data_[GetIndex(pc)];
@@ -47,6 +65,9 @@ public:
     void Clear()
     {
         data_.fill({});
+        if (callSites_ != nullptr) {
+            callSites_->fill({});
+        }
     }
 
     static constexpr size_t N = 256;
@@ -62,14 +83,168 @@ public:
         return &data_[GetIndex(pc)];
     }
 
+    // Polymorphic inline cache of the virtual and interface calls, up to CLASSES_COUNT receivers per call site.
+    // The table is allocated on the first virtual call, so the threads which do not run bytecode do not pay for it
+    static constexpr size_t CALL_SITES_N = 128;
+    static constexpr size_t CLASSES_COUNT = 4;
+
+    struct CallSiteEntry {
+        const void *pc {nullptr};
+        Method *caller {nullptr};
+        std::array<const Class *, CLASSES_COUNT> classes {};
+        std::array<Method *, CLASSES_COUNT> methods {};
+    };
+
+    struct CallSiteStats {
+        uint64_t hits {0};
+        uint64_t misses {0};
+        // Misses of the call sites, which have more than CLASSES_COUNT receivers
+        uint64_t megamorphicMisses {0};
+
+        CallSiteStats &operator+=(const CallSiteStats &other)
+        {
+            hits += other.hits;
+            misses += other.misses;
+            megamorphicMisses += other.megamorphicMisses;
+            return *this;
+        }
+    };
+
+    /// Returns the method resolved for the receiver class @param cls at the call site or nullptr
+    Method *GetVirtualMethod(const void *pc, Method *caller, const Class *cls)
+    {
+        if (UNLIKELY(callSites_ == nullptr)) {
+            CountMiss();
+            return nullptr;
+        }
+        const auto &entry = (*callSites_)[GetCallSiteIndex(pc)];
+        if (LIKELY(entry.pc == pc && entry.caller == caller)) {
+            for (size_t i = 0; i < CLASSES_COUNT && entry.classes[i] != nullptr; ++i) {
+                if (entry.classes[i] == cls) {
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+                    Increment(&hits_);
+#endif
+                    return entry.methods[i];
+                }
+            }
+        }
+        CountMiss();
+        return nullptr;
+    }
+
+    void SetVirtualMethod(const void *pc, Method *caller, const Class *cls, Method *method)
+    {
+        if (UNLIKELY(callSites_ == nullptr)) {
+            callSites_ = MakePandaUnique<CallSiteTable>();
+        }
+        auto &entry = (*callSites_)[GetCallSiteIndex(pc)];
+        if (entry.pc != pc || entry.caller != caller) {
+            entry = {pc, caller, {cls}, {method}};
+            return;
+        }
+        for (size_t i = 0; i < CLASSES_COUNT; ++i) {
+            if (entry.classes[i] == nullptr) {
+                entry.classes[i] = cls;
+                entry.methods[i] = method;
+                return;
+            }
+        }
+        // Megamorphic call site, replacing receivers would only thrash the entry
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+        Increment(&megamorphicMisses_);
+#endif
+    }
+
+    CallSiteStats GetCallSiteStats() const
+    {
+        CallSiteStats stats;
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+        // Atomic with relaxed order reason: data race with hits_ of the owning thread, the statistics only
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        // Atomic with relaxed order reason: data race with misses_ of the owning thread, the statistics only
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        // Atomic with relaxed order reason: data race with megamorphicMisses_ of the owning thread, the statistics only
+        stats.megamorphicMisses = megamorphicMisses_.load(std::memory_order_relaxed);
+#endif
+        return stats;
+    }
+
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+    static CallSiteStats GetRetiredCallSiteStats()
+    {
+        CallSiteStats stats;
+        // Atomic with relaxed order reason: data race with retiredHits_ with no synchronization or ordering constraints
+        stats.hits = retiredHits_.load(std::memory_order_relaxed);
+        // Atomic with relaxed order reason: data race with retiredMisses_ with no synchronization or ordering
+        // constraints
+        stats.misses = retiredMisses_.load(std::memory_order_relaxed);
+        // Atomic with relaxed order reason: data race with retiredMegamorphicMisses_ with no synchronization or
+        // ordering constraints
+        stats.megamorphicMisses = retiredMegamorphicMisses_.load(std::memory_order_relaxed);
+        return stats;
+    }
+#endif
+
 private:
     static size_t GetIndex(const void *pc)
     {
         return ark::helpers::math::PowerOfTwoTableSlot(reinterpret_cast<size_t>(pc), N, 2U);
     }
 
+    static size_t GetCallSiteIndex(const void *pc)
+    {
+        return ark::helpers::math::PowerOfTwoTableSlot(reinterpret_cast<size_t>(pc), CALL_SITES_N, 2U);
+    }
+
+    void CountMiss()
+    {
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+        Increment(&misses_);
+#endif
+    }
+
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+    // Counters are written only by the owning thread, so they are not updated with the atomic read-modify-write
+    static void Increment(std::atomic<uint64_t> *counter)
+    {
+        // Atomic with relaxed order reason: only the owning thread writes the counter, others read the statistics
+        auto value = counter->load(std::memory_order_relaxed);
+        // Atomic with relaxed order reason: only the owning thread writes the counter, others read the statistics
+        counter->store(value + 1U, std::memory_order_relaxed);
+    }
+
+    void RetireCallSiteStats()
+    {
+        auto stats = GetCallSiteStats();
+        // Atomic with relaxed order reason: data race with retiredHits_ with no synchronization or ordering constraints
+        retiredHits_.fetch_add(stats.hits, std::memory_order_relaxed);
+        // Atomic with relaxed order reason: data race with retiredMisses_ with no synchronization or ordering
+        // constraints
+        retiredMisses_.fetch_add(stats.misses, std::memory_order_relaxed);
+        // Atomic with relaxed order reason: data race with retiredMegamorphicMisses_ with no synchronization or
+        // ordering constraints
+        retiredMegamorphicMisses_.fetch_add(stats.megamorphicMisses, std::memory_order_relaxed);
+    }
+#endif
+
     static_assert(ark::helpers::math::IsPowerOfTwo(N));
+    static_assert(ark::helpers::math::IsPowerOfTwo(CALL_SITES_N));
+    // Must be the first field, irtoc interpreter accesses it by the offset of the cache
     std::array<Entry, N> data_ {};
+    using CallSiteTable = std::array<CallSiteEntry, CALL_SITES_N>;
+    PandaUniquePtr<CallSiteTable> callSites_;
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+    std::atomic<uint64_t> hits_ {0};
+    std::atomic<uint64_t> misses_ {0};
+    std::atomic<uint64_t> megamorphicMisses_ {0};
+
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static inline std::atomic<uint64_t> retiredHits_ {0};
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static inline std::atomic<uint64_t> retiredMisses_ {0};
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static inline std::atomic<uint64_t> retiredMegamorphicMisses_ {0};
+#endif
 };
 
 }  // namespace ark
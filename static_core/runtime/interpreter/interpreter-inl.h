@@ -2051,7 +2051,7 @@ public:
         Class *klass = ResolveType<true>(id);
         if (LIKELY(klass != nullptr)) {
             this->GetFrame()->GetAcc() = this->GetAcc();
-            ObjectHeader *obj = RuntimeIfaceT::CreateObject(this->GetThread(), klass);
+            ObjectHeader *obj = RuntimeIfaceT::CreateObject(this->GetThread(), klass, this->GetInst().GetAddress());
             this->GetAcc() = this->GetFrame()->GetAcc();
             if (LIKELY(obj != nullptr)) {
                 this->GetFrameHandler().GetVReg(vd).SetReference(obj);
@@ -3666,12 +3666,18 @@ public:
         }
         auto *cls = obj->ClassAddr<Class>();
         ASSERT(cls != nullptr);
-        auto *resolved = cls->ResolveVirtualMethod(method);
-        ASSERT(resolved != nullptr);
+        auto *caller = this->GetFrame()->GetMethod();
+        auto *cache = this->GetThread()->GetInterpreterCache();
+        auto *resolved = cache->GetVirtualMethod(this->GetInst().GetAddress(), caller, cls);
+        if (resolved == nullptr) {
+            resolved = cls->ResolveVirtualMethod(method);
+            ASSERT(resolved != nullptr);
+            cache->SetVirtualMethod(this->GetInst().GetAddress(), caller, cls, resolved);
+        }
 
-        ProfilingData *profData = this->GetFrame()->GetMethod()->GetProfilingData();
+        ProfilingData *profData = caller->GetProfilingData();
         if (profData != nullptr) {
-            profData->UpdateInlineCaches(this->GetBytecodeOffset(), obj->ClassAddr<Class>());
+            profData->UpdateInlineCaches(this->GetBytecodeOffset(), cls);
         }
 
         HandleCall<FrameHelperDefault, FORMAT, false, IS_RANGE, ACCEPT_ACC>(resolved);
@@ -3922,7 +3928,7 @@ public:
             return;
         }
 
-        auto *obj = RuntimeIfaceT::CreateObject(this->GetThread(), klass);
+        auto *obj = RuntimeIfaceT::CreateObject(this->GetThread(), klass, this->GetInst().GetAddress());
         if (UNLIKELY(obj == nullptr)) {
             this->MoveToExceptionHandler();
             return;
@@ -29,6 +29,7 @@
 #include "runtime/include/runtime.h"
 #include "runtime/include/managed_thread.h"
 #include "runtime/include/safepoint_timer.h"
+#include "runtime/mem/gc/allocation_site_tracker.h"
 #include "runtime/mem/gc/gc.h"
 
 namespace ark::interpreter {
@@ -186,6 +187,24 @@ public:
         return nullptr;
     }
 
+    /// Create object at the allocation site @param pc, which may be pretenured by GC
+    static ObjectHeader *CreateObject(ManagedThread *thread, Class *klass, const uint8_t *pc)
+    {
+        mem::AllocationSiteTracker *tracker = thread->GetVM()->GetGC()->GetAllocationSiteTracker();
+        if (LIKELY(tracker == nullptr) || klass->IsStringClass() || !klass->IsInstantiable()) {
+            return CreateObject(thread, klass);
+        }
+        auto site = ToUintPtr(pc);
+        if (tracker->IsPretenured(site)) {
+            return thread->GetVM()->GetHeapManager()->AllocateTenuredObject(klass, klass->GetObjectSize(), thread);
+        }
+        ObjectHeader *object = CreateObject(thread, klass);
+        if (object != nullptr && tracker->ShouldSample()) {
+            tracker->RecordAllocation(thread->GetOrCreateAllocationSamples(), object, site);
+        }
+        return object;
+    }
+
     static Value InvokeMethod(ManagedThread *thread, Method *method, Value *args)
     {
         return method->Invoke(thread, args);
@@ -35,6 +35,7 @@
 #include "runtime/include/mutator_status.h"
 #include "runtime/interpreter/frame.h"
 #include "runtime/jit/profiling_data.h"
+#include "runtime/vector_kernels.h"
 
 #include "runtime/execution/coroutines/coroutine_manager.h"
 #include "libarkbase/utils/math_helpers.h"
@@ -439,6 +440,72 @@ void Memsetf64(ObjectHeader *array, double value, uint32_t initialIndex, uint32_
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::fill(data + initialIndex, data + maxIndex, value);
 }
+
+void VectorArrayOp8(ObjectHeader *dst, ObjectHeader *src0, ObjectHeader *src1, uint32_t op, uint32_t begin,
+                    uint32_t end)
+{
+    vector::ArrayOp<uint8_t>(dst, src0, src1, op, begin, end);
+}
+
+void VectorArrayOp16(ObjectHeader *dst, ObjectHeader *src0, ObjectHeader *src1, uint32_t op, uint32_t begin,
+                     uint32_t end)
+{
+    vector::ArrayOp<uint16_t>(dst, src0, src1, op, begin, end);
+}
+
+void VectorArrayOp32(ObjectHeader *dst, ObjectHeader *src0, ObjectHeader *src1, uint32_t op, uint32_t begin,
+                     uint32_t end)
+{
+    vector::ArrayOp<uint32_t>(dst, src0, src1, op, begin, end);
+}
+
+void VectorArrayOp64(ObjectHeader *dst, ObjectHeader *src0, ObjectHeader *src1, uint32_t op, uint32_t begin,
+                     uint32_t end)
+{
+    vector::ArrayOp<uint64_t>(dst, src0, src1, op, begin, end);
+}
+
+void VectorArrayOpf32(ObjectHeader *dst, ObjectHeader *src0, ObjectHeader *src1, uint32_t op, uint32_t begin,
+                      uint32_t end)
+{
+    vector::ArrayOp<float>(dst, src0, src1, op, begin, end);
+}
+
+void VectorArrayOpf64(ObjectHeader *dst, ObjectHeader *src0, ObjectHeader *src1, uint32_t op, uint32_t begin,
+                      uint32_t end)
+{
+    vector::ArrayOp<double>(dst, src0, src1, op, begin, end);
+}
+
+void VectorScalarOp8(ObjectHeader *dst, ObjectHeader *src, uint32_t value, uint32_t op, uint32_t begin, uint32_t end)
+{
+    vector::ScalarOp<uint8_t>(dst, src, static_cast<uint8_t>(value), op, begin, end);
+}
+
+void VectorScalarOp16(ObjectHeader *dst, ObjectHeader *src, uint32_t value, uint32_t op, uint32_t begin, uint32_t end)
+{
+    vector::ScalarOp<uint16_t>(dst, src, static_cast<uint16_t>(value), op, begin, end);
+}
+
+void VectorScalarOp32(ObjectHeader *dst, ObjectHeader *src, uint32_t value, uint32_t op, uint32_t begin, uint32_t end)
+{
+    vector::ScalarOp<uint32_t>(dst, src, value, op, begin, end);
+}
+
+void VectorScalarOp64(ObjectHeader *dst, ObjectHeader *src, uint64_t value, uint32_t op, uint32_t begin, uint32_t end)
+{
+    vector::ScalarOp<uint64_t>(dst, src, value, op, begin, end);
+}
+
+void VectorScalarOpf32(ObjectHeader *dst, ObjectHeader *src, float value, uint32_t op, uint32_t begin, uint32_t end)
+{
+    vector::ScalarOp<float>(dst, src, value, op, begin, end);
+}
+
+void VectorScalarOpf64(ObjectHeader *dst, ObjectHeader *src, double value, uint32_t op, uint32_t begin, uint32_t end)
+{
+    vector::ScalarOp<double>(dst, src, value, op, begin, end);
+}
 }  // namespace ark::intrinsics
 
 #include "core_any_intrinsics.inc"
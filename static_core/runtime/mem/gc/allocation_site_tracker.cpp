@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "runtime/mem/gc/allocation_site_tracker.h"
+#include "libarkbase/utils/logger.h"
+
+namespace ark::mem {
+// Allocations are counted per thread to avoid contention of the mutators
+static thread_local uint32_t g_allocationsBeforeSample = 0;
+
+AllocationSiteTracker::AllocationSiteTracker(uint32_t sampleInterval, uint32_t survivalThresholdPercent,
+                                             uint32_t minSamples, uint32_t resetInterval)
+    : sampleInterval_(sampleInterval),
+      survivalThresholdPercent_(survivalThresholdPercent),
+      minSamples_(minSamples),
+      resetInterval_(resetInterval)
+{
+}
+
+bool AllocationSiteTracker::ShouldSample()
+{
+    if (g_allocationsBeforeSample != 0) {
+        --g_allocationsBeforeSample;
+        return false;
+    }
+    g_allocationsBeforeSample = sampleInterval_ == 0 ? 0 : sampleInterval_ - 1;
+    return true;
+}
+
+void AllocationSiteTracker::RecordAllocation(AllocationSamples *threadSamples, const ObjectHeader *object,
+                                             uintptr_t site)
+{
+    ASSERT(threadSamples->count < AllocationSamples::CAPACITY);
+    threadSamples->samples[threadSamples->count++] = {object, site};
+    if (threadSamples->count == AllocationSamples::CAPACITY) {
+        FlushSamples(threadSamples);
+    }
+}
+
+void AllocationSiteTracker::FlushSamples(AllocationSamples *threadSamples)
+{
+    if (threadSamples->count == 0) {
+        return;
+    }
+    {
+        os::memory::LockHolder lock(samplesLock_);
+        ASSERT(samples_.size() <= MAX_SAMPLES);
+        // The samples over the limit are skipped
+        size_t count = std::min(threadSamples->count, MAX_SAMPLES - samples_.size());
+        samples_.insert(samples_.end(), threadSamples->samples.begin(), threadSamples->samples.begin() + count);
+    }
+    threadSamples->count = 0;
+}
+
+void AllocationSiteTracker::DropSamples()
+{
+    os::memory::LockHolder lock(samplesLock_);
+    samples_.clear();
+}
+
+void AllocationSiteTracker::MakeDecisions()
+{
+    for (auto it = siteStats_.begin(); it != siteStats_.end();) {
+        const SiteStats &stats = it->second;
+        uint64_t total = stats.survived + stats.died;
+        if (total < minSamples_) {
+            ++it;
+            continue;
+        }
+        // Statistics of the site are restarted after each decision, so old phases of the application are forgotten
+        if (stats.survived * static_cast<uint64_t>(PERCENT_100_U32) >= total * survivalThresholdPercent_) {
+            if (AddPretenuredSite(it->first)) {
+                pretenuredSitesSamples_ += total;
+                pretenuredSitesSurvived_ += stats.survived;
+                LOG(DEBUG, GC) << "Pretenure allocation site " << std::hex << it->first << std::dec << ", survived "
+                               << stats.survived << " of " << total << " sampled objects";
+            } else {
+                LOG(DEBUG, GC) << "Too many pretenured sites, allocation site " << std::hex << it->first << std::dec
+                               << " is not pretenured";
+            }
+        }
+        it = siteStats_.erase(it);
+    }
+}
+
+bool AllocationSiteTracker::AddPretenuredSite(uintptr_t site)
+{
+    ASSERT(site != 0);
+    // Atomic with relaxed order reason: the counter is changed only under samplesLock_
+    size_t count = pretenuredSitesCount_.load(std::memory_order_relaxed);
+    if (count >= MAX_PRETENURED_SITES) {
+        return false;
+    }
+    size_t idx = GetSlotIndex(site);
+    while (true) {
+        // Atomic with relaxed order reason: the slots are changed only under samplesLock_
+        uintptr_t slot = pretenuredSites_[idx].load(std::memory_order_relaxed);
+        if (slot == site) {
+            return true;
+        }
+        if (slot == 0) {
+            break;
+        }
+        idx = GetNextSlotIndex(idx);
+    }
+    // Atomic with relaxed order reason: the readers compare the slot with the site and don't read other data by it
+    pretenuredSites_[idx].store(site, std::memory_order_relaxed);
+    // Atomic with relaxed order reason: the counter only skips the empty table
+    pretenuredSitesCount_.store(count + 1U, std::memory_order_relaxed);
+    return true;
+}
+
+void AllocationSiteTracker::ResetDecisions()
+{
+    // The mutators, which read a slot before it is cleared, allocate one more object in tenured space
+    for (auto &slot : pretenuredSites_) {
+        // Atomic with relaxed order reason: the readers compare the slot with the site and don't read other data by it
+        slot.store(0, std::memory_order_relaxed);
+    }
+    // Atomic with relaxed order reason: the counter only skips the empty table
+    pretenuredSitesCount_.store(0, std::memory_order_relaxed);
+    siteStats_.clear();
+    pretenuredSitesSamples_ = 0;
+    pretenuredSitesSurvived_ = 0;
+    collectionsSinceReset_ = 0;
+    LOG(DEBUG, GC) << "Pretenuring decisions are reset";
+}
+}  // namespace ark::mem
@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_RUNTIME_MEM_GC_ALLOCATION_SITE_TRACKER_H
+#define PANDA_RUNTIME_MEM_GC_ALLOCATION_SITE_TRACKER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "libarkbase/globals.h"
+#include "libarkbase/macros.h"
+#include "libarkbase/os/mutex.h"
+#include "runtime/include/mem/panda_containers.h"
+
+namespace ark {
+class ObjectHeader;
+}  // namespace ark
+
+namespace ark::mem {
+
+/// Objects sampled by a thread, they are passed to AllocationSiteTracker in batches, so the mutators rarely lock
+struct AllocationSamples {
+    struct Sample {
+        const ObjectHeader *object;
+        uintptr_t site;
+    };
+
+    static constexpr size_t CAPACITY = 32;
+
+    size_t count {0};
+    std::array<Sample, CAPACITY> samples {};
+};
+
+/**
+ * Collects survival statistics of the objects by their allocation sites and decides which sites should allocate
+ * directly in tenured space. A site is an address of the allocating bytecode instruction.
+ * Mutators sample every N-th allocation, GC classifies the sampled objects during young collection.
+ * The site is pretenured, when the rate of its survived objects exceeds the threshold. The pretenured sites are not
+ * sampled, so all the decisions are dropped every resetInterval young collections and the sites are sampled again.
+ * The pretenured sites are kept in an open addressing table, which is only appended between the resets, so the
+ * mutators check them without locks.
+ */
+class AllocationSiteTracker {
+public:
+    enum class SampleFate { SURVIVED, DIED, UNKNOWN };
+
+    NO_COPY_SEMANTIC(AllocationSiteTracker);
+    NO_MOVE_SEMANTIC(AllocationSiteTracker);
+
+    AllocationSiteTracker(uint32_t sampleInterval, uint32_t survivalThresholdPercent, uint32_t minSamples,
+                          uint32_t resetInterval);
+
+    ~AllocationSiteTracker() = default;
+
+    /// @return true if the next allocation of the current thread should be sampled
+    bool ShouldSample();
+
+    /// Remember the object allocated at the site in the samples of the allocating thread until the next collection
+    void RecordAllocation(AllocationSamples *threadSamples, const ObjectHeader *object, uintptr_t site);
+
+    /// Move the samples of a thread to the tracker. GC calls it for every thread before UpdateSurvivalRates
+    void FlushSamples(AllocationSamples *threadSamples);
+
+    bool IsPretenured(uintptr_t site) const
+    {
+        // Atomic with relaxed order reason: the counter only skips the empty table
+        if (pretenuredSitesCount_.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        for (size_t idx = GetSlotIndex(site), probes = 0; probes < PRETENURED_SITES_TABLE_SIZE;
+             idx = GetNextSlotIndex(idx), ++probes) {
+            // Atomic with relaxed order reason: the slot is the only published data, a stale value delays a decision
+            uintptr_t slot = pretenuredSites_[idx].load(std::memory_order_relaxed);
+            if (slot == site) {
+                return true;
+            }
+            if (slot == 0) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void RecordPretenuredAllocation(size_t size)
+    {
+        // Atomic with relaxed order reason: statistics only
+        pretenuredBytes_.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    /**
+     * Classify the sampled objects, update the survival rates of their sites and make pretenuring decisions.
+     * Must be called during young collection before the evacuated regions are released
+     * @param getFate returns SampleFate of the sampled object
+     */
+    template <typename GetFate>
+    void UpdateSurvivalRates(const GetFate &getFate)
+    {
+        os::memory::LockHolder lock(samplesLock_);
+        if (resetInterval_ != 0 && ++collectionsSinceReset_ >= resetInterval_) {
+            ResetDecisions();
+        }
+        for (const auto &sample : samples_) {
+            SampleFate fate = getFate(sample.object);
+            if (fate == SampleFate::UNKNOWN) {
+                continue;
+            }
+            auto &stats = siteStats_[sample.site];
+            if (fate == SampleFate::SURVIVED) {
+                ++stats.survived;
+            } else {
+                ++stats.died;
+            }
+        }
+        samples_.clear();
+        MakeDecisions();
+    }
+
+    /// Forget the sampled objects, they may be moved or freed by the collection. GC clears the thread samples itself
+    void DropSamples();
+
+    /**
+     * @param pretenuredBytes bytes allocated by the pretenured sites since the previous young collection
+     * @return estimate of the bytes, which the young collection would copy, if the objects were allocated young
+     */
+    size_t EstimateCopiedBytesAvoided(size_t pretenuredBytes)
+    {
+        os::memory::LockHolder lock(samplesLock_);
+        if (pretenuredSitesSamples_ == 0) {
+            return 0;
+        }
+        return static_cast<size_t>(static_cast<uint64_t>(pretenuredBytes) * pretenuredSitesSurvived_ /
+                                   pretenuredSitesSamples_);
+    }
+
+    size_t GetPretenuredSitesCount() const
+    {
+        // Atomic with relaxed order reason: statistics only
+        return pretenuredSitesCount_.load(std::memory_order_relaxed);
+    }
+
+    /// @return bytes allocated directly in tenured space, so not copied by young collections
+    size_t GetPretenuredBytes() const
+    {
+        // Atomic with relaxed order reason: statistics only
+        return pretenuredBytes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    using Sample = AllocationSamples::Sample;
+
+    struct SiteStats {
+        uint32_t survived {0};
+        uint32_t died {0};
+    };
+
+    // Sampled objects of one mutator phase, the rest of the samples are skipped
+    static constexpr size_t MAX_SAMPLES = 4096;
+    // The table is kept half empty to keep the probe sequences short, the next sites are not pretenured
+    static constexpr size_t PRETENURED_SITES_TABLE_BITS = 11;
+    static constexpr size_t PRETENURED_SITES_TABLE_SIZE = 1U << PRETENURED_SITES_TABLE_BITS;
+    static constexpr size_t MAX_PRETENURED_SITES = PRETENURED_SITES_TABLE_SIZE / 2U;
+    // Fibonacci hashing spreads the close bytecode addresses over the table
+    static constexpr uint64_t SITE_HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    static size_t GetSlotIndex(uintptr_t site)
+    {
+        return static_cast<size_t>((static_cast<uint64_t>(site) * SITE_HASH_MULTIPLIER) >>
+                                   (BITS_PER_UINT64 - PRETENURED_SITES_TABLE_BITS));
+    }
+
+    static size_t GetNextSlotIndex(size_t idx)
+    {
+        return (idx + 1U) & (PRETENURED_SITES_TABLE_SIZE - 1U);
+    }
+
+    void MakeDecisions() REQUIRES(samplesLock_);
+    bool AddPretenuredSite(uintptr_t site) REQUIRES(samplesLock_);
+    void ResetDecisions() REQUIRES(samplesLock_);
+
+    uint32_t sampleInterval_;
+    uint32_t survivalThresholdPercent_;
+    uint32_t minSamples_;
+    uint32_t resetInterval_;
+    os::memory::Mutex samplesLock_;
+    PandaVector<Sample> samples_ GUARDED_BY(samplesLock_);
+    PandaUnorderedMap<uintptr_t, SiteStats> siteStats_ GUARDED_BY(samplesLock_);
+    uint32_t collectionsSinceReset_ GUARDED_BY(samplesLock_) {0};
+    // Sampled objects of the currently pretenured sites, which made the decisions, and how many of them survived
+    uint64_t pretenuredSitesSamples_ GUARDED_BY(samplesLock_) {0};
+    uint64_t pretenuredSitesSurvived_ GUARDED_BY(samplesLock_) {0};
+    // Zero marks the empty slot, the slots are written under samplesLock_ and read without locks
+    std::array<std::atomic<uintptr_t>, PRETENURED_SITES_TABLE_SIZE> pretenuredSites_ {};
+    std::atomic<size_t> pretenuredSitesCount_ {0};
+    std::atomic<size_t> pretenuredBytes_ {0};
+};
+
+}  // namespace ark::mem
+
+#endif  // PANDA_RUNTIME_MEM_GC_ALLOCATION_SITE_TRACKER_H
@@ -36,6 +36,12 @@ ObjectAllocatorG1<MT_MODE>::ObjectAllocatorG1(MemStatsType *memStats, [[maybe_un
         MakePandaUnique<NonMovableAllocator>(memStats, &heapSpaces_, SpaceType::SPACE_TYPE_NON_MOVABLE_OBJECT);
     humongousObjectAllocator_ =
         MakePandaUnique<HumongousObjectAllocator>(memStats, &heapSpaces_, SpaceType::SPACE_TYPE_HUMONGOUS_OBJECT);
+    if (Runtime::GetOptions().IsG1NumaAware()) {
+        numaTopology_ = MakePandaUnique<NumaTopology>(Runtime::GetOptions().GetG1NumaAwareSimulatedNodes());
+        // Young regions are filled by mutators, tenured ones by GC workers, which are bound to the nodes
+        objectYoungAllocator_->GetSpace()->SetNumaTopology(numaTopology_.get());
+        objectTenuredAllocator_->GetSpace()->SetNumaTopology(numaTopology_.get());
+    }
     memStats_ = memStats;
 }
 
@@ -255,10 +261,33 @@ Alignment ObjectAllocatorG1<MT_MODE>::CalculateAllocatorAlignment(size_t align)
 }
 
 template <MTModeT MT_MODE>
-void *ObjectAllocatorG1<MT_MODE>::AllocateTenured([[maybe_unused]] size_t size)
+void *ObjectAllocatorG1<MT_MODE>::AllocateTenured(size_t size)
 {
-    UNREACHABLE();
-    return nullptr;
+    // Used by mutators for pretenured allocation sites, so only regular objects are expected
+    if (AlignUp(size, GetAlignmentInBytes(DEFAULT_ALIGNMENT)) > GetYoungAllocMaxSize()) {
+        return nullptr;
+    }
+    RegionMem regionMem = objectTenuredAllocator_->template AllocExt<RegionFlag::IS_OLD>(size, DEFAULT_ALIGNMENT);
+    if (regionMem.mem != nullptr && !regionMem.isZeroed) {
+        ObjectMemoryInit(regionMem.mem, size);
+    }
+    return regionMem.mem;
+}
+
+template <MTModeT MT_MODE>
+TLAB *ObjectAllocatorG1<MT_MODE>::CreateNewTenuredTLAB(size_t tlabSize)
+{
+    TLAB *newTlab = objectTenuredAllocator_->CreateTenuredTLAB(tlabSize);
+    if (newTlab != nullptr) {
+        auto region = AddrToRegion(newTlab->GetStartAddr());
+        ASSERT(region != nullptr);
+        if (!region->HasFlag(RegionFlag::IS_ZEROED)) {
+            ASAN_UNPOISON_MEMORY_REGION(newTlab->GetStartAddr(), newTlab->GetSize());
+            MemoryInitialize(newTlab->GetStartAddr(), newTlab->GetSize());
+            ASAN_POISON_MEMORY_REGION(newTlab->GetStartAddr(), newTlab->GetSize());
+        }
+    }
+    return newTlab;
 }
 
 template <MTModeT MT_MODE>
@@ -19,6 +19,7 @@
 #include "runtime/include/mem/allocator.h"
 #include "runtime/mem/region_allocator.h"
 #include "runtime/mem/region_allocator-inl.h"
+#include "runtime/mem/numa_topology.h"
 #include "runtime/mem/gc/g1/g1-allocator_constants.h"
 
 namespace ark::mem {
@@ -156,6 +157,12 @@ public:
         objectYoungAllocator_->ResetAllYoungRegions(onRegionDestroy);
     }
 
+    /// Make the region of the tenured TLABs regular, the TLABs must be released by all the threads before that
+    void ResetTenuredTLABRegion()
+    {
+        objectTenuredAllocator_->ResetTenuredTLABRegion();
+    }
+
     template <RegionFlag REGIONS_TYPE, RegionSpace::ReleaseRegionsPolicy REGIONS_RELEASE_POLICY,
               OSPagesPolicy OS_PAGES_POLICY, bool NEED_LOCK, typename Container>
     void ResetRegions(const Container &regions)
@@ -292,6 +299,12 @@ public:
         objectTenuredAllocator_->ReleaseEmptyRegions<RegionFlag::IS_OLD, OS_PAGES_POLICY>();
     }
 
+    template <OSPagesPolicy OS_PAGES_POLICY>
+    void ReleaseYoungRegions()
+    {
+        objectYoungAllocator_->ReleaseEmptyRegions<RegionFlag::IS_EDEN, OS_PAGES_POLICY>();
+    }
+
     void SetDesiredEdenLength(size_t edenLength)
     {
         objectYoungAllocator_->SetDesiredEdenLength(edenLength);
@@ -322,9 +335,17 @@ public:
         return nonmovableAllocator_->CalculateDeadObjectsRatio();
     }
 
+    /// @return NUMA nodes of the object regions, nullptr if the allocation is not NUMA-aware
+    const NumaTopology *GetNumaTopology() const
+    {
+        return numaTopology_.get();
+    }
+
 private:
     Alignment CalculateAllocatorAlignment(size_t align) final;
 
+    // Declared before the allocators, because their spaces refer to it
+    PandaUniquePtr<NumaTopology> numaTopology_ {nullptr};
     PandaUniquePtr<ObjectAllocator> objectYoungAllocator_ {nullptr};
     PandaUniquePtr<ObjectAllocator> objectTenuredAllocator_ {nullptr};
     PandaUniquePtr<NonMovableAllocator> nonmovableAllocator_ {nullptr};
@@ -335,6 +356,8 @@ private:
 
     void *AllocateTenuredWithoutLocks(size_t size) final;
 
+    TLAB *CreateNewTenuredTLAB(size_t tlabSize) final;
+
     friend class AllocTypeConfigG1;
 };
 
@@ -73,7 +73,9 @@ G1GC<LanguageConfig>::G1GC(ObjectAllocatorBase *objectAllocator, const GCSetting
       isExplicitConcurrentGcEnabled_(settings.IsExplicitConcurrentGcEnabled()),
       regionSizeBits_(ark::helpers::math::GetIntLog2(this->GetG1ObjectAllocator()->GetRegionSize())),
       g1PauseTracker_(settings.GetG1GcPauseIntervalInMillis(), settings.GetG1MaxGcPauseInMillis()),
-      analytics_(ark::time::GetCurrentTimeInNanos())
+      heapShrinker_(settings.G1HeapShrinkOccupancyThreshold(), settings.G1HeapShrinkGcCount(),
+                    settings.G1HeapShrinkIntervalInMillis()),
+      analytics_(ark::time::GetCurrentTimeInNanos(), settings.G1AdaptiveYoungEnabled())
 {
     InternalAllocatorPtr allocator = this->GetInternalAllocator();
     this->SetType(GCType::G1_GC);
@@ -85,6 +87,12 @@ G1GC<LanguageConfig>::G1GC(ObjectAllocatorBase *objectAllocator, const GCSetting
     firstRefVector->reserve(MAX_REFS);
     uniqueRefsFromRemsets_.push_back(firstRefVector);
     GetG1ObjectAllocator()->ReserveRegionIfNeeded();
+    if (settings.G1PretenuringEnabled()) {
+        allocationSiteTracker_ = MakePandaUnique<AllocationSiteTracker>(settings.G1PretenuringSampleInterval(),
+                                                                        settings.G1PretenuringSurvivalThreshold(),
+                                                                        settings.G1PretenuringMinSamples(),
+                                                                        settings.G1PretenuringResetInterval());
+    }
 }
 
 template <class LanguageConfig>
@@ -211,8 +219,10 @@ private:
         } else {
             log << ark::helpers::MemoryConverter(region->GetLiveBytes());
         }
-        log << " RS " << region->GetRemSetSize() << " M " << ark::helpers::MemoryConverter(regionInfo.movedSize_)
-            << " D " << ark::helpers::TimeConverter(time::GetCurrentTimeInNanos() - regionInfo.startTimeNs_);
+        log << " RS " << region->GetRemSetSize() << " RSM "
+            << ark::helpers::MemoryConverter(region->GetRemSet()->GetMemoryFootprint()) << " M "
+            << ark::helpers::MemoryConverter(regionInfo.movedSize_) << " D "
+            << ark::helpers::TimeConverter(time::GetCurrentTimeInNanos() - regionInfo.startTimeNs_);
         return log;
     }
 };
@@ -590,6 +600,10 @@ void G1GC<LanguageConfig>::WorkerTaskProcessing(GCWorkersTask *task, [[maybe_unu
             ExecuteFullMarkingTask(task->Cast<GCMarkWorkersTask>()->GetMarkingStack());
             break;
         }
+        case GCWorkersTaskTypes::TASK_WORK_STEALING_MARKING: {
+            task->Cast<GCWorkStealingMarkingTask>()->GetMarking()->RunWorker();
+            break;
+        }
         case GCWorkersTaskTypes::TASK_REGION_COMPACTING: {
             auto *data = task->Cast<GCRegionCompactWorkersTask>()->GetRegionData();
             ExecuteCompactingTask(data->first, data->second);
@@ -604,7 +618,11 @@ void G1GC<LanguageConfig>::WorkerTaskProcessing(GCWorkersTask *task, [[maybe_unu
             break;
         }
         case GCWorkersTaskTypes::TASK_ENQUEUE_REMSET_REFS: {
-            ExecuteEnqueueRemsetsTask(task->Cast<GCUpdateRefsWorkersTask<false>>()->GetMovedObjectsRange());
+            ExecuteEnqueueRemsetsTask<false>(task->Cast<GCUpdateRefsWorkersTask<false>>()->GetMovedObjectsRange());
+            break;
+        }
+        case GCWorkersTaskTypes::TASK_UPDATE_REMSET_REFS: {
+            ExecuteEnqueueRemsetsTask<true>(task->Cast<GCUpdateRefsWorkersTask<true>>()->GetMovedObjectsRange());
             break;
         }
         case GCWorkersTaskTypes::TASK_EVACUATE_REGIONS: {
@@ -702,12 +720,13 @@ void G1GC<LanguageConfig>::ExecuteCompactingTask(Region *region, const ObjectVis
 }
 
 template <class LanguageConfig>
+template <bool VECTOR>
 void G1GC<LanguageConfig>::ExecuteEnqueueRemsetsTask(
-    GCUpdateRefsWorkersTask<false>::MovedObjectsRange *movedObjectsRange)
+    typename GCUpdateRefsWorkersTask<VECTOR>::MovedObjectsRange *movedObjectsRange)
 {
     auto *taskUpdatedRefsQueue = this->GetInternalAllocator()->template New<GCG1BarrierSet::ThreadLocalCardQueues>();
     EnqueueRemsetRefUpdater<LanguageConfig> refUpdater(this->GetCardTable(), taskUpdatedRefsQueue, regionSizeBits_);
-    DoUpdateReferencesToMovedObjectsRange<LanguageConfig, decltype(refUpdater), false>(movedObjectsRange, refUpdater);
+    DoUpdateReferencesToMovedObjectsRange<LanguageConfig, decltype(refUpdater), VECTOR>(movedObjectsRange, refUpdater);
     {
         os::memory::LockHolder lock(gcWorkerQueueLock_);
         updatedRefsQueue_->insert(updatedRefsQueue_->end(), taskUpdatedRefsQueue->begin(), taskUpdatedRefsQueue->end());
@@ -780,6 +799,8 @@ void G1GC<LanguageConfig>::StartGCCollection(ark::GCTask &task)
     if (NeedToRunGC(task)) {
         // Check there is no concurrent mark running by another thread.
         EnsurePreWrbDisabledInThreads();
+        // The regions of the tenured TLABs may be chosen for the collection
+        ResetTenuredTLABs();
 
         if (this->GetSettings()->LogDetailedGCInfoEnabled()) {
             PrintFragmentationMetrics("Fragmentation before GC: ");
@@ -792,6 +813,17 @@ void G1GC<LanguageConfig>::StartGCCollection(ark::GCTask &task)
             EnableFullPromotionIfNeeded();
             TryRunMixedGC(task);
         }
+        ShrinkHeapIfNeeded();
+        if (allocationSiteTracker_ != nullptr) {
+            // The sampled objects are moved or freed by any collection
+            allocationSiteTracker_->DropSamples();
+            this->GetPandaVm()->GetThreadManager()->EnumerateThreads([](ManagedThread *thread) {
+                if (thread->GetAllocationSamples() != nullptr) {
+                    thread->GetAllocationSamples()->count = 0;
+                }
+                return true;
+            });
+        }
 
         if (this->GetSettings()->LogDetailedGCInfoEnabled()) {
             PrintFragmentationMetrics("Fragmentation after GC: ");
@@ -826,6 +858,7 @@ void G1GC<LanguageConfig>::RunPhasesImpl(ark::GCTask &task)
         }
         collectionSet_.clear();
         singlePassCompactionEnabled_ = false;
+        ReleaseEvacuatedRegions();
         if (fullCollectionSetPromotion_) {
             isMixedGcRequired_ = true;
         }
@@ -852,7 +885,12 @@ void G1GC<LanguageConfig>::RunFullGC(ark::GCTask &task)
     GetG1ObjectAllocator()->template ReleaseTenuredRegions<OSPagesPolicy::NO_RETURN>();
     LOG_DEBUG_GC << "Explicit Full GC invocation due to a reason: " << task.reason;
     this->SetFullGC(true);
+    fullGCCompactionTime_ = 0;
+    fullGCUpdateRefsTime_ = 0;
+    auto markingStartTime = ark::time::GetCurrentTimeInNanos();
     FullMarking(task);
+    this->GetStats()->AddTimeValue(ark::time::GetCurrentTimeInNanos() - markingStartTime,
+                                   TimeTypeStats::FULL_MARKING_TIME);
     // Need to reset current tenured region. So we can get it in garbage or empty regions lists.
     GetG1ObjectAllocator()->ClearCurrentTenuredRegion();
     PandaVector<std::pair<uint32_t, Region *>> garbageRegions;
@@ -872,6 +910,8 @@ void G1GC<LanguageConfig>::RunFullGC(ark::GCTask &task)
     // Reserve a region to prevent OOM in case a lot of garbage in tenured space
     GetG1ObjectAllocator()->ReserveRegionIfNeeded();
     CollectAndMoveYoungRegions(collectionSet);
+    this->GetStats()->AddTimeValue(fullGCCompactionTime_, TimeTypeStats::FULL_COMPACTION_TIME);
+    this->GetStats()->AddTimeValue(fullGCUpdateRefsTime_, TimeTypeStats::FULL_UPDATE_REFS_TIME);
     ReleasePagesInFreePools();
     this->SetFullGC(false);
     topGarbageRegions_.clear();
@@ -959,6 +999,9 @@ void G1GC<LanguageConfig>::CollectAndMoveYoungRegions(const CollectionSet &colle
             LOG_DEBUG_GC << "Iterative full GC. Collecting " << cs.size() << " young regions";
             UpdateCollectionSet(cs);
             CollectAndMove<true>(cs);
+            // The refs from the moved young objects are enqueued as cards, so they must reach RemSets before the pause
+            // ends, as after the tenured steps
+            HandleReferences();
         } else {
             RestoreYoungRegionsAfterFullGC(cs);
             LOG_INFO_GC << "Failed to run gc, not enough free regions for young";
@@ -980,6 +1023,33 @@ void G1GC<LanguageConfig>::ReleasePagesInFreePools()
     }
 }
 
+template <class LanguageConfig>
+void G1GC<LanguageConfig>::ShrinkHeapIfNeeded()
+{
+    if (!this->GetSettings()->G1HeapShrinkEnabled()) {
+        return;
+    }
+    // Global memstats are updated after the pause, so subtract the bytes freed by this collection
+    size_t footprint = this->GetPandaVm()->GetMemStats()->GetFootprintHeap();
+    size_t freedBytes = this->memStats_.GetSizeFreedYoung() + this->memStats_.GetSizeFreedTenured();
+    size_t usedBytes = footprint > freedBytes ? footprint - freedBytes : 0;
+    size_t committedBytes = PoolManager::GetMmapMemPool()->GetObjectCommittedBytes();
+    this->GetStats()->AddMemoryValue(committedBytes, MemoryTypeStats::COMMITTED_HEAP_BYTES);
+    this->GetStats()->AddMemoryValue(usedBytes, MemoryTypeStats::USED_HEAP_BYTES);
+    this->GetPandaVm()->GetGCStats()->RecordHeapOccupancy(committedBytes, usedBytes);
+    if (!heapShrinker_.AddCollection(usedBytes, committedBytes,
+                                     static_cast<int64_t>(ark::time::GetCurrentTimeInMillis()))) {
+        return;
+    }
+    ScopedTiming t(__FUNCTION__, *this->GetTiming());
+    // Cached empty regions are freed on the pause, pages of the free pools are released by GC workers if possible
+    GetG1ObjectAllocator()->template ReleaseYoungRegions<OSPagesPolicy::NO_RETURN>();
+    GetG1ObjectAllocator()->template ReleaseTenuredRegions<OSPagesPolicy::NO_RETURN>();
+    ReleasePagesInFreePools();
+    LOG_INFO_GC << "Heap shrunk, committed: " << ark::helpers::MemoryConverter(committedBytes) << " -> "
+                << ark::helpers::MemoryConverter(PoolManager::GetMmapMemPool()->GetObjectCommittedBytes());
+}
+
 template <class LanguageConfig>
 void G1GC<LanguageConfig>::RunMixedGC(ark::GCTask &task, const CollectionSet &collectionSet)
 {
@@ -1347,6 +1417,7 @@ void G1GC<LanguageConfig>::CollectInSinglePass()
     EvacuateCollectionSet(remset);
     UpdateAndSweep();
     HandleReferences();
+    UpdateAllocationSites();
     ActualizeRemSets();
 
     analytics_.ReportEvacuatedBytes(copiedBytesYoung_);
@@ -1524,11 +1595,102 @@ void G1GC<LanguageConfig>::ResetRegionAfterMixedGC()
         objectAllocator->ResetYoungAllocator(
             [this](uintptr_t begin, uintptr_t end) { this->GetCardTable()->ClearCardRange(begin, end); });
     }
+    ResetEvacuatedTenuredRegions(collectionSet_);
+}
+
+template <class LanguageConfig>
+void G1GC<LanguageConfig>::ResetEvacuatedTenuredRegions(const CollectionSet &collectionSet)
+{
+    if (deferCollectionSetRelease_) {
+        // The regions keep IS_COLLECTION_SET flag until ReleaseEvacuatedRegions, so they are not reused before
+        auto tenured = collectionSet.Tenured();
+        evacuatedTenuredRegions_.insert(evacuatedTenuredRegions_.end(), tenured.begin(), tenured.end());
+        return;
+    }
+    GCScope<TRACE_TIMING> resetRegions("ResetRegions", this);
+    this->GetG1ObjectAllocator()
+        ->template ResetRegions<RegionFlag::IS_OLD, RegionSpace::ReleaseRegionsPolicy::NoRelease,
+                                OSPagesPolicy::IMMEDIATE_RETURN, false>(collectionSet.Tenured());
+}
+
+template <class LanguageConfig>
+void G1GC<LanguageConfig>::ReleaseEvacuatedRegions()
+{
+    if (evacuatedTenuredRegions_.empty()) {
+        return;
+    }
+    ConcurrentScope concurrentScope(this);
+    ASSERT(this->IsConcurrencyAllowed());
+    // Mutators already run here, so the phase marks the window in which the evacuated regions are still allocated
+    GCScope<TRACE_TIMING_PHASE> scope(__FUNCTION__, this, GCPhase::GC_PHASE_CLEANUP);
     {
-        GCScope<TRACE_TIMING> resetRegions("ResetRegions", this);
-        objectAllocator->template ResetRegions<RegionFlag::IS_OLD, RegionSpace::ReleaseRegionsPolicy::NoRelease,
-                                               OSPagesPolicy::IMMEDIATE_RETURN, false>(collectionSet_.Tenured());
+        // RemoveInvalidRegions drops the cards of the regions with IS_COLLECTION_SET flag from remsets
+        ScopedTiming t1("Region Invalidation", *this->GetTiming());
+        auto allRegions = GetG1ObjectAllocator()->GetAllRegions();
+        updateRemsetWorker_->InvalidateRegions(&allRegions);
+    }
+    this->GetG1ObjectAllocator()
+        ->template ResetRegions<RegionFlag::IS_OLD, RegionSpace::ReleaseRegionsPolicy::NoRelease,
+                                OSPagesPolicy::IMMEDIATE_RETURN, true, PandaVector<Region *>>(
+            // CC-OFFNXT(G.FMT.06-CPP) project code style
+            evacuatedTenuredRegions_);
+    LOG_DEBUG_GC << "Released " << evacuatedTenuredRegions_.size() << " evacuated regions concurrently";
+    evacuatedTenuredRegions_.clear();
+}
+
+template <class LanguageConfig>
+void G1GC<LanguageConfig>::UpdateAllocationSites()
+{
+    if (allocationSiteTracker_ == nullptr) {
+        return;
+    }
+    ScopedTiming t(__FUNCTION__, *this->GetTiming());
+    auto *tracker = allocationSiteTracker_.get();
+    // The pretenured bytes are estimated before the decisions of this collection, which may reset them
+    size_t pretenuredBytes = tracker->GetPretenuredBytes();
+    ASSERT(pretenuredBytes >= lastPretenuredBytes_);
+    size_t newPretenuredBytes = pretenuredBytes - lastPretenuredBytes_;
+    lastPretenuredBytes_ = pretenuredBytes;
+    size_t copiedBytesAvoided = tracker->EstimateCopiedBytesAvoided(newPretenuredBytes);
+    this->GetStats()->AddMemoryValue(newPretenuredBytes, MemoryTypeStats::PRETENURED_BYTES);
+    this->GetStats()->AddMemoryValue(copiedBytesAvoided, MemoryTypeStats::COPIED_BYTES_AVOIDED);
+    this->GetPandaVm()->GetGCStats()->AddPretenuredBytes(newPretenuredBytes, copiedBytesAvoided);
+
+    this->GetPandaVm()->GetThreadManager()->EnumerateThreads([tracker](ManagedThread *thread) {
+        if (thread->GetAllocationSamples() != nullptr) {
+            tracker->FlushSamples(thread->GetAllocationSamples());
+        }
+        return true;
+    });
+    tracker->UpdateSurvivalRates([](const ObjectHeader *object) {
+        Region *region = ObjectToRegion(object);
+        // Objects of the promoted regions and the humongous objects are not copied, so they do not affect the decision
+        if (!region->IsYoung() || region->HasFlag(RegionFlag::IS_PROMOTED)) {
+            return AllocationSiteTracker::SampleFate::UNKNOWN;
+        }
+        return object->IsForwarded() ? AllocationSiteTracker::SampleFate::SURVIVED
+                                     : AllocationSiteTracker::SampleFate::DIED;
+    });
+    LOG_DEBUG_GC << "Pretenured allocation sites: " << tracker->GetPretenuredSitesCount()
+                 << ", allocated by them in tenured space: " << ark::helpers::MemoryConverter(newPretenuredBytes)
+                 << ", copied bytes avoided: " << ark::helpers::MemoryConverter(copiedBytesAvoided)
+                 << ", copied from young space: " << ark::helpers::MemoryConverter(copiedBytesYoung_);
+}
+
+template <class LanguageConfig>
+void G1GC<LanguageConfig>::ResetTenuredTLABs()
+{
+    if (allocationSiteTracker_ == nullptr) {
+        return;
     }
+    ScopedTiming t(__FUNCTION__, *this->GetTiming());
+    auto *tracker = allocationSiteTracker_.get();
+    this->GetPandaVm()->GetThreadManager()->EnumerateThreads([tracker](ManagedThread *thread) {
+        tracker->RecordPretenuredAllocation(thread->GetTenuredTLAB()->GetOccupiedSize());
+        thread->ClearTenuredTLAB();
+        return true;
+    });
+    GetG1ObjectAllocator()->ResetTenuredTLABRegion();
 }
 
 template <class LanguageConfig>
@@ -1573,6 +1735,8 @@ void G1GC<LanguageConfig>::RunGC(GCTask &task, const CollectionSet &collectibleR
     {
         time::Timer timer(&youngPauseTime, true);
         singlePassCompactionEnabled_ = SinglePassCompactionAvailable();
+        deferCollectionSetRelease_ = this->GetSettings()->G1ConcurrentCollectionSetReleaseEnabled() &&
+                                     this->IsConcurrencyAllowed() && !collectibleRegions.Tenured().empty();
         if (fullCollectionSetPromotion_) {
             FullPromotion(collectibleRegions);
         } else if (singlePassCompactionEnabled_) {
@@ -1586,6 +1750,7 @@ void G1GC<LanguageConfig>::RunGC(GCTask &task, const CollectionSet &collectibleR
         analytics_.ReportSurvivedBytesRatio(collectibleRegions);
         ClearRefsFromRemsetsCache();
         this->GetObjectGenAllocator()->InvalidateSpaceData();
+        deferCollectionSetRelease_ = false;
     }
     if (youngPauseTime > 0) {
         this->GetStats()->AddTimeValue(youngPauseTime, TimeTypeStats::YOUNG_PAUSED_TIME);
@@ -1792,13 +1957,18 @@ void G1GC<LanguageConfig>::UpdateRefsAndClear(const CollectionSet &collectionSet
 {
     {
         os::memory::LockHolder lock(queueLock_);
-        analytics_.ReportUpdateRefsStart(ark::time::GetCurrentTimeInNanos());
+        auto updateRefsStartTime = ark::time::GetCurrentTimeInNanos();
+        analytics_.ReportUpdateRefsStart(updateRefsStartTime);
         if (this->GetSettings()->ParallelRefUpdatingEnabled()) {
             UpdateRefsToMovedObjects<FULL_GC, true>(movedObjectsContainer);
         } else {
             UpdateRefsToMovedObjects<FULL_GC, false>(movedObjectsContainer);
         }
-        analytics_.ReportUpdateRefsEnd(ark::time::GetCurrentTimeInNanos());
+        auto updateRefsEndTime = ark::time::GetCurrentTimeInNanos();
+        analytics_.ReportUpdateRefsEnd(updateRefsEndTime);
+        if constexpr (FULL_GC) {
+            fullGCUpdateRefsTime_ += updateRefsEndTime - updateRefsStartTime;
+        }
         ActualizeRemSets();
     }
 
@@ -1809,15 +1979,12 @@ void G1GC<LanguageConfig>::UpdateRefsAndClear(const CollectionSet &collectionSet
         objectAllocator->ResetYoungAllocator(
             [this](uintptr_t begin, uintptr_t end) { this->GetCardTable()->ClearCardRange(begin, end); });
     }
-    {
+    if (!this->IsFullGC()) {
+        ResetEvacuatedTenuredRegions(collectionSet);
+    } else {
         GCScope<TRACE_TIMING> resetRegions("ResetRegions", this);
-        if (!this->IsFullGC()) {
-            objectAllocator->template ResetRegions<RegionFlag::IS_OLD, RegionSpace::ReleaseRegionsPolicy::NoRelease,
-                                                   OSPagesPolicy::IMMEDIATE_RETURN, false>(collectionSet.Tenured());
-        } else {
-            objectAllocator->template ResetRegions<RegionFlag::IS_OLD, RegionSpace::ReleaseRegionsPolicy::Release,
-                                                   OSPagesPolicy::NO_RETURN, false>(collectionSet.Tenured());
-        }
+        objectAllocator->template ResetRegions<RegionFlag::IS_OLD, RegionSpace::ReleaseRegionsPolicy::Release,
+                                               OSPagesPolicy::NO_RETURN, false>(collectionSet.Tenured());
     }
     {
         // Don't forget to delete all temporary elements
@@ -1856,7 +2023,8 @@ bool G1GC<LanguageConfig>::CollectAndMove(const CollectionSet &collectionSet)
     HeapVerifierIntoGC<LanguageConfig> collectVerifier = this->CollectVerificationInfo(collectionSet);
     {
         GCScope<TRACE_TIMING> compactRegions("CompactRegions", this);
-        analytics_.ReportEvacuationStart(ark::time::GetCurrentTimeInNanos());
+        auto compactionStartTime = ark::time::GetCurrentTimeInNanos();
+        analytics_.ReportEvacuationStart(compactionStartTime);
         if constexpr (FULL_GC) {
             if (!useGcWorkers) {
                 auto vector = internalAllocator->template New<PandaVector<ObjectHeader *>>();
@@ -1874,7 +2042,11 @@ bool G1GC<LanguageConfig>::CollectAndMove(const CollectionSet &collectionSet)
             this->GetWorkersTaskPool()->WaitUntilTasksEnd();
         }
 
-        analytics_.ReportEvacuationEnd(ark::time::GetCurrentTimeInNanos());
+        auto compactionEndTime = ark::time::GetCurrentTimeInNanos();
+        analytics_.ReportEvacuationEnd(compactionEndTime);
+        if constexpr (FULL_GC) {
+            fullGCCompactionTime_ += compactionEndTime - compactionStartTime;
+        }
     }
 
     MovedObjectsContainer<FULL_GC> *movedObjectsContainer = nullptr;
@@ -1882,6 +2054,7 @@ bool G1GC<LanguageConfig>::CollectAndMove(const CollectionSet &collectionSet)
         movedObjectsContainer = &movedObjectsVector;
     } else {
         movedObjectsContainer = &mixedMarkedObjects_;
+        UpdateAllocationSites();
     }
 
     UpdateRefsAndClear<FULL_GC>(collectionSet, movedObjectsContainer, &movedObjectsVector, &collectVerifier);
@@ -1907,20 +2080,22 @@ template <class LanguageConfig>
 template <class ObjectsContainer>
 void G1GC<LanguageConfig>::ProcessMovedObjects(ObjectsContainer *movedObjects)
 {
+    // FULL-GC stores moved objects in vectors
+    constexpr bool VECTOR = std::is_same_v<ObjectsContainer, PandaVector<ObjectHeader *>>;
+    using TaskType = GCUpdateRefsWorkersTask<VECTOR>;
     auto rangeBegin = movedObjects->begin();
     auto rangeEnd = rangeBegin;
     while (rangeBegin != movedObjects->end()) {
-        if (std::distance(rangeBegin, movedObjects->end()) < GCUpdateRefsWorkersTask<false>::RANGE_SIZE) {
+        if (std::distance(rangeBegin, movedObjects->end()) < TaskType::RANGE_SIZE) {
             rangeEnd = movedObjects->end();
         } else {
-            std::advance(rangeEnd, GCUpdateRefsWorkersTask<false>::RANGE_SIZE);
+            std::advance(rangeEnd, TaskType::RANGE_SIZE);
         }
         auto *movedObjectsRange =
-            this->GetInternalAllocator()->template New<typename GCUpdateRefsWorkersTask<false>::MovedObjectsRange>(
-                rangeBegin, rangeEnd);
+            this->GetInternalAllocator()->template New<typename TaskType::MovedObjectsRange>(rangeBegin, rangeEnd);
         rangeBegin = rangeEnd;
-        GCUpdateRefsWorkersTask<false> gcWorkerTask(movedObjectsRange);
-        if (this->GetWorkersTaskPool()->AddTask(GCUpdateRefsWorkersTask<false>(gcWorkerTask))) {
+        TaskType gcWorkerTask(movedObjectsRange);
+        if (this->GetWorkersTaskPool()->AddTask(TaskType(gcWorkerTask))) {
             continue;
         }
         // Couldn't add new task, so do task processing immediately
@@ -1947,12 +2122,55 @@ void G1GC<LanguageConfig>::UpdateMovedObjectsReferences(MovedObjectsContainer<FU
     }
 }
 
+template <class LanguageConfig>
+void G1GC<LanguageConfig>::ParallelUpdateRefsToMovedObjectsOnFullGC(MovedObjectsContainer<true> *movedObjectsContainer)
+{
+    // GC workers don't add refs from moved objects to RemSets directly, because RemSet lock is highly contended,
+    // but mark and enqueue the cards instead. Each step of full GC processes the cards into RemSets by HandleReferences
+    // right after CollectAndMove
+    LOG_DEBUG_GC << "=== Update ex-cset -> ex-cset references. START. ===";
+    {
+        ScopedTiming t("UpdateMovedObjectsReferences", *this->GetTiming());
+        for (auto *movedObjects : *movedObjectsContainer) {
+            ProcessMovedObjects(movedObjects);
+        }
+    }
+    // Meanwhile update references from objects which are not part of collection set.
+    // GC workers and GC thread update disjoint sets of objects, only GC thread modifies RemSets, so no lock is needed
+    LOG_DEBUG_GC << "=== Update non ex-cset -> ex-cset references. START. ===";
+    auto refUpdater = this->CreateRefUpdater<true, false>(nullptr);
+    UpdateRefsFromRemSets(refUpdater);
+    LOG_DEBUG_GC << "=== Update non ex-cset -> ex-cset references. END. ===";
+    GCScope<TRACE_TIMING> waitingTiming("WaitUntilTasksEnd", this);
+    this->GetWorkersTaskPool()->WaitUntilTasksEnd();
+    LOG_DEBUG_GC << "=== Update ex-cset -> ex-cset references. END. ===";
+}
+
 template <class LanguageConfig>
 template <bool FULL_GC, bool USE_WORKERS>
 void G1GC<LanguageConfig>::UpdateRefsToMovedObjects(MovedObjectsContainer<FULL_GC> *movedObjectsContainer)
 {
     GCScope<TRACE_TIMING> scope(__FUNCTION__, this);
-    // Currently lock for RemSet too much influences for pause, so don't use workers on FULL-GC
+    if constexpr (FULL_GC && USE_WORKERS) {
+        ParallelUpdateRefsToMovedObjectsOnFullGC(movedObjectsContainer);
+    } else {
+        UpdateRefsToMovedObjectsFromHeap<FULL_GC, USE_WORKERS>(movedObjectsContainer);
+    }
+    this->VisitRoots(
+        [](GCRoot root) {
+            if (root.GetObjectHeader()->IsForwarded()) {
+                root.Update(GetForwardAddress(root.GetObjectHeader()));
+            }
+        },
+        VisitGCRootFlags::ACCESS_ROOT_NONE);
+    UpdateAndSweep();
+}
+
+template <class LanguageConfig>
+template <bool FULL_GC, bool USE_WORKERS>
+void G1GC<LanguageConfig>::UpdateRefsToMovedObjectsFromHeap(MovedObjectsContainer<FULL_GC> *movedObjectsContainer)
+{
+    // Lock for RemSet too much influences for pause, so FULL-GC workers use ParallelUpdateRefsToMovedObjectsOnFullGC
     constexpr bool ENABLE_WORKERS = USE_WORKERS && !FULL_GC;
     auto internalAllocator = this->GetInternalAllocator();
     auto *updatedRefQueue =
@@ -1984,14 +2202,6 @@ void G1GC<LanguageConfig>::UpdateRefsToMovedObjects(MovedObjectsContainer<FULL_G
         GCScope<TRACE_TIMING> waitingTiming("WaitUntilTasksEnd", this);
         this->GetWorkersTaskPool()->WaitUntilTasksEnd();
     }
-    this->VisitRoots(
-        [](GCRoot root) {
-            if (root.GetObjectHeader()->IsForwarded()) {
-                root.Update(GetForwardAddress(root.GetObjectHeader()));
-            }
-        },
-        VisitGCRootFlags::ACCESS_ROOT_NONE);
-    UpdateAndSweep();
 }
 
 template <class LanguageConfig>
@@ -2028,11 +2238,16 @@ void G1GC<LanguageConfig>::FullMarking(ark::GCTask &task)
     GCScope<TRACE_TIMING_PHASE> scope(__FUNCTION__, this, GCPhase::GC_PHASE_MARK);
     auto *objectAllocator = GetG1ObjectAllocator();
     bool useGcWorkers = this->GetSettings()->ParallelMarkingEnabled();
+    // With work stealing the stack is not split into GC workers tasks
+    bool splitStack = useGcWorkers && !this->GetSettings()->WorkStealingMarkingEnabled();
 
-    GCMarkingStackType fullCollectionStack(this, useGcWorkers ? this->GetSettings()->GCRootMarkingStackMaxSize() : 0,
-                                           useGcWorkers ? this->GetSettings()->GCWorkersMarkingStackMaxSize() : 0,
+    GCMarkingStackType fullCollectionStack(this, splitStack ? this->GetSettings()->GCRootMarkingStackMaxSize() : 0,
+                                           splitStack ? this->GetSettings()->GCWorkersMarkingStackMaxSize() : 0,
                                            GCWorkersTaskTypes::TASK_FULL_MARK,
                                            this->GetSettings()->GCMarkingStackNewTasksFrequency());
+    if (useGcWorkers && !splitStack) {
+        fullCollectionStack.EnableWorkStealing();
+    }
 
     InitialMark<true>(fullCollectionStack, marker_);
 
@@ -2076,6 +2291,8 @@ template <class LanguageConfig>
 template <bool PROCESS_WEAK_REFS, typename Marker>
 void G1GC<LanguageConfig>::InitialMark(GCMarkingStackType &markingStack, Marker &marker)
 {
+    // The objects allocated in the tenured TLABs are not recorded for marking, so the TLABs are not used until Remark
+    ResetTenuredTLABs();
     UnmarkAll(marker);
     ASSERT(this->GetReferenceProcessor()->GetReferenceQueueSize() ==
            0);  // all references should be processed on mixed-gc
@@ -2131,6 +2348,12 @@ void G1GC<LanguageConfig>::ConcurrentMark(const GCTask &task, GCMarkingStackType
     if (task.reason == GCTaskCause::CROSSREF_CAUSE) {
         // Live region bytes calculation does from GC several thread, so atomic calculation is required
         this->ConcurrentMarkImpl<PROCESS_WEAK_REFS, true>(objectsStack, marker);
+    } else if (this->GetSettings()->WorkStealingMarkingEnabled()) {
+        // The GC workers mark objects together with the GC thread, so the atomic marker is used and live region bytes
+        // are calculated atomically
+        objectsStack->EnableWorkStealing();
+        this->ConcurrentMarkImpl<PROCESS_WEAK_REFS, true>(objectsStack, marker_);
+        objectsStack->DisableWorkStealing();
     } else {
         // Only GC thread can modify live bytes in region, so no need atomically calculation
         this->ConcurrentMarkImpl<PROCESS_WEAK_REFS, false>(objectsStack, marker);
@@ -2151,11 +2374,15 @@ void G1GC<LanguageConfig>::Remark(const GCTask &task, Marker &marker)
     {
         ScopedTiming t("Stack Remarking", *this->GetTiming());
         bool useGcWorkers = this->GetSettings()->ParallelMarkingEnabled();
-        GCMarkingStackType stack(this, useGcWorkers ? this->GetSettings()->GCRootMarkingStackMaxSize() : 0,
-                                 useGcWorkers ? this->GetSettings()->GCWorkersMarkingStackMaxSize() : 0,
+        bool splitStack = useGcWorkers && !this->GetSettings()->WorkStealingMarkingEnabled();
+        GCMarkingStackType stack(this, splitStack ? this->GetSettings()->GCRootMarkingStackMaxSize() : 0,
+                                 splitStack ? this->GetSettings()->GCWorkersMarkingStackMaxSize() : 0,
                                  task.reason == GCTaskCause::CROSSREF_CAUSE ? GCWorkersTaskTypes::TASK_XREMARK
                                                                             : GCWorkersTaskTypes::TASK_REMARK,
                                  this->GetSettings()->GCMarkingStackNewTasksFrequency());
+        if (useGcWorkers && !splitStack) {
+            stack.EnableWorkStealing();
+        }
 
         // The mutator may create new regions.
         // If so we should bind bitmaps of new regions.
@@ -2554,7 +2781,10 @@ template <class LanguageConfig>
 void G1GC<LanguageConfig>::HandlePendingDirtyCards()
 {
     ScopedTiming t(__FUNCTION__, *this->GetTiming());
-    updateRemsetWorker_->DrainAllCards(&dirtyCards_);
+    auto refinedCards = updateRemsetWorker_->DrainAllCards(&dirtyCards_);
+    this->GetStats()->AddObjectsValue(refinedCards, ObjectTypeStats::REFINED_CARDS);
+    this->GetStats()->AddObjectsValue(dirtyCards_.size(), ObjectTypeStats::PENDING_CARDS);
+    this->GetPandaVm()->GetGCStats()->RecordRefinementLag(refinedCards, dirtyCards_.size());
     std::for_each(dirtyCards_.cbegin(), dirtyCards_.cend(), [](auto card) { card->UnMark(); });
 }
 
@@ -2767,6 +2997,10 @@ void G1GC<LanguageConfig>::ActualizeRemSets()
     if (collectionSet_.Tenured().empty() && !this->IsFullGC()) {
         return;
     }
+    if (deferCollectionSetRelease_) {
+        // Remsets are cleaned from the collection set regions after the pause in ReleaseEvacuatedRegions
+        return;
+    }
 
     auto allRegions = GetG1ObjectAllocator()->GetAllRegions();
     for (Region *region : allRegions) {
@@ -2941,11 +3175,14 @@ size_t G1GC<LanguageConfig>::CalculateDesiredEdenLengthByPauseDuration()
     }
 
     auto maxPause = this->GetSettings()->GetG1MaxGcPauseInMillis() * ark::os::time::MILLIS_TO_MICRO;
-    auto edenLengthPredicate = [this, maxPause](size_t edenLength) {
+    // Scale predictions by the observed prediction error, otherwise the pause time goal is missed when they are
+    // too optimistic, e.g. under a varying allocation rate
+    auto pauseCorrection = this->GetSettings()->G1AdaptiveYoungEnabled() ? analytics_.PredictPauseCorrection() : 1.0;
+    auto edenLengthPredicate = [this, maxPause, pauseCorrection](size_t edenLength) {
         if (!HaveEnoughRegionsToMove(edenLength)) {
             return false;
         }
-        auto pauseTime = analytics_.PredictYoungCollectionTimeInMicros(edenLength);
+        auto pauseTime = analytics_.PredictYoungCollectionTimeInMicros(edenLength) * pauseCorrection;
         return pauseTime <= maxPause;
     };
     if (!edenLengthPredicate(minEdenLength)) {
@@ -2997,9 +3234,7 @@ NO_THREAD_SAFETY_ANALYSIS void G1GC<LanguageConfig>::ConcurrentMarkImpl(GCMarkin
             },
             VisitGCRootFlags::ACCESS_ROOT_ALL | VisitGCRootFlags::START_RECORDING_NEW_ROOT);
     }
-    // Atomic with acquire order reason: load to this variable should become visible
-    while (!objectsStack->Empty() && !interruptConcurrentFlag_.load(std::memory_order_acquire)) {
-        auto *object = this->PopObjectFromStack(objectsStack);
+    auto markObject = [this, &marker](const ObjectHeader *object, GCMarkingStackType *stack) {
         ASSERT(marker.IsMarked(object));
         ValidateObject(nullptr, object);
         auto *objectClass = object->template ClassAddr<BaseClass>();
@@ -3010,10 +3245,22 @@ NO_THREAD_SAFETY_ANALYSIS void G1GC<LanguageConfig>::ConcurrentMarkImpl(GCMarkin
         ASSERT(!object->IsForwarded());
         CalcLiveBytesMarkPreprocess<ATOMICALLY>(object, objectClass);
         if constexpr (PROCESS_WEAK_REFS) {
-            marker.MarkInstance(objectsStack, object, objectClass, GC::EmptyReferenceProcessPredicate);
+            marker.MarkInstance(stack, object, objectClass, GC::EmptyReferenceProcessPredicate);
         } else {
-            marker.MarkInstance(objectsStack, object, objectClass);
+            marker.MarkInstance(stack, object, objectClass);
         }
+    };
+    if (objectsStack->IsWorkStealingEnabled()) {
+        ASSERT(ATOMICALLY);
+        // The participants stop when the marking is interrupted, the objects not visited yet are left in the stack
+        GCWorkStealingMarkingImpl marking(this, this->GetSettings()->GCWorkersCount() + 1U, markObject,
+                                          &interruptConcurrentFlag_);
+        marking.Run(objectsStack);
+        return;
+    }
+    // Atomic with acquire order reason: load to this variable should become visible
+    while (!objectsStack->Empty() && !interruptConcurrentFlag_.load(std::memory_order_acquire)) {
+        markObject(this->PopObjectFromStack(objectsStack), objectsStack);
     }
 }
 
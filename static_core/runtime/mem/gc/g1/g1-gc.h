@@ -26,6 +26,8 @@
 #include "runtime/mem/gc/generational-gc-base.h"
 #include "runtime/mem/heap_verifier.h"
 #include "runtime/mem/gc/g1/g1_pause_tracker.h"
+#include "runtime/mem/gc/g1/g1_heap_shrinker.h"
+#include "runtime/mem/gc/allocation_site_tracker.h"
 #include "runtime/mem/gc/g1/g1_analytics.h"
 #include "runtime/mem/gc/g1/update_remset_worker.h"
 #include "runtime/mem/gc/g1/object_ref.h"
@@ -103,6 +105,23 @@ public:
         return true;
     }
 
+    const NumaTopology *GetNumaTopology() const override
+    {
+        return GetG1ObjectAllocator()->GetNumaTopology();
+    }
+
+    AllocationSiteTracker *GetAllocationSiteTracker() const override
+    {
+        return allocationSiteTracker_.get();
+    }
+
+    bool IsTenuredTLABAllowed() const override
+    {
+        // The objects allocated during concurrent marking must be pushed to newobjBuffer_ by InitGCBits.
+        // Atomic with acquire order reason: the flag is set by GC thread before concurrent marking
+        return allocationSiteTracker_ != nullptr && !concurrentMarkingFlag_.load(std::memory_order_acquire);
+    }
+
     void WorkerTaskProcessing(GCWorkersTask *task, void *workerData) override;
 
     void MarkReferences(GCMarkingStackType *references, GCPhase gcPhase) override;
@@ -254,6 +273,14 @@ private:
     void MergeRemSet(RemSet<> *remset);
     void HandleReferences();
     void ResetRegionAfterMixedGC();
+    /// Reset the evacuated old regions of the collection set, or keep them for ReleaseEvacuatedRegions
+    void ResetEvacuatedTenuredRegions(const CollectionSet &collectionSet);
+    /// Invalidate the old regions evacuated during the last pause in remsets and reset them concurrently with mutators
+    void ReleaseEvacuatedRegions();
+    /// Update survival rates of the allocation sites by the sampled young objects, must be called after evacuation
+    void UpdateAllocationSites();
+    /// Release the tenured TLABs of all the threads, must be called on pause before the regions are collected or marked
+    void ResetTenuredTLABs();
 
     template <bool CONCURRENTLY>
     void ResetRegions(PandaVector<Region *> &&emptyTenuredRegions, PandaVector<Region *> &&nonmovableFreeRegions,
@@ -346,6 +373,13 @@ private:
     template <bool FULL_GC, bool USE_WORKERS>
     void UpdateRefsToMovedObjects(MovedObjectsContainer<FULL_GC> *movedObjectsContainer);
 
+    /// Update refs to moved objects from moved objects and from RemSets
+    template <bool FULL_GC, bool USE_WORKERS>
+    void UpdateRefsToMovedObjectsFromHeap(MovedObjectsContainer<FULL_GC> *movedObjectsContainer);
+
+    /// Update refs to moved objects from moved objects and from RemSets on FULL-GC using GC workers
+    void ParallelUpdateRefsToMovedObjectsOnFullGC(MovedObjectsContainer<true> *movedObjectsContainer);
+
     bool IsMarked(const ObjectHeader *object) const override;
     bool IsMarkedEx(const ObjectHeader *object) const override;
 
@@ -393,6 +427,9 @@ private:
     uint64_t AddMoreOldRegionsAccordingPauseTimeGoal(CollectionSet &collectionSet, uint64_t gcPauseTimeBudget);
     void ReleasePagesInFreePools();
 
+    /// Return cached empty regions and free pools memory to the OS, if the heap occupancy has been low for a while
+    void ShrinkHeapIfNeeded();
+
     CollectionSet GetFullCollectionSet(PandaVector<std::pair<uint32_t, Region *>> &&garbageRegions);
 
     void UpdateCollectionSet(const CollectionSet &collectibleRegions);
@@ -497,7 +534,8 @@ private:
     void ExecuteHugeArrayMarkTask(GCMarkWorkersTask::StackType *objectsStack, Marker &marker);
     void ExecuteFullMarkingTask(GCMarkWorkersTask::StackType *objectsStack);
     void ExecuteCompactingTask(Region *region, const ObjectVisitor &movedObjectsSaver);
-    void ExecuteEnqueueRemsetsTask(GCUpdateRefsWorkersTask<false>::MovedObjectsRange *movedObjectsRange);
+    template <bool VECTOR>
+    void ExecuteEnqueueRemsetsTask(typename GCUpdateRefsWorkersTask<VECTOR>::MovedObjectsRange *movedObjectsRange);
     void ExecuteEvacuateTask(typename G1EvacuateRegionsTask<Ref>::StackType *stack);
 
     void PrintFragmentationMetrics(const char *title);
@@ -536,8 +574,17 @@ private:
     bool g1TrackFreedObjects_ {false};
     bool isExplicitConcurrentGcEnabled_ {false};
     bool fullCollectionSetPromotion_ {false};
+    /// Old regions, which were evacuated during the pause, but are invalidated and reset after it
+    PandaVector<Region *> evacuatedTenuredRegions_ {};
+    bool deferCollectionSetRelease_ {false};
+    PandaUniquePtr<AllocationSiteTracker> allocationSiteTracker_ {nullptr};
+    // Pretenured bytes of the tracker at the previous young collection
+    size_t lastPretenuredBytes_ {0};
     // There are may be some regions with pinned objects that GC cannot collect
     PandaVector<std::pair<uint32_t, Region *>> topGarbageRegions_ {};
+    // Accumulated durations of the full GC phases which are performed for several parts of the heap
+    uint64_t fullGCCompactionTime_ {0};
+    uint64_t fullGCUpdateRefsTime_ {0};
     CollectionSet collectionSet_;
     // Max size of unique_refs_from_remsets_ buffer. It should be enough to store
     // almost all references to the collection set.
@@ -557,6 +604,7 @@ private:
 #endif  // NDEBUG
     size_t regionSizeBits_;
     G1PauseTracker g1PauseTracker_;
+    G1HeapShrinker heapShrinker_;
     os::memory::Mutex concurrentMarkMutex_;
     os::memory::Mutex mixedMarkedObjectsMutex_;
     os::memory::ConditionVariable concurrentMarkCondVar_;
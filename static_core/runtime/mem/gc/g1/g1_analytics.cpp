@@ -18,10 +18,14 @@
 #include "libarkbase/os/time.h"
 #include "libarkbase/utils/type_converter.h"
 #include "runtime/mem/gc/card_table.h"
+#include <algorithm>
 #include <numeric>
 
 namespace ark::mem {
-G1Analytics::G1Analytics(uint64_t now) : previousYoungCollectionEnd_(now) {}
+G1Analytics::G1Analytics(uint64_t now, bool logPausePrediction)
+    : previousYoungCollectionEnd_(now), logPausePrediction_(logPausePrediction)
+{
+}
 
 void G1Analytics::ReportEvacuatedBytes(size_t bytes)
 {
@@ -176,6 +180,8 @@ void G1Analytics::ReportCollectionEnd(GCTaskCause cause, uint64_t endTime, const
     allocationRateSeq_.Add(allocationRate);
 
     if (cause != GCTaskCause::EXPLICIT_CAUSE && edenLength == collectionSet.size() && edenLength > 0) {
+        // Must be done before the statistics are updated with this collection
+        UpdatePauseCorrectionStat(edenLength, pauseTime);
         if (singlePassCompactionEnabled) {
             ReportSinglePassCompactionEnd(cause, pauseTime, edenLength);
         } else {
@@ -248,6 +254,19 @@ void G1Analytics::ReportSinglePassCompactionEnd([[maybe_unused]] GCTaskCause cau
     otherSeq_[SINGLE_PASS_COMPACTION].Add(otherTime);
 }
 
+void G1Analytics::UpdatePauseCorrectionStat(size_t edenLength, uint64_t pauseTime)
+{
+    auto predictedPause = PredictYoungCollectionTimeInMicros(edenLength);
+    if (logPausePrediction_) {
+        LOG(INFO, GC) << "G1 young pause: eden " << edenLength << " regions, predicted " << predictedPause
+                      << "us, corrected " << static_cast<uint64_t>(predictedPause * PredictPauseCorrection())
+                      << "us, actual " << pauseTime << "us";
+    }
+    if (predictedPause > 0) {
+        pausePredictionRatioSeq_.Add(static_cast<double>(pauseTime) / predictedPause);
+    }
+}
+
 void G1Analytics::UpdateCopiedBytesStat(size_t compactedRegions)
 {
     ASSERT(compactedRegions != 0);
@@ -461,6 +480,12 @@ double G1Analytics::PredictSurvivedBytesRatio() const
     return predictor_.Predict(survivedBytesRatioSeq_);
 }
 
+double G1Analytics::PredictPauseCorrection() const
+{
+    auto correction = pauseCorrectionPredictor_.Predict(pausePredictionRatioSeq_);
+    return std::clamp(correction, 1.0, MAX_PAUSE_CORRECTION);
+}
+
 uint64_t G1Analytics::PredictOtherTime(StatType type) const
 {
     return predictor_.Predict(otherSeq_[type]);
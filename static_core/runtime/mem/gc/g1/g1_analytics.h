@@ -24,7 +24,7 @@
 namespace ark::mem {
 class G1Analytics {
 public:
-    explicit G1Analytics(uint64_t now);
+    explicit G1Analytics(uint64_t now, bool logPausePrediction = false);
 
     void ReportCollectionStart(uint64_t time);
     void ReportCollectionEnd(GCTaskCause cause, uint64_t endTime, const CollectionSet &collectionSet,
@@ -52,6 +52,13 @@ public:
     uint64_t PredictScanDirtyCardsTime(size_t dirtyCardsCount) const;
     double PredictSurvivedBytesRatio() const;
 
+    /**
+     * Predicts the factor the predicted young pause should be multiplied by to meet the pause time goal.
+     * It is derived from the observed ratios of actual to predicted young pauses, so it grows when the pause
+     * predictions are too optimistic. The result is in [1, MAX_PAUSE_CORRECTION].
+     */
+    double PredictPauseCorrection() const;
+
     void ReportPredictedMixedPause(uint64_t time)
     {
         predictedMixedPause_ = time;
@@ -85,6 +92,7 @@ private:
     void ReportSinglePassCompactionEnd(GCTaskCause gcCause, uint64_t pauseTime, size_t edenLength);
     void UpdateCopiedBytesStat(size_t compactedRegions);
     void UpdateCopiedBytesRateStat(uint64_t compactionTime);
+    void UpdatePauseCorrectionStat(size_t edenLength, uint64_t pauseTime);
 
     static constexpr uint64_t DEFAULT_PROMOTION_COST = 50;
     const uint64_t promotionCost_ {DEFAULT_PROMOTION_COST};
@@ -119,8 +127,14 @@ private:
     ark::Sequence survivedBytesRatioSeq_;
     ark::Sequence remsetSizeSeq_;
     ark::Sequence remsetScanRateSeq_;
+    ark::Sequence pausePredictionRatioSeq_;
     static constexpr double DEFAULT_CONFIDENCE_FACTOR = 0.5;
     G1Predictor predictor_ {DEFAULT_CONFIDENCE_FACTOR};
+    // Pause time goal is about the tail pauses, so the correction is predicted with a higher confidence
+    static constexpr double PAUSE_CORRECTION_CONFIDENCE_FACTOR = 2.0;
+    static constexpr double MAX_PAUSE_CORRECTION = 4.0;
+    G1Predictor pauseCorrectionPredictor_ {PAUSE_CORRECTION_CONFIDENCE_FACTOR};
+    bool logPausePrediction_ {false};
     std::atomic<size_t> copiedBytes_ {0};
     std::atomic<size_t> promotedRegions_ {0};
     std::atomic<size_t> liveObjects_ {0};
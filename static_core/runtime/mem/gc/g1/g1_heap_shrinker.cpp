@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "runtime/mem/gc/g1/g1_heap_shrinker.h"
+#include "libarkbase/globals.h"
+#include "libarkbase/utils/logger.h"
+#include "libarkbase/utils/type_converter.h"
+
+namespace ark::mem {
+G1HeapShrinker::G1HeapShrinker(uint32_t occupancyThresholdPercent, uint32_t gcCount, int64_t intervalMs)
+    : occupancyThreshold_(occupancyThresholdPercent / PERCENT_100_D), gcCount_(gcCount), intervalMs_(intervalMs)
+{
+}
+
+bool G1HeapShrinker::AddCollection(size_t usedBytes, size_t committedBytes, int64_t nowMs)
+{
+    double occupancy = committedBytes == 0 ? 1.0 : std::min(1.0, static_cast<double>(usedBytes) / committedBytes);
+    occupancy_.Add(occupancy);
+    LOG(DEBUG, GC) << "Heap committed: " << ark::helpers::MemoryConverter(committedBytes)
+                   << ", used: " << ark::helpers::MemoryConverter(usedBytes) << ", recent occupancy "
+                   << GetOccupancy() * PERCENT_100_D << "%";
+    // Any collection with high occupancy restarts the counting, so a short drop after the load spike is ignored
+    if (occupancy >= occupancyThreshold_ || GetOccupancy() >= occupancyThreshold_) {
+        lowOccupancyGcCount_ = 0;
+        return false;
+    }
+    ++lowOccupancyGcCount_;
+    if (lowOccupancyGcCount_ < gcCount_ || nowMs - lastShrinkTimeMs_ < intervalMs_) {
+        return false;
+    }
+    lowOccupancyGcCount_ = 0;
+    lastShrinkTimeMs_ = nowMs;
+    return true;
+}
+}  // namespace ark::mem
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_RUNTIME_MEM_GC_G1_G1_HEAP_SHRINKER_H
+#define PANDA_RUNTIME_MEM_GC_G1_G1_HEAP_SHRINKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include "libarkbase/macros.h"
+#include "libarkbase/utils/sequence.h"
+
+namespace ark::mem {
+
+/**
+ * Decides when G1 should return the memory of the free regions and the free pools to the OS.
+ * The heap is shrunk, when the occupancy of the committed heap stays below the threshold during several consecutive
+ * collections, but not more often than once per the interval.
+ */
+class G1HeapShrinker {
+public:
+    NO_COPY_SEMANTIC(G1HeapShrinker);
+    NO_MOVE_SEMANTIC(G1HeapShrinker);
+
+    G1HeapShrinker(uint32_t occupancyThresholdPercent, uint32_t gcCount, int64_t intervalMs);
+
+    ~G1HeapShrinker() = default;
+
+    /**
+     * Record the heap state after a collection
+     * @param usedBytes bytes used by the objects
+     * @param committedBytes bytes of the object space backed by memory of the process
+     * @param nowMs current time in milliseconds
+     * @return true if the free memory should be returned to the OS
+     */
+    bool AddCollection(size_t usedBytes, size_t committedBytes, int64_t nowMs);
+
+    /// @return recent occupancy of the committed heap in range [0, 1]
+    double GetOccupancy() const
+    {
+        return occupancy_.IsEmpty() ? 1.0 : occupancy_.GetMean();
+    }
+
+private:
+    double occupancyThreshold_;
+    uint32_t gcCount_;
+    int64_t intervalMs_;
+    ark::Sequence occupancy_;
+    uint32_t lowOccupancyGcCount_ {0};
+    int64_t lastShrinkTimeMs_ {0};
+};
+
+}  // namespace ark::mem
+
+#endif  // PANDA_RUNTIME_MEM_GC_G1_G1_HEAP_SHRINKER_H
@@ -181,6 +181,7 @@ size_t UpdateRemsetWorker<LanguageConfig>::ProcessAllCards()
     if (NeedProcessHotCards()) {
         processedCardsCnt += ProcessHotCards(emptyHandler);
     }
+    concurrentlyProcessedCards_ += processedCardsCnt;
     return processedCardsCnt;
 }
 
@@ -212,7 +213,7 @@ void UpdateRemsetWorker<LanguageConfig>::UpdateCardStatus(CardTable::CardPtr car
 }
 
 template <class LanguageConfig>
-void UpdateRemsetWorker<LanguageConfig>::DrainAllCards(PandaUnorderedSet<CardTable::CardPtr> *cards)
+size_t UpdateRemsetWorker<LanguageConfig>::DrainAllCards(PandaUnorderedSet<CardTable::CardPtr> *cards)
 {
     ASSERT(IsFlag(UpdateRemsetWorkerFlags::IS_PAUSED_BY_GC_THREAD));
     os::memory::LockHolder holder(updateRemsetLock_);
@@ -221,6 +222,12 @@ void UpdateRemsetWorker<LanguageConfig>::DrainAllCards(PandaUnorderedSet<CardTab
     FillFromThreads(cards);
     FillFromPostBarrierBuffers(cards);
     FillFromHotCards(cards);
+    // Cards left to the pause show how much concurrent refinement lags behind the mutators
+    LOG(DEBUG, GC) << "Concurrent refinement processed " << concurrentlyProcessedCards_ << " cards, "
+                   << cards->size() << " pending cards left for the pause";
+    auto refinedCards = concurrentlyProcessedCards_;
+    concurrentlyProcessedCards_ = 0;
+    return refinedCards;
 }
 
 template <class LanguageConfig>
@@ -59,8 +59,9 @@ public:
     /**
      * @brief Drain all cards to GC. Can be called only if UpdateRemsetWorker is suspended
      * @param cards pointer for saving all unprocessed cards
+     * @return number of cards processed by the worker since the previous drain
      */
-    void DrainAllCards(PandaUnorderedSet<CardTable::CardPtr> *cards);
+    size_t DrainAllCards(PandaUnorderedSet<CardTable::CardPtr> *cards);
 
     /**
      * @brief Suspend UpdateRemsetWorker to reduce CPU usage during GC puase.
@@ -210,6 +211,8 @@ private:
 
     HotCards hotCards_;
     PandaUnorderedSet<CardTable::CardPtr> cards_;
+    // Number of cards processed by the worker since the last GC pause
+    size_t concurrentlyProcessedCards_ GUARDED_BY(updateRemsetLock_) {0};
     PandaVector<GCG1BarrierSet::ThreadLocalCardQueues *> postBarrierBuffers_ GUARDED_BY(postBarrierBuffersLock_);
     os::memory::Mutex postBarrierBuffersLock_;
 
@@ -57,6 +57,7 @@ class HClass;
 class PandaVM;
 class Timing;
 namespace mem {
+class AllocationSiteTracker;
 class G1GCTest;
 class GlobalObjectStorage;
 class ReferenceProcessor;
@@ -404,6 +405,27 @@ public:
         return nullptr;
     }
 
+    /// @return NUMA nodes the GC workers are bound to, nullptr if the GC is not NUMA-aware
+    virtual const NumaTopology *GetNumaTopology() const
+    {
+        return nullptr;
+    }
+
+    /// @return survival statistics of the allocation sites, nullptr if the GC does not pretenure objects
+    virtual AllocationSiteTracker *GetAllocationSiteTracker() const
+    {
+        return nullptr;
+    }
+
+    /**
+     * @return true if the mutators may take new TLABs in tenured space for the pretenured objects.
+     * The TLAB objects are not recorded by the allocation barriers, so the GC may forbid them while they are needed
+     */
+    virtual bool IsTenuredTLABAllowed() const
+    {
+        return false;
+    }
+
     /// Called from GCWorker thread to assign thread specific data
     virtual bool InitWorker(void **workerData)
     {
@@ -73,12 +73,29 @@ public:
         additionalMarkingInfo_ = infoPtr;
     }
 
+    /// Objects of the stack will be marked by the GC thread and the GC workers with work-stealing deques
+    void EnableWorkStealing()
+    {
+        workStealing_ = true;
+    }
+
+    void DisableWorkStealing()
+    {
+        workStealing_ = false;
+    }
+
+    bool IsWorkStealingEnabled() const
+    {
+        return workStealing_;
+    }
+
 protected:
     GCAdaptiveMarkingStack *CreateStack() override;
     GCWorkersTask CreateTask(GCAdaptiveStack<ObjectHeader *> *stack) override;
 
 private:
     void *additionalMarkingInfo_ {nullptr};
+    bool workStealing_ {false};
 };
 
 }  // namespace ark::mem
@@ -56,6 +56,7 @@ GCSettings::GCSettings(const RuntimeOptions &options, panda_file::SourceLang lan
     logDetailedGcInfoEnabled_ = options.IsLogDetailedGcInfoEnabled();
     logDetailedGcCompactionInfoEnabled_ = options.IsLogDetailedGcCompactionInfoEnabled();
     parallelMarkingEnabled_ = options.IsGcParallelMarkingEnabled() && (options.GetGcWorkersCount() != 0);
+    workStealingMarkingEnabled_ = options.IsGcWorkStealingMarking();
     parallelCompactingEnabled_ = options.IsGcParallelCompactingEnabled() && (options.GetGcWorkersCount() != 0);
     parallelRefUpdatingEnabled_ = options.IsGcParallelRefUpdatingEnabled() && (options.GetGcWorkersCount() != 0);
     g1EnableConcurrentUpdateRemset_ = options.IsG1EnableConcurrentUpdateRemset();
@@ -65,7 +66,18 @@ GCSettings::GCSettings(const RuntimeOptions &options, panda_file::SourceLang lan
     g1MaxGcPauseMs_ = options.GetG1PauseTimeGoalMaxGcPause();
     g1GcPauseIntervalMs_ = options.WasSetG1PauseTimeGoalGcPauseInterval() ? options.GetG1PauseTimeGoalGcPauseInterval()
                                                                           : g1MaxGcPauseMs_ + 1;
+    g1AdaptiveYoungEnabled_ = g1EnablePauseTimeGoal_ && options.IsG1PauseTimeGoalAdaptiveYoung();
     g1SinglePassCompactionEnabled_ = options.IsG1SinglePassCompactionEnabled();
+    g1ConcurrentCollectionSetReleaseEnabled_ = options.IsG1ConcurrentCollectionSetRelease();
+    g1HeapShrinkEnabled_ = options.IsG1HeapShrink();
+    g1HeapShrinkOccupancyThreshold_ = options.GetG1HeapShrinkOccupancyThreshold();
+    g1HeapShrinkGcCount_ = options.GetG1HeapShrinkGcCount();
+    g1HeapShrinkIntervalMs_ = options.GetG1HeapShrinkInterval();
+    g1PretenuringEnabled_ = options.IsG1Pretenuring();
+    g1PretenuringSampleInterval_ = options.GetG1PretenuringSampleInterval();
+    g1PretenuringSurvivalThreshold_ = options.GetG1PretenuringSurvivalThreshold();
+    g1PretenuringMinSamples_ = options.GetG1PretenuringMinSamples();
+    g1PretenuringResetInterval_ = options.GetG1PretenuringResetInterval();
     LOG_IF(FullGCBombingFrequency() && RunGCInPlace(), FATAL, GC)
         << "full-gc-bombimg-frequency and run-gc-in-place options can't be used together";
 }
@@ -240,6 +252,11 @@ void GCSettings::SetParallelMarkingEnabled(bool value)
     parallelMarkingEnabled_ = value;
 }
 
+bool GCSettings::WorkStealingMarkingEnabled() const
+{
+    return workStealingMarkingEnabled_ && parallelMarkingEnabled_;
+}
+
 bool GCSettings::ParallelCompactingEnabled() const
 {
     return parallelCompactingEnabled_;
@@ -280,6 +297,11 @@ bool GCSettings::G1EnablePauseTimeGoal() const
     return g1EnablePauseTimeGoal_;
 }
 
+bool GCSettings::G1AdaptiveYoungEnabled() const
+{
+    return g1AdaptiveYoungEnabled_;
+}
+
 uint32_t GCSettings::GetG1MaxGcPauseInMillis() const
 {
     return g1MaxGcPauseMs_;
@@ -295,4 +317,54 @@ bool GCSettings::G1SinglePassCompactionEnabled() const
     return g1SinglePassCompactionEnabled_;
 }
 
+bool GCSettings::G1ConcurrentCollectionSetReleaseEnabled() const
+{
+    return g1ConcurrentCollectionSetReleaseEnabled_;
+}
+
+bool GCSettings::G1HeapShrinkEnabled() const
+{
+    return g1HeapShrinkEnabled_;
+}
+
+uint32_t GCSettings::G1HeapShrinkOccupancyThreshold() const
+{
+    return g1HeapShrinkOccupancyThreshold_;
+}
+
+uint32_t GCSettings::G1HeapShrinkGcCount() const
+{
+    return g1HeapShrinkGcCount_;
+}
+
+uint32_t GCSettings::G1HeapShrinkIntervalInMillis() const
+{
+    return g1HeapShrinkIntervalMs_;
+}
+
+bool GCSettings::G1PretenuringEnabled() const
+{
+    return g1PretenuringEnabled_;
+}
+
+uint32_t GCSettings::G1PretenuringSampleInterval() const
+{
+    return g1PretenuringSampleInterval_;
+}
+
+uint32_t GCSettings::G1PretenuringSurvivalThreshold() const
+{
+    return g1PretenuringSurvivalThreshold_;
+}
+
+uint32_t GCSettings::G1PretenuringMinSamples() const
+{
+    return g1PretenuringMinSamples_;
+}
+
+uint32_t GCSettings::G1PretenuringResetInterval() const
+{
+    return g1PretenuringResetInterval_;
+}
+
 }  // namespace ark::mem
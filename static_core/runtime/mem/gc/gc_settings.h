@@ -156,6 +156,9 @@ public:
 
     void SetParallelMarkingEnabled(bool value);
 
+    /// @return true if GC threads mark objects with work-stealing deques
+    bool WorkStealingMarkingEnabled() const;
+
     /// @brief true if we want to do compacting phase in multithreading mode.
     bool ParallelCompactingEnabled() const;
 
@@ -176,12 +179,45 @@ public:
 
     bool G1EnablePauseTimeGoal() const;
 
+    /// @return true if young space sizing takes the observed pause prediction error into account
+    bool G1AdaptiveYoungEnabled() const;
+
     uint32_t GetG1MaxGcPauseInMillis() const;
 
     uint32_t GetG1GcPauseIntervalInMillis() const;
 
     bool G1SinglePassCompactionEnabled() const;
 
+    /// @return true if G1 invalidates and resets the evacuated old regions concurrently after the pause
+    bool G1ConcurrentCollectionSetReleaseEnabled() const;
+
+    /// @return true if G1 returns free regions and pools memory to the OS, when the heap occupancy stays low
+    bool G1HeapShrinkEnabled() const;
+
+    /// @return percentage of used bytes in the committed heap, below which the heap is considered as oversized
+    uint32_t G1HeapShrinkOccupancyThreshold() const;
+
+    /// @return number of consecutive collections with low heap occupancy required to shrink the heap
+    uint32_t G1HeapShrinkGcCount() const;
+
+    /// @return minimum time in milliseconds between two heap shrinks
+    uint32_t G1HeapShrinkIntervalInMillis() const;
+
+    /// @return true if G1 allocates objects of the allocation sites, which survive young collections, in tenured space
+    bool G1PretenuringEnabled() const;
+
+    /// @return every N-th object allocated by a thread is sampled for the pretenuring
+    uint32_t G1PretenuringSampleInterval() const;
+
+    /// @return percentage of the sampled objects of the site surviving young collection to pretenure the site
+    uint32_t G1PretenuringSurvivalThreshold() const;
+
+    /// @return minimum number of the sampled objects of the site required to make a pretenuring decision
+    uint32_t G1PretenuringMinSamples() const;
+
+    /// @return number of young collections, after which the pretenuring decisions are dropped, 0 means never
+    uint32_t G1PretenuringResetInterval() const;
+
 private:
     // clang-tidy complains about excessive padding
     /// Garbage rate threshold of a tenured region to be included into a mixed collection
@@ -218,6 +254,13 @@ private:
     uint32_t g1PromotionRegionAliveRate_ = 0;
     uint32_t g1MaxGcPauseMs_ = 0;
     uint32_t g1GcPauseIntervalMs_ = 0;
+    uint32_t g1HeapShrinkOccupancyThreshold_ = 0;
+    uint32_t g1HeapShrinkGcCount_ = 0;
+    uint32_t g1HeapShrinkIntervalMs_ = 0;
+    uint32_t g1PretenuringSampleInterval_ = 0;
+    uint32_t g1PretenuringSurvivalThreshold_ = 0;
+    uint32_t g1PretenuringMinSamples_ = 0;
+    uint32_t g1PretenuringResetInterval_ = 0;
     /// If true then enable tracing
     bool isGcEnableTracing_ = false;
     /// Dump heap at the beginning and the end of GC
@@ -256,6 +299,7 @@ private:
     bool logDetailedGcCompactionInfoEnabled_ = false;
     /// True if we want to do marking phase in multithreading mode
     bool parallelMarkingEnabled_ = false;
+    bool workStealingMarkingEnabled_ = false;
     /// True if we want to do compacting phase in multithreading mode
     bool parallelCompactingEnabled_ = false;
     /// True if we want to do ref updating phase in multithreading mode
@@ -263,7 +307,11 @@ private:
     /// True if G1 should updates remsets concurrently
     bool g1EnableConcurrentUpdateRemset_ = false;
     bool g1EnablePauseTimeGoal_ {false};
+    bool g1AdaptiveYoungEnabled_ {false};
     bool g1SinglePassCompactionEnabled_ = true;
+    bool g1ConcurrentCollectionSetReleaseEnabled_ {false};
+    bool g1HeapShrinkEnabled_ {false};
+    bool g1PretenuringEnabled_ {false};
 };
 
 }  // namespace ark::mem
@@ -47,6 +47,9 @@ PandaString GCStats::GetStatistics()
     uint16_t percent = round((1 - (allocatedNow * 1.0 / totalHeap)) * MAX_PERCENT);
     statistic << percent << "% free, " << helpers::MemoryConverter(allocatedNow) << "/"
               << helpers::MemoryConverter(totalHeap) << ", ";
+    if (gcType_ == GCType::G1_GC) {
+        statistic << "refined cards " << lastRefinedCards_ << " concurrently, " << lastPendingCards_ << " in pause, ";
+    }
     bool initialMarkPause = GetPhasePause(PauseTypeStats::INITIAL_MARK_PAUSE) != 0U;
     bool remarkPause = IsGenerationalGCType(gcType_) && (GetPhasePause(PauseTypeStats::REMARK_PAUSE) != 0U);
     statistic << GetPhasePauseStat(PauseTypeStats::COMMON_PAUSE)
@@ -253,6 +256,43 @@ PandaString GCInstanceStats::GetAllSpacesDump(GCType gcType)
               << helpers::MemoryConverter(totalFreedBytes / totalTime.GetDoubleValue()) << "/" << totalTime.GetLiteral()
               << "\n";
 
+    if (timeStats_[ToIndex(TimeTypeStats::FULL_MARKING_TIME)].GetCount() > 0U) {
+        statistic << "full " << GC_NAMES[ToIndex(gcType)]
+                  << " marking: " << timeStats_[ToIndex(TimeTypeStats::FULL_MARKING_TIME)].GetGeneralStatistic()
+                  << "\n";
+        statistic << "full " << GC_NAMES[ToIndex(gcType)]
+                  << " compaction: " << timeStats_[ToIndex(TimeTypeStats::FULL_COMPACTION_TIME)].GetGeneralStatistic()
+                  << "\n";
+        statistic << "full " << GC_NAMES[ToIndex(gcType)] << " update refs: "
+                  << timeStats_[ToIndex(TimeTypeStats::FULL_UPDATE_REFS_TIME)].GetGeneralStatistic() << "\n";
+    }
+
+    if (objectsStats_[ToIndex(ObjectTypeStats::PENDING_CARDS)].GetCount() > 0U) {
+        statistic << GC_NAMES[ToIndex(gcType)] << " concurrently refined cards: "
+                  << objectsStats_[ToIndex(ObjectTypeStats::REFINED_CARDS)].GetGeneralStatistic() << "\n";
+        statistic << GC_NAMES[ToIndex(gcType)] << " cards refined in pause: "
+                  << objectsStats_[ToIndex(ObjectTypeStats::PENDING_CARDS)].GetGeneralStatistic() << "\n";
+    }
+
+    if (memoryStats_[ToIndex(MemoryTypeStats::COMMITTED_HEAP_BYTES)].GetCount() > 0U) {
+        statistic << GC_NAMES[ToIndex(gcType)] << " committed heap after collection: "
+                  << memoryStats_[ToIndex(MemoryTypeStats::COMMITTED_HEAP_BYTES)].GetGeneralStatistic() << "\n";
+        statistic << GC_NAMES[ToIndex(gcType)] << " used heap after collection: "
+                  << memoryStats_[ToIndex(MemoryTypeStats::USED_HEAP_BYTES)].GetGeneralStatistic() << "\n";
+    }
+
+    if (memoryStats_[ToIndex(MemoryTypeStats::PRETENURED_BYTES)].GetSum() > 0U) {
+        statistic << GC_NAMES[ToIndex(gcType)] << " pretenured: "
+                  << memoryStats_[ToIndex(MemoryTypeStats::PRETENURED_BYTES)].GetGeneralStatistic() << "\n";
+        statistic << GC_NAMES[ToIndex(gcType)] << " copying avoided by pretenuring: "
+                  << memoryStats_[ToIndex(MemoryTypeStats::COPIED_BYTES_AVOIDED)].GetGeneralStatistic() << "\n";
+    }
+
+    if (objectsStats_[ToIndex(ObjectTypeStats::STOLEN_OBJECTS)].GetCount() > 0U) {
+        statistic << GC_NAMES[ToIndex(gcType)] << " objects stolen by marking GC threads: "
+                  << objectsStats_[ToIndex(ObjectTypeStats::STOLEN_OBJECTS)].GetGeneralStatistic() << "\n";
+    }
+
     return statistic.str();
 }
 
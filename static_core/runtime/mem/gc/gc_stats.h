@@ -37,6 +37,11 @@ enum class ObjectTypeStats : size_t {
     YOUNG_FREED_OBJECTS = 0,
     MOVED_OBJECTS,
     ALL_FREED_OBJECTS,
+    // G1 concurrent refinement: cards refined by the worker between pauses and cards left to the pause
+    REFINED_CARDS,
+    PENDING_CARDS,
+    // Objects marked by a GC thread which took them from the deque of another GC thread
+    STOLEN_OBJECTS,
 
     OBJECT_TYPE_STATS_LAST
 };
@@ -52,6 +57,13 @@ enum class MemoryTypeStats : size_t {
     YOUNG_FREED_BYTES = 0,
     MOVED_BYTES,
     ALL_FREED_BYTES,
+    // G1 heap shrinking: bytes of the object space backed by memory and bytes used by the objects after a collection
+    COMMITTED_HEAP_BYTES,
+    USED_HEAP_BYTES,
+    // G1 pretenuring: bytes allocated in tenured space by the pretenured sites and the estimate of the young copying
+    // avoided by it
+    PRETENURED_BYTES,
+    COPIED_BYTES_AVOIDED,
 
     MEMORY_TYPE_STATS_LAST
 };
@@ -68,6 +80,9 @@ enum class TimeTypeStats : size_t {
     YOUNG_TOTAL_TIME,
     ALL_PAUSED_TIME,
     ALL_TOTAL_TIME,
+    FULL_MARKING_TIME,
+    FULL_COMPACTION_TIME,
+    FULL_UPDATE_REFS_TIME,
 
     TIME_TYPE_STATS_LAST
 };
@@ -219,6 +234,71 @@ public:
     uint64_t GetPhasePause(PauseTypeStats pauseType);
     void ResetLastPause();
 
+    /// Records how many cards G1 refined concurrently since the previous pause and how many the pause has to refine
+    void RecordRefinementLag(size_t refinedCards, size_t pendingCards)
+    {
+        lastRefinedCards_ = refinedCards;
+        lastPendingCards_ = pendingCards;
+    }
+
+    size_t GetLastRefinedCards() const
+    {
+        return lastRefinedCards_;
+    }
+
+    size_t GetLastPendingCards() const
+    {
+        return lastPendingCards_;
+    }
+
+    /// Records the committed and used bytes of the heap, which G1 checks after a collection to shrink the heap
+    void RecordHeapOccupancy(size_t committedBytes, size_t usedBytes)
+    {
+        lastCommittedHeapBytes_ = committedBytes;
+        lastUsedHeapBytes_ = usedBytes;
+    }
+
+    size_t GetLastCommittedHeapBytes() const
+    {
+        return lastCommittedHeapBytes_;
+    }
+
+    size_t GetLastUsedHeapBytes() const
+    {
+        return lastUsedHeapBytes_;
+    }
+
+    /// Records the bytes allocated by the pretenured allocation sites and the bytes young collections did not copy
+    void AddPretenuredBytes(size_t pretenuredBytes, size_t copiedBytesAvoided)
+    {
+        pretenuredBytes_ += pretenuredBytes;
+        copiedBytesAvoided_ += copiedBytesAvoided;
+    }
+
+    size_t GetPretenuredBytes() const
+    {
+        return pretenuredBytes_;
+    }
+
+    size_t GetCopiedBytesAvoided() const
+    {
+        return copiedBytesAvoided_;
+    }
+
+    /// Records the objects, which the GC threads stole from each other during a work-stealing marking
+    void AddStolenObjects(size_t stolenObjects)
+    {
+        // Atomic with relaxed order reason: statistics only
+        stolenObjects_.fetch_add(stolenObjects, std::memory_order_relaxed);
+    }
+
+    /// @return the number of objects stolen by the GC threads during all work-stealing markings
+    size_t GetStolenObjects() const
+    {
+        // Atomic with relaxed order reason: statistics only
+        return stolenObjects_.load(std::memory_order_relaxed);
+    }
+
     size_t GetObjectsFreedBytes()
     {
 #ifdef PANDA_TARGET_64
@@ -271,6 +351,14 @@ private:
     uint64_t lastDuration_ {0};
     uint64_t totalDuration_ {0};
 
+    size_t lastRefinedCards_ {0};
+    size_t lastPendingCards_ {0};
+    size_t lastCommittedHeapBytes_ {0};
+    size_t lastUsedHeapBytes_ {0};
+    size_t pretenuredBytes_ {0};
+    size_t copiedBytesAvoided_ {0};
+    std::atomic<size_t> stolenObjects_ {0};
+
     std::array<uint64_t, PAUSE_TYPE_STATS_SIZE> lastPause_ {};
 
     MemStatsType *memStats_;
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/mem/gc/gc_work_stealing_marking.h"
+#include "runtime/include/panda_vm.h"
+#include "runtime/mem/gc/gc.h"
+#include "runtime/mem/gc/workers/gc_workers_task_pool.h"
+#include "libarkbase/os/thread.h"
+
+namespace ark::mem {
+
+GCWorkStealingMarking::GCWorkStealingMarking(GC *gc, size_t participantsCount,
+                                             const std::atomic<bool> *interruptFlag)
+    : gc_(gc), interruptFlag_(interruptFlag)
+{
+    ASSERT(participantsCount > 0U);
+    deques_.reserve(participantsCount);
+    for (size_t i = 0; i < participantsCount; ++i) {
+        deques_.push_back(MakePandaUnique<Deque>());
+    }
+}
+
+void GCWorkStealingMarking::Run(GCMarkingStackType *stack)
+{
+    ASSERT(stack != nullptr);
+    if (stack->Empty()) {
+        return;
+    }
+    while (!stack->Empty()) {
+        deques_[0]->PushBottom(stack->PopFromStack());
+    }
+    // The GC thread is the participant 0
+    // Atomic with release order reason: the workers must see the roots pushed to the deque
+    activeParticipants_.store(1U, std::memory_order_release);
+    auto *taskPool = gc_->GetWorkersTaskPool();
+    for (size_t i = 1; i < deques_.size(); ++i) {
+        if (!taskPool->AddTask(GCWorkStealingMarkingTask(this))) {
+            break;
+        }
+    }
+    MarkLoop(0U);
+    taskPool->WaitUntilTasksEnd();
+    if (IsInterrupted()) {
+        // All participants have finished, so the deques are accessed by the GC thread only
+        for (auto &deque : deques_) {
+            for (auto *object = deque->PopBottom(); object != nullptr; object = deque->PopBottom()) {
+                stack->PushToStack(RootType::ROOT_UNKNOWN, object);
+            }
+        }
+    }
+    // Atomic with relaxed order reason: all participants have finished
+    size_t marked = markedObjects_.load(std::memory_order_relaxed);
+    // Atomic with relaxed order reason: all participants have finished
+    size_t stolen = stolenObjects_.load(std::memory_order_relaxed);
+    // Atomic with relaxed order reason: all participants have finished
+    size_t participants = nextParticipant_.load(std::memory_order_relaxed);
+    gc_->GetStats()->AddObjectsValue(stolen, ObjectTypeStats::STOLEN_OBJECTS);
+    gc_->GetPandaVm()->GetGCStats()->AddStolenObjects(stolen);
+    LOG(DEBUG, GC) << "Work stealing marking: marked " << marked << " objects, stolen " << stolen
+                   << " objects, participants " << participants;
+}
+
+void GCWorkStealingMarking::RunWorker()
+{
+    // Atomic with acquire order reason: synchronizes with the participants which became active
+    size_t active = activeParticipants_.load(std::memory_order_acquire);
+    do {
+        if (active == 0U) {
+            // All objects have been marked already
+            return;
+        }
+        // Atomic with acq_rel order reason: the worker must see the objects pushed by the active participants
+    } while (!activeParticipants_.compare_exchange_weak(active, active + 1U, std::memory_order_acq_rel,
+                                                        std::memory_order_acquire));
+    // Atomic with relaxed order reason: only the index uniqueness is required
+    size_t index = nextParticipant_.fetch_add(1U, std::memory_order_relaxed);
+    ASSERT(index < deques_.size());
+    MarkLoop(index);
+}
+
+ObjectHeader *GCWorkStealingMarking::StealObject(size_t thief)
+{
+    size_t count = deques_.size();
+    for (size_t i = 1; i < count; ++i) {
+        ObjectHeader *object = deques_[(thief + i) % count]->Steal();
+        if (object != nullptr) {
+            // Atomic with relaxed order reason: statistics only
+            stolenObjects_.fetch_add(1U, std::memory_order_relaxed);
+            return object;
+        }
+    }
+    return nullptr;
+}
+
+bool GCWorkStealingMarking::WaitForWork()
+{
+    // Atomic with acq_rel order reason: the last idle participant must see the state of all deques
+    size_t active = activeParticipants_.fetch_sub(1U, std::memory_order_acq_rel) - 1U;
+    size_t spins = 0;
+    while (active != 0U) {
+        if (IsInterrupted()) {
+            return false;
+        }
+        if (HasWork()) {
+            // Get back to work unless all other participants have become idle meanwhile
+            // Atomic with acq_rel order reason: the participant must see the objects in the deques
+            if (activeParticipants_.compare_exchange_weak(active, active + 1U, std::memory_order_acq_rel,
+                                                          std::memory_order_acquire)) {
+                return true;
+            }
+            continue;
+        }
+        if (++spins >= IDLE_SPINS_BEFORE_YIELD) {
+            spins = 0;
+            os::thread::Yield();
+        }
+        // Atomic with acquire order reason: synchronizes with the participants which became idle
+        active = activeParticipants_.load(std::memory_order_acquire);
+    }
+    return false;
+}
+
+void GCWorkStealingMarking::Leave()
+{
+    // Atomic with release order reason: the objects pushed by the participant must be visible to the GC thread
+    activeParticipants_.fetch_sub(1U, std::memory_order_release);
+}
+
+bool GCWorkStealingMarking::HasWork() const
+{
+    for (const auto &deque : deques_) {
+        if (!deque->IsEmptyApprox()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace ark::mem
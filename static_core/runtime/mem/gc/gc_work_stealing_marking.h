@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PANDA_RUNTIME_MEM_GC_GC_WORK_STEALING_MARKING_H
+#define PANDA_RUNTIME_MEM_GC_GC_WORK_STEALING_MARKING_H
+
+#include <atomic>
+
+#include "runtime/execution/work_stealing_deque.h"
+#include "runtime/include/mem/panda_containers.h"
+#include "runtime/include/mem/panda_smart_pointers.h"
+#include "runtime/mem/gc/gc_adaptive_marking_stack.h"
+
+namespace ark::mem {
+
+class GC;
+
+/**
+ * Marking by the GC thread and the GC workers.
+ * Every participant owns a Chase-Lev deque: it pops objects from the bottom of its own deque and pushes the
+ * objects found by the visitor there. When its deque is empty, it steals objects from the top of other deques.
+ * Marking ends when all participants are idle and all deques are empty, or when the interrupt flag is set.
+ * The objects are visited by GCWorkStealingMarkingImpl, so the visitor call is inlined into the marking loop.
+ */
+class GCWorkStealingMarking {
+public:
+    /// @param interruptFlag the marking stops as soon as the flag is set, nullptr if the marking can't be interrupted
+    GCWorkStealingMarking(GC *gc, size_t participantsCount, const std::atomic<bool> *interruptFlag = nullptr);
+    virtual ~GCWorkStealingMarking() = default;
+    NO_COPY_SEMANTIC(GCWorkStealingMarking);
+    NO_MOVE_SEMANTIC(GCWorkStealingMarking);
+
+    /**
+     * Marks objects reachable from the objects in @param stack by the GC thread and the GC workers.
+     * The stack is empty after the call unless the marking is interrupted: then the objects which are not visited
+     * yet are returned to the stack.
+     */
+    void Run(GCMarkingStackType *stack);
+
+    /// Entry point of a GC worker, it joins the marking unless the marking has already ended
+    void RunWorker();
+
+protected:
+    using Deque = WorkStealingDeque<ObjectHeader>;
+
+    /// Marks objects of the participant deque until the marking ends
+    virtual void MarkLoop(size_t index) = 0;
+
+    GC *GetGC() const
+    {
+        return gc_;
+    }
+
+    Deque *GetDeque(size_t index) const
+    {
+        ASSERT(index < deques_.size());
+        return deques_[index].get();
+    }
+
+    bool IsInterrupted() const
+    {
+        // Atomic with acquire order reason: the interruption is published by another thread
+        return interruptFlag_ != nullptr && interruptFlag_->load(std::memory_order_acquire);
+    }
+
+    ObjectHeader *StealObject(size_t thief);
+    /// @return true if the participant got back to work, false if the marking has ended
+    bool WaitForWork();
+    /// The participant stops because the marking is interrupted
+    void Leave();
+
+    void AddMarkedObjects(size_t count)
+    {
+        // Atomic with relaxed order reason: statistics only
+        markedObjects_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t IDLE_SPINS_BEFORE_YIELD = 16;
+
+    bool HasWork() const;
+
+    GC *gc_;
+    const std::atomic<bool> *interruptFlag_;
+    PandaVector<PandaUniquePtr<Deque>> deques_;
+    // Number of participants which own a deque and may push objects into it
+    std::atomic<size_t> activeParticipants_ {0};
+    std::atomic<size_t> nextParticipant_ {1};
+    std::atomic<size_t> markedObjects_ {0};
+    std::atomic<size_t> stolenObjects_ {0};
+};
+
+/**
+ * @tparam ObjectVisitor visits fields of the marked object and pushes the newly marked objects to the stack,
+ * void(ObjectHeader *, GCMarkingStackType *)
+ */
+template <typename ObjectVisitor>
+class GCWorkStealingMarkingImpl final : public GCWorkStealingMarking {
+public:
+    GCWorkStealingMarkingImpl(GC *gc, size_t participantsCount, ObjectVisitor &visitor,
+                              const std::atomic<bool> *interruptFlag = nullptr)
+        : GCWorkStealingMarking(gc, participantsCount, interruptFlag), visitor_(visitor)
+    {
+    }
+    ~GCWorkStealingMarkingImpl() override = default;
+    NO_COPY_SEMANTIC(GCWorkStealingMarkingImpl);
+    NO_MOVE_SEMANTIC(GCWorkStealingMarkingImpl);
+
+private:
+    void MarkLoop(size_t index) override
+    {
+        Deque *own = GetDeque(index);
+        // The visitor pushes objects to the local stack, they are moved to the own deque to be available for
+        // thieves. The stack size limit is zero, so the stack never creates GC workers tasks.
+        GCMarkingStackType localStack(GetGC());
+        size_t marked = 0;
+        while (true) {
+            if (IsInterrupted()) {
+                Leave();
+                break;
+            }
+            ObjectHeader *object = own->PopBottom();
+            if (object == nullptr) {
+                object = StealObject(index);
+            }
+            if (object == nullptr) {
+                // The own deque and the local stack are empty, so an idle participant never holds objects
+                if (!WaitForWork()) {
+                    break;
+                }
+                continue;
+            }
+            visitor_(object, &localStack);
+            ++marked;
+            while (!localStack.Empty()) {
+                own->PushBottom(localStack.PopFromStack());
+            }
+        }
+        AddMarkedObjects(marked);
+    }
+
+    ObjectVisitor &visitor_;
+};
+
+}  // namespace ark::mem
+
+#endif  // PANDA_RUNTIME_MEM_GC_GC_WORK_STEALING_MARKING_H
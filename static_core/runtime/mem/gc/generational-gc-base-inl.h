@@ -18,6 +18,7 @@
 
 #include <type_traits>
 #include "runtime/mem/gc/generational-gc-base.h"
+#include "runtime/mem/gc/gc_work_stealing_marking.h"
 
 namespace ark::mem {
 
@@ -33,8 +34,8 @@ void GenerationalGC<LanguageConfig>::MarkStack(Marker *marker, GCMarkingStackTyp
                   (sizeof...(ReferenceCheckPredicate) == 1 &&
                    std::is_constructible_v<ReferenceCheckPredicateT, ReferenceCheckPredicate...>));
     ASSERT(stack != nullptr);
-    while (!stack->Empty()) {
-        auto *object = this->PopObjectFromStack(stack);
+    auto markObject = [this, marker, &markPreprocess, &refPred...](const ObjectHeader *object,
+                                                                   GCMarkingStackType *objectsStack) {
         ASSERT(marker->IsMarked(object));
         ValidateObject(nullptr, object);
         auto *objectClass = object->template NotAtomicClassAddr<BaseClass>();
@@ -44,7 +45,16 @@ void GenerationalGC<LanguageConfig>::MarkStack(Marker *marker, GCMarkingStackTyp
 
         ASSERT(!object->IsForwarded());
         markPreprocess(object, objectClass);
-        static_cast<Marker *>(marker)->MarkInstance(stack, object, objectClass, refPred...);
+        static_cast<Marker *>(marker)->MarkInstance(objectsStack, object, objectClass, refPred...);
+    };
+    if (stack->IsWorkStealingEnabled()) {
+        // The marker and the mark preprocess must be thread safe, as for the GC workers marking tasks
+        GCWorkStealingMarkingImpl marking(this, this->GetSettings()->GCWorkersCount() + 1U, markObject);
+        marking.Run(stack);
+        return;
+    }
+    while (!stack->Empty()) {
+        markObject(this->PopObjectFromStack(stack), stack);
     }
 }
 
@@ -39,6 +39,7 @@ enum class GCWorkersTaskTypes : uint32_t {
     TASK_CONCURRENT_FIX,
     TASK_CONCURRENT_POST_FIX,
     TASK_CONCURRENT_COPY,
+    TASK_WORK_STEALING_MARKING,
 };
 
 constexpr const char *GCWorkersTaskTypesToString(GCWorkersTaskTypes type)
@@ -74,6 +75,8 @@ constexpr const char *GCWorkersTaskTypesToString(GCWorkersTaskTypes type)
             return "Post fix whole region task";
         case GCWorkersTaskTypes::TASK_CONCURRENT_COPY:
             return "Concurrent copy task";
+        case GCWorkersTaskTypes::TASK_WORK_STEALING_MARKING:
+            return "Work stealing marking task";
         default:
             return "Unknown task";
     }
@@ -172,7 +175,9 @@ public:
     static constexpr int RANGE_SIZE = 4096;
 
     explicit GCUpdateRefsWorkersTask(MovedObjectsRange *movedObjects)
-        : GCWorkersTask(GCWorkersTaskTypes::TASK_ENQUEUE_REMSET_REFS, movedObjects)
+        : GCWorkersTask(
+              VECTOR ? GCWorkersTaskTypes::TASK_UPDATE_REMSET_REFS : GCWorkersTaskTypes::TASK_ENQUEUE_REMSET_REFS,
+              movedObjects)
     {
     }
     DEFAULT_COPY_SEMANTIC(GCUpdateRefsWorkersTask);
@@ -185,6 +190,24 @@ public:
     }
 };
 
+class GCWorkStealingMarking;
+
+class GCWorkStealingMarkingTask : public GCWorkersTask {
+public:
+    explicit GCWorkStealingMarkingTask(GCWorkStealingMarking *marking)
+        : GCWorkersTask(GCWorkersTaskTypes::TASK_WORK_STEALING_MARKING, marking)
+    {
+    }
+    DEFAULT_COPY_SEMANTIC(GCWorkStealingMarkingTask);
+    DEFAULT_MOVE_SEMANTIC(GCWorkStealingMarkingTask);
+    ~GCWorkStealingMarkingTask() = default;
+
+    GCWorkStealingMarking *GetMarking() const
+    {
+        return static_cast<GCWorkStealingMarking *>(storage_);
+    }
+};
+
 class GCMarkWholeRegionTask : public GCWorkersTask {
 public:
     explicit GCMarkWholeRegionTask(Region *region) : GCWorkersTask(GCWorkersTaskTypes::TASK_MARK_WHOLE_REGION, region)
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <utility>
 
 #include "libarkbase/os/cpu_affinity.h"
@@ -24,6 +25,7 @@ namespace ark::mem {
 
 bool GCWorkersProcessor::Init()
 {
+    gcThreadsPools_->BindWorkerToNumaNode();
     return gcThreadsPools_->GetGC()->InitWorker(&workerData_);
 }
 
@@ -39,6 +41,78 @@ bool GCWorkersProcessor::Process(GCWorkersTask &&task)
     return true;
 }
 
+static bool GetTaskNumaNode(const GCWorkersTask &task, uint32_t *node)
+{
+    switch (task.GetType()) {
+        case GCWorkersTaskTypes::TASK_REGION_COMPACTING:
+            *node = task.Cast<GCRegionCompactWorkersTask>()->GetRegionData()->first->GetNumaNode();
+            return true;
+        case GCWorkersTaskTypes::TASK_MARK_WHOLE_REGION:
+            *node = task.Cast<GCMarkWholeRegionTask>()->GetRegion()->GetNumaNode();
+            return true;
+        default:
+            return false;
+    }
+}
+
+GCWorkersQueueSimple::GCWorkersQueueSimple(mem::InternalAllocatorPtr allocator, size_t queueLimit,
+                                           const NumaTopology *numaTopology)
+    : TaskQueueInterface<GCWorkersTask>(queueLimit), queues_(allocator->Adapter()), numaTopology_(numaTopology)
+{
+    auto nodesCount = numaTopology_ != nullptr ? numaTopology_->GetNodesCount() : 0U;
+    queues_.reserve(nodesCount + 1U);
+    for (uint32_t i = 0; i <= nodesCount; ++i) {
+        queues_.emplace_back(allocator->Adapter());
+    }
+}
+
+GCWorkersQueueSimple::Queue &GCWorkersQueueSimple::GetTaskQueue(const GCWorkersTask &task)
+{
+    uint32_t node = 0;
+    if (numaTopology_ != nullptr && GetTaskNumaNode(task, &node)) {
+        ASSERT(node < queues_.size() - 1U);
+        return queues_[node];
+    }
+    return queues_.back();
+}
+
+GCWorkersQueueSimple::Queue &GCWorkersQueueSimple::GetNonEmptyQueue()
+{
+    ASSERT(size_ != 0);
+    uint32_t node = 0;
+    // The node of the worker is cached on binding, the CPU of an unbound thread is not looked up on each task
+    if (numaTopology_ != nullptr && numaTopology_->GetBoundNode(&node) && !queues_[node].empty()) {
+        return queues_[node];
+    }
+    if (!queues_.back().empty()) {
+        return queues_.back();
+    }
+    auto it = std::find_if(queues_.begin(), queues_.end(), [](const Queue &queue) { return !queue.empty(); });
+    ASSERT(it != queues_.end());
+    return *it;
+}
+
+GCWorkersTask GCWorkersQueueSimple::GetTask()
+{
+    if (size_ == 0) {
+        LOG(DEBUG, GC) << "Empty " << queueName_ << ", return nothing";
+        return GCWorkersTask();
+    }
+    auto &queue = GetNonEmptyQueue();
+    auto task = queue.front();
+    queue.pop_front();
+    --size_;
+    LOG(DEBUG, GC) << "Extract a task from a " << queueName_ << ": " << GetTaskDescription(task);
+    return task;
+}
+
+void GCWorkersQueueSimple::AddTask(GCWorkersTask &&ctx, [[maybe_unused]] size_t priority)
+{
+    LOG(DEBUG, GC) << "Add task to a " << queueName_ << ": " << GetTaskDescription(ctx);
+    GetTaskQueue(ctx).push_front(ctx);
+    ++size_;
+}
+
 GCWorkersCreationInterface::GCWorkersCreationInterface(PandaVM *vm) : gcThread_(vm, Mutator::MutatorType::GC)
 {
     ASSERT(vm != nullptr);
@@ -51,10 +125,13 @@ GCWorkersCreationInterface::~GCWorkersCreationInterface()
 }
 
 GCWorkersThreadPool::GCWorkersThreadPool(GC *gc, size_t threadsCount)
-    : GCWorkersTaskPool(gc), internalAllocator_(gc->GetInternalAllocator()), threadsCount_(threadsCount)
+    : GCWorkersTaskPool(gc),
+      internalAllocator_(gc->GetInternalAllocator()),
+      threadsCount_(threadsCount),
+      numaTopology_(gc->GetNumaTopology())
 {
     ASSERT(gc->GetPandaVm() != nullptr);
-    queue_ = internalAllocator_->New<GCWorkersQueueSimple>(internalAllocator_, QUEUE_SIZE_MAX_SIZE);
+    queue_ = internalAllocator_->New<GCWorkersQueueSimple>(internalAllocator_, QUEUE_SIZE_MAX_SIZE, numaTopology_);
     workerIface_ = internalAllocator_->New<GCWorkersCreationInterface>(gc->GetPandaVm());
     threadPool_ = internalAllocator_->New<ThreadPool<GCWorkersTask, GCWorkersProcessor, GCWorkersThreadPool *>>(
         internalAllocator_, queue_, this, threadsCount, "GC_WORKER",
@@ -85,15 +162,33 @@ static void UnsetAffinity(GCWorkersProcessor *proc, [[maybe_unused]] size_t data
 
 void GCWorkersThreadPool::SetAffinityForGCWorkers()
 {
+    if (numaTopology_ != nullptr) {
+        // Workers are bound to the NUMA nodes
+        return;
+    }
     // Total GC threads count = GC Thread + GC workers
     threadPool_->EnumerateProcs(SetAffinity, threadsCount_ + 1U);
 }
 
 void GCWorkersThreadPool::UnsetAffinityForGCWorkers()
 {
+    if (numaTopology_ != nullptr) {
+        return;
+    }
     threadPool_->EnumerateProcs(UnsetAffinity, 0U);
 }
 
+void GCWorkersThreadPool::BindWorkerToNumaNode()
+{
+    if (numaTopology_ == nullptr) {
+        return;
+    }
+    // Atomic with relaxed order reason: only the counter value is used
+    auto node = boundWorkersCount_.fetch_add(1U, std::memory_order_relaxed) % numaTopology_->GetNodesCount();
+    numaTopology_->BindCurrentThread(node);
+    LOG(DEBUG, GC) << "GC worker is bound to the NUMA node " << node;
+}
+
 GCWorkersThreadPool::~GCWorkersThreadPool()
 {
     internalAllocator_->Delete(threadPool_);
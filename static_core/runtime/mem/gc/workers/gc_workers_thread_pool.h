@@ -41,41 +41,33 @@ private:
     void *workerData_ {nullptr};
 };
 
+/**
+ * LIFO queue of the GC workers tasks. With a NUMA topology the tasks processing a region are kept in the queue of
+ * the region node: a worker bound to a node takes the tasks of its node first and steals the tasks of other nodes
+ * only when there is nothing else to do
+ */
 class GCWorkersQueueSimple : public TaskQueueInterface<GCWorkersTask> {
 public:
-    explicit GCWorkersQueueSimple(mem::InternalAllocatorPtr allocator, size_t queueLimit)
-        : TaskQueueInterface<GCWorkersTask>(queueLimit), queue_(allocator->Adapter())
-    {
-    }
+    explicit GCWorkersQueueSimple(mem::InternalAllocatorPtr allocator, size_t queueLimit,
+                                  const NumaTopology *numaTopology = nullptr);
 
     ~GCWorkersQueueSimple() override = default;
     NO_COPY_SEMANTIC(GCWorkersQueueSimple);
     NO_MOVE_SEMANTIC(GCWorkersQueueSimple);
 
-    GCWorkersTask GetTask() override
-    {
-        if (queue_.empty()) {
-            LOG(DEBUG, GC) << "Empty " << queueName_ << ", return nothing";
-            return GCWorkersTask();
-        }
-        auto task = queue_.front();
-        queue_.pop_front();
-        LOG(DEBUG, GC) << "Extract a task from a " << queueName_ << ": " << GetTaskDescription(task);
-        return task;
-    }
+    GCWorkersTask GetTask() override;
 
     // NOLINTNEXTLINE(google-default-arguments)
-    void AddTask(GCWorkersTask &&ctx, [[maybe_unused]] size_t priority = 0) override
-    {
-        LOG(DEBUG, GC) << "Add task to a " << queueName_ << ": " << GetTaskDescription(ctx);
-        queue_.push_front(ctx);
-    }
+    void AddTask(GCWorkersTask &&ctx, [[maybe_unused]] size_t priority = 0) override;
 
     void Finalize() override
     {
         // Nothing to deallocate
         LOG(DEBUG, GC) << "Clear a " << queueName_;
-        queue_.clear();
+        for (auto &queue : queues_) {
+            queue.clear();
+        }
+        size_ = 0;
     }
 
 protected:
@@ -88,11 +80,22 @@ protected:
 
     size_t GetQueueSize() override
     {
-        return queue_.size();
+        return size_;
     }
 
 private:
-    PandaList<GCWorkersTask> queue_;
+    using Queue = PandaList<GCWorkersTask>;
+
+    /// @return the queue of the task node, or the common queue for the tasks not related to a node
+    Queue &GetTaskQueue(const GCWorkersTask &task);
+
+    /// @return the queue to take a task from: the current node queue, the common queue and then the other nodes
+    Queue &GetNonEmptyQueue();
+
+    // The node queues are followed by the common queue
+    PandaVector<Queue> queues_;
+    size_t size_ {0};
+    const NumaTopology *numaTopology_;
     const char *queueName_ = "simple gc workers task queue";
 };
 
@@ -133,6 +136,9 @@ public:
 
     void UnsetAffinityForGCWorkers();
 
+    /// Bind the current worker to the next NUMA node, so the workers are distributed evenly between the nodes
+    void BindWorkerToNumaNode();
+
 private:
     /**
      * @brief Try to add new gc workers task to thread pool
@@ -155,6 +161,8 @@ private:
     GCWorkersCreationInterface *workerIface_;
     mem::InternalAllocatorPtr internalAllocator_;
     const size_t threadsCount_;
+    const NumaTopology *numaTopology_;
+    std::atomic<uint32_t> boundWorkersCount_ {0};
 
     friend class GCWorkersProcessor;
 };
@@ -26,6 +26,7 @@
 #include "runtime/include/thread_scopes.h"
 #include "runtime/include/panda_vm.h"
 #include "runtime/include/runtime.h"
+#include "runtime/mem/gc/allocation_site_tracker.h"
 #include "runtime/mem/gc/epsilon/epsilon.h"
 #include "runtime/mem/gc/epsilon-g1/epsilon-g1.h"
 #include "runtime/mem/gc/g1/g1-gc.h"
@@ -139,6 +140,65 @@ ObjectHeader *HeapManager::AllocateObject(BaseClass *cls, size_t size, Alignment
     return object;
 }
 
+ObjectHeader *HeapManager::AllocateTenuredObject(BaseClass *cls, size_t size, ManagedThread *thread)
+{
+    ASSERT(size >= ObjectHeader::ObjectHeaderSize());
+    ASSERT(GetGC()->IsMutatorAllowed());
+    ASSERT(cls != nullptr);
+    ASSERT(thread != nullptr);
+    // Allocation sites are tracked only by G1, so the allocator is generational
+    AllocationSiteTracker *tracker = GetGC()->GetAllocationSiteTracker();
+    ASSERT(tracker != nullptr);
+    TriggerGCIfNeeded();
+    void *mem = AllocByTenuredTLAB(size, thread);
+    if (mem == nullptr) {
+        mem = static_cast<ObjectAllocatorGenBase *>(objectAllocator_.AsObjectAllocator())->AllocateTenured(size);
+        if (UNLIKELY(mem == nullptr)) {
+            // Young allocation runs GC or throws OOM, if there is no memory
+            return AllocateObject(cls, size, DEFAULT_ALIGNMENT, thread);
+        }
+        // The objects of the tenured TLABs are counted when the TLAB is replaced or released
+        tracker->RecordPretenuredAllocation(size);
+    }
+    LOG(DEBUG, MM_OBJECT_EVENTS) << "Alloc tenured object at " << mem << " size: " << size << " cls: " << cls;
+    ObjectHeader *object = InitObjectHeaderAtMem(cls, mem);
+    return RegisterFinalizableIfNeeded(object, cls, size, thread);
+}
+
+void *HeapManager::AllocByTenuredTLAB(size_t size, ManagedThread *thread)
+{
+    TLAB *tlab = thread->GetTenuredTLAB();
+    void *mem = tlab->Alloc(size);
+    if (mem == nullptr) {
+        // The TLABs are released by GC, and new ones are not created while GC doesn't allow them
+        if (GetAlignedObjectSize(size) > TENURED_TLAB_MAX_ALLOC_SIZE || !GetGC()->IsTenuredTLABAllowed()) {
+            return nullptr;
+        }
+        auto *genAllocator = static_cast<ObjectAllocatorGenBase *>(objectAllocator_.AsObjectAllocator());
+        TLAB *newTlab = genAllocator->CreateNewTenuredTLAB(TENURED_TLAB_SIZE);
+        if (newTlab == nullptr) {
+            return nullptr;
+        }
+        GetGC()->GetAllocationSiteTracker()->RecordPretenuredAllocation(tlab->GetOccupiedSize());
+        MarkBitmap *liveBitmap = AddrToRegion(newTlab->GetStartAddr())->GetLiveBitmap();
+        ASSERT(liveBitmap != nullptr);
+        thread->UpdateTenuredTLAB(newTlab, liveBitmap->GetBitMap().Data(), liveBitmap->GetHeapRange().first);
+        mem = newTlab->Alloc(size);
+        ASSERT(mem != nullptr);
+    }
+    // Card scanning finds the tenured objects by the live bitmap
+    AddrToRegion(mem)->GetLiveBitmap()->AtomicTestAndSet(mem);
+    return mem;
+}
+
+size_t HeapManager::GetTenuredTLABMaxAllocSize()
+{
+    if (!UseTLABForAllocations() || GetGC()->GetAllocationSiteTracker() == nullptr) {
+        return 0;
+    }
+    return TENURED_TLAB_MAX_ALLOC_SIZE;
+}
+
 ObjectHeader *HeapManager::RegisterFinalizableIfNeeded(ObjectHeader *obj, BaseClass *cls, size_t size,
                                                        ManagedThread *thread)
 {
@@ -59,6 +59,12 @@ public:
         ObjectAllocatorBase::ObjMemInitPolicy objInitType = ObjectAllocatorBase::ObjMemInitPolicy::REQUIRE_INIT,
         bool pinned = false);
 
+    /**
+     * @brief Allocates object of the pretenured allocation site directly in tenured space
+     * Falls back to the regular allocation, if the object cannot be allocated in tenured space
+     */
+    [[nodiscard]] ObjectHeader *AllocateTenuredObject(BaseClass *cls, size_t size, ManagedThread *thread);
+
     template <bool IS_FIRST_CLASS_CLASS = false>
     [[nodiscard]] ObjectHeader *AllocateNonMovableObject(
         BaseClass *cls, size_t size, Alignment align = DEFAULT_ALIGNMENT, ManagedThread *thread = nullptr,
@@ -95,6 +101,9 @@ public:
         return UseTLABForAllocations() ? objectAllocator_.AsObjectAllocator()->GetTLABMaxAllocSize() : 0;
     }
 
+    /// @return max size of the pretenured objects allocated in the tenured TLABs, 0 if there are no such TLABs
+    size_t GetTenuredTLABMaxAllocSize();
+
     /**
      * Register TLAB information in MemStats during changing TLAB in a thread
      * or during thread destroying.
@@ -287,6 +296,9 @@ private:
 
     void *AllocByTLAB(size_t size, ManagedThread *thread);
 
+    /// The objects are marked in the live bitmap like the other tenured objects
+    void *AllocByTenuredTLAB(size_t size, ManagedThread *thread);
+
     template <bool TRIGGER_GC>
     void *AllocateMemoryForObject(size_t size, Alignment align, ManagedThread *thread,
                                   ObjectAllocatorBase::ObjMemInitPolicy objInitType, bool pinned = false);
@@ -294,6 +306,9 @@ private:
     ObjectAllocatorPtr GetObjectAllocator() const;
 
     static constexpr float DEFAULT_TARGET_UTILIZATION = 0.5;
+    static constexpr size_t TENURED_TLAB_SIZE = 16_KB;
+    // Larger pretenured objects are allocated in the regions directly, so the tenured TLABs are not wasted
+    static constexpr size_t TENURED_TLAB_MAX_ALLOC_SIZE = TENURED_TLAB_SIZE / 8U;
 
     bool isInitialized_ = false;
     bool useRuntimeInternalAllocator_ {true};
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/mem/numa_topology.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+#include "libarkbase/os/numa.h"
+#include "libarkbase/utils/logger.h"
+
+namespace ark::mem {
+
+// CC-OFFNXT(G.NAM.03-CPP) project code style
+static constexpr uint32_t UNBOUND_NODE = std::numeric_limits<uint32_t>::max();
+// The node the current thread is bound to by NumaTopology::BindCurrentThread
+static thread_local uint32_t g_boundNode = UNBOUND_NODE;
+
+NumaTopology::NumaTopology(uint32_t simulatedNodesCount)
+    : nodesCount_(std::clamp(simulatedNodesCount, 1U, MAX_NODES_COUNT)), simulated_(simulatedNodesCount != 0)
+{
+    if (!simulated_) {
+        auto cpusCount = std::thread::hardware_concurrency();
+        cpuNodes_.reserve(cpusCount);
+        for (unsigned cpu = 0; cpu < cpusCount; ++cpu) {
+            auto physicalNode = os::numa::GetNodeOfCpu(static_cast<int>(cpu));
+            ASSERT(physicalNode < MAX_NODES_COUNT);
+            auto it = std::find(physicalNodes_.begin(), physicalNodes_.end(), physicalNode);
+            cpuNodes_.push_back(static_cast<uint32_t>(it - physicalNodes_.begin()));
+            if (it == physicalNodes_.end()) {
+                physicalNodes_.push_back(physicalNode);
+            }
+        }
+        if (physicalNodes_.empty()) {
+            physicalNodes_.push_back(0U);
+        }
+        nodesCount_ = static_cast<uint32_t>(physicalNodes_.size());
+    }
+    LOG(DEBUG, GC) << "NUMA topology: " << nodesCount_ << (simulated_ ? " simulated" : "") << " node(s)";
+}
+
+uint32_t NumaTopology::GetNodeOfCpu(int cpu) const
+{
+    ASSERT(cpu >= 0);
+    auto index = static_cast<size_t>(cpu);
+    if (simulated_) {
+        return index % nodesCount_;
+    }
+    // Looking the CPU up in sysfs is too slow for the allocation path
+    return index < cpuNodes_.size() ? cpuNodes_[index] : 0U;
+}
+
+uint32_t NumaTopology::GetCurrentNode() const
+{
+    uint32_t node = 0;
+    if (GetBoundNode(&node)) {
+        return node;
+    }
+    return GetNodeOfCpu(os::numa::GetCurrentCpu());
+}
+
+bool NumaTopology::GetBoundNode(uint32_t *node) const
+{
+    if (g_boundNode >= nodesCount_) {
+        return false;
+    }
+    *node = g_boundNode;
+    return true;
+}
+
+void NumaTopology::BindCurrentThread(uint32_t node) const
+{
+    ASSERT(node < nodesCount_);
+    g_boundNode = node;
+    if (!simulated_ && !os::numa::BindCurrentThreadToNode(GetPhysicalNode(node))) {
+        LOG(DEBUG, GC) << "Cannot set the affinity of the current thread to the NUMA node " << node;
+    }
+}
+
+void NumaTopology::UnbindCurrentThread()
+{
+    g_boundNode = UNBOUND_NODE;
+}
+
+void NumaTopology::SetPreferredNode(void *mem, size_t size, uint32_t node) const
+{
+    ASSERT(node < nodesCount_);
+    if (!simulated_ && !os::numa::SetPreferredNode(mem, size, GetPhysicalNode(node))) {
+        LOG(DEBUG, GC) << "Cannot set the NUMA node " << node << " for the memory " << mem;
+    }
+}
+
+}  // namespace ark::mem
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_RUNTIME_MEM_NUMA_TOPOLOGY_H
+#define PANDA_RUNTIME_MEM_NUMA_TOPOLOGY_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "libarkbase/macros.h"
+#include "libarkbase/os/numa.h"
+#include "runtime/include/mem/panda_containers.h"
+
+namespace ark::mem {
+
+/**
+ * NUMA nodes of the machine, which are used to keep the heap regions close to the threads allocating in them.
+ * The nodes are numbered densely from 0, the logical node is mapped to the id of the machine node, which has CPUs.
+ * The nodes can be simulated: the CPUs are distributed round-robin between them and the threads are bound to them
+ * logically, so the node-aware code paths can be exercised on a machine with a single node.
+ */
+class NumaTopology {
+public:
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr uint32_t MAX_NODES_COUNT = os::numa::MAX_NODES_COUNT;
+
+    /// @param simulatedNodesCount number of the simulated nodes, 0 to use the nodes of the machine
+    explicit NumaTopology(uint32_t simulatedNodesCount = 0);
+    ~NumaTopology() = default;
+
+    NO_COPY_SEMANTIC(NumaTopology);
+    NO_MOVE_SEMANTIC(NumaTopology);
+
+    uint32_t GetNodesCount() const
+    {
+        return nodesCount_;
+    }
+
+    bool IsSimulated() const
+    {
+        return simulated_;
+    }
+
+    /// @return the logical node of the CPU, node 0 for the CPUs, which were not online when the topology was created
+    uint32_t GetNodeOfCpu(int cpu) const;
+
+    /// @return the node the current thread is bound to, or the node of the CPU it is running on
+    uint32_t GetCurrentNode() const;
+
+    /**
+     * Get the node the current thread is bound to without looking up the CPU
+     * @return true if the current thread is bound to a node of this topology, false - otherwise
+     */
+    bool GetBoundNode(uint32_t *node) const;
+
+    /// Run the current thread on the node: the thread affinity is changed only for the nodes of the machine
+    void BindCurrentThread(uint32_t node) const;
+
+    /// Forget the node of the current thread, the thread affinity is not restored
+    static void UnbindCurrentThread();
+
+    /// Prefer the node for the memory pages, which are not touched yet. Does nothing for the simulated nodes
+    void SetPreferredNode(void *mem, size_t size, uint32_t node) const;
+
+private:
+    uint32_t GetPhysicalNode(uint32_t node) const
+    {
+        ASSERT(node < physicalNodes_.size());
+        return physicalNodes_[node];
+    }
+
+    uint32_t nodesCount_;
+    bool simulated_;
+    // Cached logical nodes of the machine CPUs
+    PandaVector<uint32_t> cpuNodes_;
+    // Ids of the machine nodes indexed by the logical node
+    PandaVector<uint32_t> physicalNodes_;
+};
+
+}  // namespace ark::mem
+
+#endif  // PANDA_RUNTIME_MEM_NUMA_TOPOLOGY_H
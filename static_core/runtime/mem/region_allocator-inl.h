@@ -296,15 +296,10 @@ TLAB *RegionAllocator<AllocConfigT, LockConfigT>::CreateTLAB(size_t size)
 
     {
         os::memory::LockHolder lock(this->regionLock_);
-        Region *region = nullptr;
+        // In NUMA-aware space TLABs are refilled from the regions of the current thread node
+        bool numaAware = this->GetSpace()->GetNumaTopology() != nullptr;
         // first search in partial tlab map
-        auto largestTlab = retainedTlabs_.begin();
-        if (largestTlab != retainedTlabs_.end() && largestTlab->first >= size) {
-            LOG(DEBUG, ALLOC) << "Use retained tlabs region " << region;
-            region = largestTlab->second;
-            retainedTlabs_.erase(largestTlab);
-            ASSERT(region->HasFlag(RegionFlag::IS_EDEN));
-        }
+        Region *region = TakeRetainedTlabRegion(size, numaAware);
 
         // allocate a free region if none partial tlab has enough space
         if (region == nullptr) {
@@ -313,6 +308,9 @@ TLAB *RegionAllocator<AllocConfigT, LockConfigT>::CreateTLAB(size_t size)
                 region->CreateTLABSupport();
             }
         }
+        if (region == nullptr && numaAware) {
+            region = TakeRetainedTlabRegion(size, false);
+        }
         if (region != nullptr) {
             tlab = CreateTLABInRegion(region, size);
             auto remainingSize = region->GetRemainingSizeForTLABs();
@@ -327,6 +325,23 @@ TLAB *RegionAllocator<AllocConfigT, LockConfigT>::CreateTLAB(size_t size)
     return tlab;
 }
 
+template <typename AllocConfigT, typename LockConfigT>
+Region *RegionAllocator<AllocConfigT, LockConfigT>::TakeRetainedTlabRegion(size_t size, bool currentNumaNodeOnly)
+{
+    auto node = currentNumaNodeOnly ? this->GetSpace()->GetNumaTopology()->GetCurrentNode() : 0U;
+    // Retained regions are sorted by the remaining size, so the largest suitable one is taken
+    for (auto it = retainedTlabs_.begin(); it != retainedTlabs_.end() && it->first >= size; ++it) {
+        Region *region = it->second;
+        if (!currentNumaNodeOnly || region->GetNumaNode() == node) {
+            LOG(DEBUG, ALLOC) << "Use retained tlabs region " << region;
+            retainedTlabs_.erase(it);
+            ASSERT(region->HasFlag(RegionFlag::IS_EDEN));
+            return region;
+        }
+    }
+    return nullptr;
+}
+
 template <typename AllocConfigT, typename LockConfigT>
 TLAB *RegionAllocator<AllocConfigT, LockConfigT>::CreateRegionSizeTLAB()
 {
@@ -343,6 +358,52 @@ TLAB *RegionAllocator<AllocConfigT, LockConfigT>::CreateRegionSizeTLAB()
     return tlab;
 }
 
+template <typename AllocConfigT, typename LockConfigT>
+TLAB *RegionAllocator<AllocConfigT, LockConfigT>::CreateTenuredTLAB(size_t size)
+{
+    ASSERT(size <= GetMaxRegularObjectSize());
+    ASSERT(AlignUp(size, GetAlignmentInBytes(DEFAULT_ALIGNMENT)) == size);
+    os::memory::LockHolder lock(this->regionLock_);
+    if (tenuredTlabRegion_ != nullptr && tenuredTlabRegion_->GetRemainingSizeForTLABs() < size) {
+        RetireTenuredTLABRegion();
+    }
+    if (tenuredTlabRegion_ == nullptr) {
+        Region *region = this->template CreateAndSetUpNewRegion<AllocConfigT, OSPagesAllocPolicy::ZEROED_MEMORY>(
+            REGION_SIZE, RegionFlag::IS_OLD);
+        if (UNLIKELY(region == nullptr)) {
+            return nullptr;
+        }
+        region->CreateTLABSupport();
+        tenuredTlabRegion_ = region;
+    }
+    TLAB *tlab = CreateTLABInRegion(tenuredTlabRegion_, size);
+    AllocConfigT::OnAlloc(size, this->spaceType_, this->memStats_);
+    return tlab;
+}
+
+template <typename AllocConfigT, typename LockConfigT>
+void RegionAllocator<AllocConfigT, LockConfigT>::ResetTenuredTLABRegion()
+{
+    os::memory::LockHolder lock(this->regionLock_);
+    if (tenuredTlabRegion_ != nullptr) {
+        RetireTenuredTLABRegion();
+    }
+}
+
+template <typename AllocConfigT, typename LockConfigT>
+void RegionAllocator<AllocConfigT, LockConfigT>::RetireTenuredTLABRegion()
+{
+    static constexpr bool IS_ATOMIC = std::is_same_v<LockConfigT, RegionAllocatorLockConfig::CommonLock>;
+    Region *region = tenuredTlabRegion_;
+    tenuredTlabRegion_ = nullptr;
+    // Objects of the region are iterated over the TLABs and then over the regular part, as in promoted eden regions
+    region->AddFlag(RegionFlag::IS_MIXEDTLAB);
+    region->SetTop(ToUintPtr(region->GetLastTLAB()->GetEndAddr()));
+    LOG(DEBUG, ALLOC) << "Retire tenured tlabs region " << region << " with remained size "
+                      << region->End() - region->Top();
+    PushToRegionQueue<IS_ATOMIC, RegionFlag::IS_OLD>(region);
+}
+
 template <typename AllocConfigT, typename LockConfigT>
 TLAB *RegionAllocator<AllocConfigT, LockConfigT>::CreateTLABInRegion(Region *region, size_t size)
 {
@@ -205,6 +205,20 @@ public:
      */
     TLAB *CreateRegionSizeTLAB();
 
+    /**
+     * @brief Create a TLAB of the specified size in a tenured region. The TLABs are created one by one in the same
+     * region until it is full, then the region becomes a regular tenured region.
+     * @param size - required size of tlab
+     * @return newly allocated TLAB, or nullptr if allocation failed.
+     */
+    TLAB *CreateTenuredTLAB(size_t size);
+
+    /**
+     * @brief Make the region of the tenured TLABs a regular tenured region, so its rest is used by the regular
+     * allocations. The mutators must not use the TLABs of the region after that.
+     */
+    void ResetTenuredTLABRegion();
+
     /**
      * @brief Iterates over all objects allocated by this allocator.
      * @param visitor - function pointer or functor
@@ -520,10 +534,14 @@ private:
     template <RegionFlag REGION_TYPE>
     struct RegionMem AllocRegular(size_t alignSize);
     TLAB *CreateTLABInRegion(Region *region, size_t size);
+    Region *TakeRetainedTlabRegion(size_t size, bool currentNumaNodeOnly);
+    void RetireTenuredTLABRegion() REQUIRES(this->regionLock_);
 
     Region fullRegion_;
     Region *edenCurrentRegion_;
     Region *reservedRegion_ = nullptr;
+    // The tenured region where the next tenured TLAB is created
+    Region *tenuredTlabRegion_ = nullptr;
     // To store partially used Regions that can be reused later.
     ark::PandaMultiMap<size_t, Region *, std::greater<size_t>> retainedTlabs_;
     friend class test::RegionAllocatorTest;
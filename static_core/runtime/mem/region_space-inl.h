@@ -163,8 +163,8 @@ void RegionSpace::FreeRegion(Region *region, const F &onRegionDestroy)
             if (Runtime::GetOptions().IsG1EmptyYoungRegionsCacheEnabled()) {
                 maxEmptyYoungRegions = regionPool_->GetInitialMaxYoungSize() / DEFAULT_REGION_SIZE;
             }
-            if (emptyYoungRegions_.size() < maxEmptyYoungRegions) {
-                emptyYoungRegions_.push_back(region->AsListNode());
+            if (GetEmptyYoungRegionsCount() < maxEmptyYoungRegions) {
+                emptyYoungRegions_[region->GetNumaNode()].push_back(region->AsListNode());
                 return;
             }
             onRegionDestroy(ToUintPtr(region), region->End());
@@ -182,8 +182,10 @@ void RegionSpace::ReleaseEmptyRegions()
 {
     auto visitor = [this](Region *region) { regionPool_->FreeRegion<OS_PAGES_POLICY>(region); };
     if (IsYoungRegionFlag(REGION_TYPE)) {
-        IterateRegionsList(emptyYoungRegions_, visitor);
-        emptyYoungRegions_.clear();
+        for (auto &regionList : emptyYoungRegions_) {
+            IterateRegionsList(regionList, visitor);
+            regionList.clear();
+        }
     } else {
         IterateRegionsList(emptyTenuredRegions_, visitor);
         emptyTenuredRegions_.clear();
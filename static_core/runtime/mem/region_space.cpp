@@ -12,6 +12,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+
 #include "libarkbase/mem/mem_pool.h"
 #include "runtime/mem/region_space-inl.h"
 #include "runtime/mem/rem_set-inl.h"
@@ -315,20 +317,27 @@ Region *RegionSpace::NewRegion(size_t regionSize, RegionFlag edenOrOldOrNonmovab
     if (youngRegionFlag && youngRegionsInUse_.load(std::memory_order_relaxed) >= desiredEdenLength_) {
         return nullptr;
     }
-    if (youngRegionFlag && (!emptyYoungRegions_.empty())) {
-        region = GetRegionFromEmptyList(emptyYoungRegions_);
-        ASAN_UNPOISON_MEMORY_REGION(region, Region::HeadSize());
-        ASSERT(regionSize == region->Size());
-        regionPool_->NewRegion(region, this, regionSize, edenOrOldOrNonmovable, properties);
+    auto node = numaTopology_ != nullptr ? numaTopology_->GetCurrentNode() : 0U;
+    if (youngRegionFlag && (!emptyYoungRegions_[node].empty())) {
+        region = ReuseEmptyRegion(emptyYoungRegions_[node], regionSize, edenOrOldOrNonmovable, properties);
     } else if (!youngRegionFlag && (!emptyTenuredRegions_.empty())) {
-        region = GetRegionFromEmptyList(emptyTenuredRegions_);
-        ASAN_UNPOISON_MEMORY_REGION(region, Region::HeadSize());
-        ASSERT(regionSize == region->Size());
-        regionPool_->NewRegion(region, this, regionSize, edenOrOldOrNonmovable, properties);
+        region = ReuseEmptyRegion(emptyTenuredRegions_, regionSize, edenOrOldOrNonmovable, properties);
     } else {
         ASSERT(regionPool_ != nullptr);
         region = regionPool_->NewRegion(this, spaceType_, allocatorType_, regionSize, edenOrOldOrNonmovable, properties,
                                         allocPolicy);
+        if (region != nullptr && numaTopology_ != nullptr) {
+            region->SetNumaNode(node);
+            numaTopology_->SetPreferredNode(region, region->Size(), node);
+        }
+        if (region == nullptr && youngRegionFlag) {
+            // There is no memory for a new region, so reuse an empty region of another NUMA node
+            auto regionList = std::find_if(emptyYoungRegions_.begin(), emptyYoungRegions_.end(),
+                                           [](const DList &list) { return !list.empty(); });
+            if (regionList != emptyYoungRegions_.end()) {
+                region = ReuseEmptyRegion(*regionList, regionSize, edenOrOldOrNonmovable, properties);
+            }
+        }
     }
     if (UNLIKELY(region == nullptr)) {
         return nullptr;
@@ -359,4 +368,17 @@ Region *RegionSpace::GetRegionFromEmptyList(DList &regionList)
     return region;
 }
 
+Region *RegionSpace::ReuseEmptyRegion(DList &regionList, size_t regionSize, RegionFlag edenOrOldOrNonmovable,
+                                      RegionFlag properties)
+{
+    Region *region = GetRegionFromEmptyList(regionList);
+    ASAN_UNPOISON_MEMORY_REGION(region, Region::HeadSize());
+    ASSERT(regionSize == region->Size());
+    // The region memory stays on the same node
+    auto node = region->GetNumaNode();
+    regionPool_->NewRegion(region, this, regionSize, edenOrOldOrNonmovable, properties);
+    region->SetNumaNode(node);
+    return region;
+}
+
 }  // namespace ark::mem
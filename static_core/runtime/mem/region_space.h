@@ -15,6 +15,7 @@
 #ifndef PANDA_RUNTIME_MEM_REGION_SPACE_H
 #define PANDA_RUNTIME_MEM_REGION_SPACE_H
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 
@@ -24,6 +25,7 @@
 #include "runtime/mem/tlab.h"
 #include "runtime/mem/rem_set.h"
 #include "runtime/mem/heap_space.h"
+#include "runtime/mem/numa_topology.h"
 
 namespace ark::mem {
 
@@ -81,6 +83,16 @@ public:
         space_ = newSpace;
     }
 
+    uint32_t GetNumaNode() const
+    {
+        return numaNode_;
+    }
+
+    void SetNumaNode(uint32_t node)
+    {
+        numaNode_ = node;
+    }
+
     uintptr_t Begin() const
     {
         return begin_;
@@ -397,6 +409,7 @@ private:
     uintptr_t end_;
     uintptr_t top_;
     uint32_t flags_ {0};
+    uint32_t numaNode_ {0};  // NUMA node of the region memory, 0 if the space is not NUMA-aware
     size_t allocatedObjects_ {0};
     std::atomic<uint32_t> *liveBytes_ {nullptr};
     std::atomic<uint32_t> *pinnedObjects_ {nullptr};
@@ -593,7 +606,26 @@ public:
 
     size_t GetEmptyYoungRegionsCount() const
     {
-        return emptyYoungRegions_.size();
+        size_t count = 0;
+        for (const auto &regionList : emptyYoungRegions_) {
+            count += regionList.size();
+        }
+        return count;
+    }
+
+    /**
+     * Make the space NUMA-aware: new regions are allocated on the node of the current thread
+     * and the empty young regions are reused by the threads of the same node
+     */
+    void SetNumaTopology(const NumaTopology *numaTopology)
+    {
+        ASSERT(regions_.empty());
+        numaTopology_ = numaTopology;
+    }
+
+    const NumaTopology *GetNumaTopology() const
+    {
+        return numaTopology_;
     }
 
 private:
@@ -602,6 +634,9 @@ private:
 
     Region *GetRegionFromEmptyList(DList &regionList);
 
+    Region *ReuseEmptyRegion(DList &regionList, size_t regionSize, RegionFlag edenOrOldOrNonmovable,
+                             RegionFlag properties);
+
     SpaceType spaceType_;
 
     // related allocator type
@@ -615,8 +650,11 @@ private:
     // region allocated by this space
     DList regions_;
 
-    // Empty regions which is not returned back
-    DList emptyYoungRegions_;
+    // NUMA nodes of the regions, nullptr if the space is not NUMA-aware
+    const NumaTopology *numaTopology_ {nullptr};
+
+    // Empty regions which is not returned back, young ones are kept per NUMA node
+    std::array<DList, NumaTopology::MAX_NODES_COUNT> emptyYoungRegions_;
     DList emptyTenuredRegions_;
     // Use atomic because it is updated in RegionSpace::PromoteYoungRegion without lock
     std::atomic<size_t> youngRegionsInUse_ {0};
@@ -25,7 +25,7 @@ namespace ark::mem {
 template <typename LockConfigT>
 RemSet<LockConfigT>::RemSet()
 {
-    bitmaps_.max_load_factor(DEFAULT_LOAD_FACTOR);
+    cardSets_.max_load_factor(DEFAULT_LOAD_FACTOR);
 }
 
 template <typename LockConfigT>
@@ -43,7 +43,7 @@ void RemSet<LockConfigT>::AddRef(const ObjectHeader *fromObjAddr, size_t offset)
     auto bitmapBeginAddr = ref & ~DEFAULT_REGION_MASK;
     os::memory::LockHolder<LockConfigT, NEED_LOCK> lock(remSetLock_);
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    bitmaps_[bitmapBeginAddr].Set(GetIdxInBitmap(ref, bitmapBeginAddr));
+    cardSets_[bitmapBeginAddr].Set(GetIdxInBitmap(ref, bitmapBeginAddr));
 }
 
 template <typename LockConfigT>
@@ -55,14 +55,14 @@ void RemSet<LockConfigT>::AddRef(const void *fromAddr)
     auto bitmapBeginAddr = ref & ~DEFAULT_REGION_MASK;
     os::memory::LockHolder<LockConfigT, NEED_LOCK> lock(remSetLock_);
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    bitmaps_[bitmapBeginAddr].Set(GetIdxInBitmap(ref, bitmapBeginAddr));
+    cardSets_[bitmapBeginAddr].Set(GetIdxInBitmap(ref, bitmapBeginAddr));
 }
 
 template <typename LockConfigT>
 void RemSet<LockConfigT>::Clear()
 {
     os::memory::LockHolder lock(remSetLock_);
-    bitmaps_.clear();
+    cardSets_.clear();
 }
 
 template <typename LockConfigT>
@@ -73,18 +73,18 @@ void RemSet<LockConfigT>::InvalidateRegion(Region *invalidRegion)
 
     for (auto bitmapBeginAddr = ToUintPtr(invalidRegion); bitmapBeginAddr < invalidRegion->End();
          bitmapBeginAddr += DEFAULT_REGION_SIZE) {
-        bitmaps_.erase(bitmapBeginAddr);
+        cardSets_.erase(bitmapBeginAddr);
     }
 }
 
 template <typename LockConfigT>
 void RemSet<LockConfigT>::RemoveInvalidRegions()
 {
-    for (auto it = bitmaps_.begin(); it != bitmaps_.end();) {
+    for (auto it = cardSets_.begin(); it != cardSets_.end();) {
         auto &[bitmap_begin_addr, _] = *it;
         auto *region = AddrToRegion(ToVoidPtr(bitmap_begin_addr));
         if (region->HasFlag(RegionFlag::IS_INVALID) || region->HasFlag(RegionFlag::IS_COLLECTION_SET)) {
-            it = bitmaps_.erase(it);
+            it = cardSets_.erase(it);
         } else {
             ++it;
         }
@@ -94,16 +94,26 @@ void RemSet<LockConfigT>::RemoveInvalidRegions()
 template <typename LockConfigT>
 void RemSet<LockConfigT>::Merge(RemSet<> *other)
 {
-    for (auto &[bitmap_begin_addr, bitmap] : other->bitmaps_) {
-        bitmaps_[bitmap_begin_addr].AddBits(bitmap);
+    for (auto &[bitmap_begin_addr, cardSet] : other->cardSets_) {
+        cardSets_[bitmap_begin_addr].AddCards(cardSet);
     }
 }
 
+template <typename LockConfigT>
+size_t RemSet<LockConfigT>::GetMemoryFootprint() const
+{
+    size_t footprint = sizeof(RemSet);
+    for (auto &[_, cardSet] : cardSets_) {
+        footprint += sizeof(uintptr_t) + cardSet.GetMemoryFootprint();
+    }
+    return footprint;
+}
+
 template <typename LockConfigT>
 PandaUnorderedSet<Region *> RemSet<LockConfigT>::GetDirtyRegions()
 {
     PandaUnorderedSet<Region *> regions;
-    for (auto &[bitmap_begin_addr, _] : bitmaps_) {
+    for (auto &[bitmap_begin_addr, _] : cardSets_) {
         auto *region = AddrToRegion(ToVoidPtr(bitmap_begin_addr));
         regions.insert(region);
     }
@@ -149,11 +159,11 @@ template <typename LockConfigT>
 template <typename RegionPred, typename MemVisitor>
 inline void RemSet<LockConfigT>::Iterate(const RegionPred &regionPred, const MemVisitor &visitor) const
 {
-    for (auto &[bitmapBeginAddr, bitmap] : bitmaps_) {
+    for (auto &[bitmapBeginAddr, cardSet] : cardSets_) {
         auto *region = AddrToRegion(ToVoidPtr(bitmapBeginAddr));
         if (regionPred(region)) {
             MemRange bitmapRange(bitmapBeginAddr, bitmapBeginAddr + DEFAULT_REGION_SIZE);
-            bitmap.Iterate(bitmapRange, [region, visitor](const MemRange &range) { visitor(region, range); });
+            cardSet.Iterate(bitmapRange, [region, visitor](const MemRange &range) { visitor(region, range); });
         }
     }
 }
@@ -201,10 +211,10 @@ void RemSet<LockConfigT>::Dump(std::ostream &out)
 
 template <typename LockConfigT>
 template <typename Visitor>
-void RemSet<LockConfigT>::VisitBitmaps(const Visitor &visitor) const
+void RemSet<LockConfigT>::VisitCardSets(const Visitor &visitor) const
 {
-    for (auto &[bitmapBeginAddr, bitmap] : bitmaps_) {
-        visitor(bitmapBeginAddr, bitmap);
+    for (auto &[bitmapBeginAddr, cardSet] : cardSets_) {
+        visitor(bitmapBeginAddr, cardSet);
     }
 }
 
@@ -220,10 +230,10 @@ void GlobalRemSet::ProcessRemSets(const RegionContainer &cont, const RegionPred
 template <typename RegionPred>
 void GlobalRemSet::FillBitmap(const RemSet<> &remSet, const RegionPred &regionPred)
 {
-    remSet.VisitBitmaps([this, &regionPred](uintptr_t beginAddr, const RemSet<>::Bitmap &bitmap) {
+    remSet.VisitCardSets([this, &regionPred](uintptr_t beginAddr, const RemSet<>::CardSet &cardSet) {
         auto *region = AddrToRegion(ToVoidPtr(beginAddr));
         if (regionPred(region)) {
-            bitmaps_[beginAddr].AddBits(bitmap);
+            cardSet.AddTo(&bitmaps_[beginAddr]);
         }
     });
 }
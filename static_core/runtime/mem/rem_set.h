@@ -16,8 +16,11 @@
 #ifndef PANDA_MEM_GC_G1_REM_SET_H
 #define PANDA_MEM_GC_G1_REM_SET_H
 
+#include <algorithm>
 #include <limits>
+#include <libarkbase/utils/bit_utils.h>
 #include <runtime/include/mem/panda_containers.h>
+#include <runtime/include/mem/panda_smart_pointers.h>
 
 namespace ark::mem {
 
@@ -62,9 +65,12 @@ public:
 
     size_t Size() const
     {
-        return bitmaps_.size();
+        return cardSets_.size();
     }
 
+    /// @return memory used by the card sets of the remset
+    size_t GetMemoryFootprint() const;
+
     void Merge(RemSet<> *other);
     PandaUnorderedSet<Region *> GetDirtyRegions();
 
@@ -88,7 +94,7 @@ public:
     void Dump(std::ostream &out);
 
     template <typename Visitor>
-    void VisitBitmaps(const Visitor &visitor) const;
+    void VisitCardSets(const Visitor &visitor) const;
 
     static size_t GetIdxInBitmap(uintptr_t addr, uintptr_t bitmapBeginAddr);
 
@@ -127,6 +133,19 @@ public:
             }
         }
 
+        template <typename Visitor>
+        void VisitSetBits(const Visitor &visitor) const
+        {
+            for (size_t i = 0; i < SIZE; ++i) {
+                uint64_t elem = bitmap_[i];
+                while (elem > 0) {
+                    auto bitOffset = static_cast<size_t>(Ctz(elem));
+                    visitor(i * ELEM_BITS + bitOffset);
+                    elem &= elem - 1U;
+                }
+            }
+        }
+
         template <typename Visitor>
         void Iterate(const MemRange &range, const Visitor &visitor) const
         {
@@ -151,11 +170,159 @@ public:
         std::array<uint64_t, SIZE> bitmap_ {0};
     };
 
+    /**
+     * Cards of one region, which refer to the region of the remset. The representation depends on the number of cards:
+     * a few card indices are stored inline, then the cards are stored in the bitmap, and when most of the cards are
+     * set the whole region is considered as referring one.
+     */
+    class CardSet {
+    public:
+        enum class Kind : uint8_t { SPARSE, BITMAP, FULL };
+
+        void Set(size_t idx)
+        {
+            ASSERT(idx < Bitmap::GetNumBits());
+            switch (kind_) {
+                case Kind::SPARSE:
+                    SetSparse(idx);
+                    break;
+                case Kind::BITMAP:
+                    if (!bitmap_->Check(idx)) {
+                        bitmap_->Set(idx);
+                        ++count_;
+                        PromoteToFullIfNeeded();
+                    }
+                    break;
+                default:
+                    ASSERT(kind_ == Kind::FULL);
+                    break;
+            }
+        }
+
+        bool Check(size_t idx) const
+        {
+            switch (kind_) {
+                case Kind::SPARSE:
+                    return std::find(sparse_.cbegin(), sparse_.cbegin() + count_, idx) != sparse_.cbegin() + count_;
+                case Kind::BITMAP:
+                    return bitmap_->Check(idx);
+                default:
+                    ASSERT(kind_ == Kind::FULL);
+                    return true;
+            }
+        }
+
+        void AddCards(const CardSet &other)
+        {
+            if (other.kind_ == Kind::FULL) {
+                SetFull();
+                return;
+            }
+            other.VisitCards([this](size_t idx) { Set(idx); });
+        }
+
+        void AddTo(Bitmap *bitmap) const
+        {
+            VisitCards([bitmap](size_t idx) { bitmap->Set(idx); });
+        }
+
+        template <typename Visitor>
+        void VisitCards(const Visitor &visitor) const
+        {
+            switch (kind_) {
+                case Kind::SPARSE:
+                    std::for_each(sparse_.cbegin(), sparse_.cbegin() + count_, visitor);
+                    break;
+                case Kind::BITMAP:
+                    bitmap_->VisitSetBits(visitor);
+                    break;
+                default:
+                    ASSERT(kind_ == Kind::FULL);
+                    for (size_t idx = 0; idx < Bitmap::GetNumBits(); ++idx) {
+                        visitor(idx);
+                    }
+                    break;
+            }
+        }
+
+        template <typename Visitor>
+        void Iterate(const MemRange &range, const Visitor &visitor) const
+        {
+            if (kind_ == Kind::BITMAP) {
+                bitmap_->Iterate(range, visitor);
+                return;
+            }
+            size_t memSize = (range.GetEndAddress() - range.GetStartAddress()) / Bitmap::GetNumBits();
+            uintptr_t startAddr = range.GetStartAddress();
+            VisitCards([startAddr, memSize, &visitor](size_t idx) {
+                uintptr_t addr = startAddr + idx * memSize;
+                visitor(MemRange(addr, addr + memSize));
+            });
+        }
+
+        Kind GetKind() const
+        {
+            return kind_;
+        }
+
+        size_t GetCardsCount() const
+        {
+            return count_;
+        }
+
+        size_t GetMemoryFootprint() const
+        {
+            return sizeof(CardSet) + (bitmap_ != nullptr ? Bitmap::GetBitmapSizeInBytes() : 0U);
+        }
+
+    private:
+        void SetSparse(size_t idx)
+        {
+            if (Check(idx)) {
+                return;
+            }
+            if (count_ < SPARSE_CAPACITY) {
+                sparse_[count_++] = static_cast<uint16_t>(idx);
+                return;
+            }
+            bitmap_ = MakePandaUnique<Bitmap>();
+            for (auto card : sparse_) {
+                bitmap_->Set(card);
+            }
+            bitmap_->Set(idx);
+            ++count_;
+            kind_ = Kind::BITMAP;
+        }
+
+        void PromoteToFullIfNeeded()
+        {
+            if (count_ >= FULL_THRESHOLD) {
+                SetFull();
+            }
+        }
+
+        void SetFull()
+        {
+            bitmap_.reset();
+            count_ = Bitmap::GetNumBits();
+            kind_ = Kind::FULL;
+        }
+
+        static constexpr size_t SPARSE_CAPACITY = 8U;
+        // Scanning of the whole region costs almost the same, but the bitmap memory is released
+        static constexpr size_t FULL_THRESHOLD = Bitmap::GetNumBits() * 3U / 4U;
+        static_assert(Bitmap::GetNumBits() <= std::numeric_limits<uint16_t>::max());
+
+        PandaUniquePtr<Bitmap> bitmap_ {nullptr};
+        std::array<uint16_t, SPARSE_CAPACITY> sparse_ {};
+        uint16_t count_ {0};
+        Kind kind_ {Kind::SPARSE};
+    };
+
 private:
     LockConfigT remSetLock_;
     static constexpr float DEFAULT_LOAD_FACTOR = 0.7F;
-    // NOTE(alovkov): make value a Set?
-    PandaUnorderedMap<uintptr_t, Bitmap> bitmaps_;
+    PandaUnorderedMap<uintptr_t, CardSet> cardSets_;
 
     friend class test::RemSetTest;
 };
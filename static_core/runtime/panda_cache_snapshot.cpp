@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/panda_cache_snapshot.h"
+
+#include "libarkbase/utils/logger.h"
+#include "libarkfile/panda_cache.h"
+#include "runtime/include/class_linker.h"
+#include "runtime/include/field.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string_view>
+
+namespace ark {
+
+namespace {
+
+// Upper bounds used to reject a corrupted snapshot before allocating memory for it
+constexpr uint32_t MAX_FILENAME_LENGTH = 4096U;
+constexpr uint32_t MAX_IDS_PER_KIND = 1U << 16U;
+
+class SuppressErrorHandler : public ClassLinkerErrorHandler {
+    void OnError([[maybe_unused]] ClassLinker::Error error, [[maybe_unused]] const PandaString &message) override {}
+};
+
+template <typename T>
+bool WriteValue(std::ofstream &fd, const T &value)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    fd.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    return fd.good();
+}
+
+template <typename T>
+bool ReadValue(std::ifstream &fd, T *value)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    fd.read(reinterpret_cast<char *>(value), sizeof(T));
+    return fd.good();
+}
+
+bool WriteIds(std::ofstream &fd, const PandaVector<uint32_t> &ids)
+{
+    if (!WriteValue(fd, static_cast<uint32_t>(ids.size()))) {
+        return false;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    fd.write(reinterpret_cast<const char *>(ids.data()), static_cast<std::streamsize>(ids.size() * sizeof(uint32_t)));
+    return fd.good();
+}
+
+bool ReadIds(std::ifstream &fd, PandaVector<uint32_t> *ids)
+{
+    uint32_t count = 0;
+    if (!ReadValue(fd, &count) || count > MAX_IDS_PER_KIND) {
+        return false;
+    }
+    ids->resize(count);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    fd.read(reinterpret_cast<char *>(ids->data()), static_cast<std::streamsize>(count * sizeof(uint32_t)));
+    return fd.good();
+}
+
+}  // namespace
+
+void PandaCacheSnapshot::AddFile(const panda_file::File &pf)
+{
+    FileEntry entry;
+    entry.filename = ConvertToString(pf.GetFilename());
+    entry.checksum = pf.GetHeader()->checksum;
+    auto *cache = pf.GetPandaCache();
+    cache->EnumerateClassCache(
+        [&entry](panda_file::File::EntityId id, Class * /* klass */) { entry.classes.push_back(id.GetOffset()); });
+    cache->EnumerateMethodCache(
+        [&entry](panda_file::File::EntityId id, Method * /* method */) { entry.methods.push_back(id.GetOffset()); });
+    cache->EnumerateFieldCache([&entry](panda_file::File::EntityId id, Field *field) {
+        auto &fields = field->IsStatic() ? entry.staticFields : entry.instanceFields;
+        fields.push_back(id.GetOffset());
+    });
+    if (entry.Size() != 0) {
+        files_.push_back(std::move(entry));
+    }
+}
+
+const PandaCacheSnapshot::FileEntry *PandaCacheSnapshot::FindFile(const panda_file::File &pf) const
+{
+    for (const auto &entry : files_) {
+        if (std::string_view(entry.filename) == pf.GetFilename()) {
+            return entry.checksum == pf.GetHeader()->checksum ? &entry : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+size_t PandaCacheSnapshot::Prewarm(ClassLinker *classLinker, ClassLinkerContext *bootContext) const
+{
+    ASSERT(classLinker != nullptr);
+    ASSERT(bootContext != nullptr);
+    SuppressErrorHandler handler;
+    size_t resolved = 0;
+    // Copy the list, class resolution in the boot context takes the boot panda files lock
+    PandaVector<const panda_file::File *> bootFiles = classLinker->GetBootPandaFiles();
+    for (const auto *pf : bootFiles) {
+        const auto *entry = FindFile(*pf);
+        if (entry == nullptr) {
+            continue;
+        }
+        uint32_t fileSize = pf->GetHeader()->fileSize;
+        auto isValid = [fileSize](uint32_t offset) { return offset != 0 && offset < fileSize; };
+        for (auto offset : entry->classes) {
+            if (isValid(offset) &&
+                classLinker->GetClass(*pf, panda_file::File::EntityId(offset), bootContext, &handler) != nullptr) {
+                resolved++;
+            }
+        }
+        for (auto offset : entry->methods) {
+            if (isValid(offset) &&
+                classLinker->GetMethod(*pf, panda_file::File::EntityId(offset), bootContext, &handler) != nullptr) {
+                resolved++;
+            }
+        }
+        auto resolveFields = [&](const PandaVector<uint32_t> &fields, bool isStatic) {
+            for (auto offset : fields) {
+                if (!isValid(offset)) {
+                    continue;
+                }
+                panda_file::File::EntityId id(offset);
+                auto *field = classLinker->GetField(*pf, id, isStatic, bootContext, &handler);
+                if (field != nullptr) {
+                    pf->GetPandaCache()->SetFieldCache(id, field);
+                    resolved++;
+                }
+            }
+        };
+        resolveFields(entry->staticFields, true);
+        resolveFields(entry->instanceFields, false);
+    }
+    return resolved;
+}
+
+bool PandaCacheSnapshot::Save(const PandaString &path) const
+{
+    auto tmpPath = path + ".tmp";
+    std::ofstream fd(tmpPath.c_str(), std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!fd.is_open()) {
+        LOG(ERROR, RUNTIME) << "Failed to open PandaCache snapshot for writing: " << tmpPath;
+        return false;
+    }
+    bool ok = WriteValue(fd, MAGIC) && WriteValue(fd, VERSION) && WriteValue(fd, static_cast<uint32_t>(files_.size()));
+    for (auto it = files_.begin(); ok && it != files_.end(); ++it) {
+        ok = WriteValue(fd, static_cast<uint32_t>(it->filename.size()));
+        fd.write(it->filename.data(), static_cast<std::streamsize>(it->filename.size()));
+        ok = ok && fd.good() && WriteValue(fd, it->checksum) && WriteIds(fd, it->classes) &&
+             WriteIds(fd, it->methods) && WriteIds(fd, it->staticFields) && WriteIds(fd, it->instanceFields);
+    }
+    fd.close();
+    // Rename, so that a concurrently starting runtime sees either the old or the new complete snapshot
+    if (!ok || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        LOG(ERROR, RUNTIME) << "Failed to write PandaCache snapshot " << path;
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+/* static */
+Expected<PandaCacheSnapshot, PandaString> PandaCacheSnapshot::Load(const PandaString &path)
+{
+    std::ifstream fd(path.c_str(), std::ios::binary | std::ios::in);
+    if (!fd.is_open()) {
+        return Unexpected(PandaString("Cannot open ") + path);
+    }
+    std::array<char, MAGIC.size()> magic {};
+    uint32_t version = 0;
+    uint32_t numFiles = 0;
+    if (!ReadValue(fd, &magic) || magic != MAGIC || !ReadValue(fd, &version) || version != VERSION ||
+        !ReadValue(fd, &numFiles)) {
+        return Unexpected(PandaString("Invalid header of ") + path);
+    }
+    PandaCacheSnapshot snapshot;
+    for (uint32_t i = 0; i < numFiles; i++) {
+        FileEntry entry;
+        uint32_t nameLen = 0;
+        if (!ReadValue(fd, &nameLen) || nameLen > MAX_FILENAME_LENGTH) {
+            return Unexpected(PandaString("Truncated ") + path);
+        }
+        entry.filename.resize(nameLen);
+        fd.read(entry.filename.data(), nameLen);
+        if (!fd.good() || !ReadValue(fd, &entry.checksum) || !ReadIds(fd, &entry.classes) ||
+            !ReadIds(fd, &entry.methods) || !ReadIds(fd, &entry.staticFields) || !ReadIds(fd, &entry.instanceFields)) {
+            return Unexpected(PandaString("Truncated ") + path);
+        }
+        snapshot.AddEntry(std::move(entry));
+    }
+    return snapshot;
+}
+
+}  // namespace ark
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_RUNTIME_PANDA_CACHE_SNAPSHOT_H
+#define PANDA_RUNTIME_PANDA_CACHE_SNAPSHOT_H
+
+#include "libarkbase/utils/expected.h"
+#include "libarkfile/file.h"
+#include "runtime/include/mem/panda_containers.h"
+#include "runtime/include/mem/panda_string.h"
+
+#include <array>
+#include <cstdint>
+
+namespace ark {
+
+class ClassLinker;
+class ClassLinkerContext;
+
+/**
+ * Snapshot of the PandaCache contents of the boot panda files.
+ * Only entity ids are stored, so the snapshot stays valid between runs while the panda files are unchanged,
+ * which is checked via the file checksum. On startup the ids are resolved again to pre-warm the caches.
+ */
+class PandaCacheSnapshot {
+public:
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr std::array<char, 8U> MAGIC = {'P', 'C', 'S', 'N', 'A', 'P', '\0', '\0'};
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr uint32_t VERSION = 1U;
+
+    struct FileEntry {
+        PandaString filename;
+        uint32_t checksum {0};
+        PandaVector<uint32_t> classes;
+        PandaVector<uint32_t> methods;
+        PandaVector<uint32_t> staticFields;
+        PandaVector<uint32_t> instanceFields;
+
+        size_t Size() const
+        {
+            return classes.size() + methods.size() + staticFields.size() + instanceFields.size();
+        }
+    };
+
+    /// Records the entities currently cached in the PandaCache of @param pf
+    void AddFile(const panda_file::File &pf);
+
+    void AddEntry(FileEntry entry)
+    {
+        files_.push_back(std::move(entry));
+    }
+
+    /// @return the entry recorded for @param pf or nullptr if there is none or the file has been changed
+    const FileEntry *FindFile(const panda_file::File &pf) const;
+
+    const PandaVector<FileEntry> &GetFiles() const
+    {
+        return files_;
+    }
+
+    /**
+     * Resolves the recorded entities of the boot panda files, filling their PandaCache.
+     * Entities which can't be resolved anymore are skipped.
+     * @return number of resolved entities
+     */
+    size_t Prewarm(ClassLinker *classLinker, ClassLinkerContext *bootContext) const;
+
+    bool Save(const PandaString &path) const;
+
+    static Expected<PandaCacheSnapshot, PandaString> Load(const PandaString &path);
+
+private:
+    PandaVector<FileEntry> files_;
+};
+
+}  // namespace ark
+
+#endif  // PANDA_RUNTIME_PANDA_CACHE_SNAPSHOT_H
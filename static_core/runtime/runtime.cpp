@@ -78,6 +78,7 @@
 #include "libarkbase/trace/trace.h"
 #include "runtime/tests/intrusive-tests/intrusive_test_option.h"
 #include "runtime/jit/profiling_saver.h"
+#include "runtime/panda_cache_snapshot.h"
 #include "runtime/execution/coroutines/native_stack_allocator/native_stack_allocator.h"
 #ifdef PANDA_OHOS_GET_PARAMETER
 #include "syspara/parameters.h"
@@ -450,9 +451,18 @@ bool Runtime::Create(const RuntimeOptions &options)
     if (options_.IsSamplingProfilerCreate()) {
         instance_->GetTools().CreateSamplingProfiler();
         if (options_.IsSamplingProfilerStartupRun()) {
-            instance_->GetTools().StartSamplingProfiler(
-                std::make_unique<tooling::sampler::FileStreamWriter>(options_.GetSamplingProfilerOutputFile().c_str()),
-                options_.GetSamplingProfilerInterval());
+            std::unique_ptr<tooling::sampler::StreamWriter> writer;
+            if (options_.IsSamplingProfilerAggregate()) {
+                tooling::sampler::StackAggregator::Options aggregatorOptions;
+                aggregatorOptions.outputFile = options_.GetSamplingProfilerOutputFile();
+                aggregatorOptions.flushIntervalUs = options_.GetSamplingProfilerFlushInterval() * 1000ULL;
+                writer = std::make_unique<tooling::sampler::AggregatingStreamWriter>(
+                    std::make_shared<tooling::sampler::StackAggregator>(std::move(aggregatorOptions)));
+            } else {
+                writer = std::make_unique<tooling::sampler::FileStreamWriter>(
+                    options_.GetSamplingProfilerOutputFile().c_str());
+            }
+            instance_->GetTools().StartSamplingProfiler(std::move(writer), options_.GetSamplingProfilerInterval());
         }
     }
 
@@ -626,6 +636,10 @@ bool Runtime::Destroy()
         }
     }
 
+    if (GetOptions().IsSavePandaCacheSnapshot()) {
+        instance_->SavePandaCacheSnapshot();
+    }
+
     if (GetOptions().ShouldLoadBootPandaFiles()) {
         // Performing some actions before Runtime destroy.
         // For example, traversing FinalizableWeakRefList
@@ -1179,6 +1193,8 @@ bool Runtime::Initialize()
         return false;
     }
 
+    PrewarmPandaCache();
+
     if (IsDebugMode()) {
         pandaVm_->LoadDebuggerAgent();
     }
@@ -1191,6 +1207,44 @@ bool Runtime::Initialize()
     return true;
 }
 
+void Runtime::PrewarmPandaCache()
+{
+    if (options_.GetPandaCacheSnapshot().empty() || !options_.ShouldLoadBootPandaFiles()) {
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    auto snapshot = PandaCacheSnapshot::Load(ConvertToString(options_.GetPandaCacheSnapshot()));
+    if (!snapshot) {
+        LOG(INFO, RUNTIME) << "PandaCache snapshot is not used: " << snapshot.Error();
+        return;
+    }
+    auto *bootContext = classLinker_->GetExtension(GetLanguageContext(GetRuntimeType()))->GetBootContext();
+    size_t resolved = 0;
+    {
+        ScopedManagedCodeThread smct(ManagedThread::GetCurrent());
+        resolved = snapshot.Value().Prewarm(classLinker_, bootContext);
+    }
+    auto duration = Clock::now() - start;
+    LOG(INFO, RUNTIME) << "Pre-warm PandaCache with " << resolved << " entities in "
+                       << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() << "us";
+}
+
+void Runtime::SavePandaCacheSnapshot() const
+{
+    if (options_.GetPandaCacheSnapshot().empty()) {
+        LOG(ERROR, RUNTIME) << "Cannot save PandaCache snapshot: --panda-cache-snapshot is not set";
+        return;
+    }
+    PandaCacheSnapshot snapshot;
+    classLinker_->EnumerateBootPandaFiles([&snapshot](const panda_file::File &pf) {
+        snapshot.AddFile(pf);
+        return true;
+    });
+    snapshot.Save(ConvertToString(options_.GetPandaCacheSnapshot()));
+}
+
 int Runtime::StartMemAllocDumper(const PandaString &dumpFile)
 {
     ASSERT(memAllocDumper_ == nullptr);
@@ -1273,6 +1327,23 @@ PandaString Runtime::GetMemoryStatistics()
     return pandaVm_->GetClassesFootprint();
 }
 
+PandaString Runtime::GetInterpreterCacheStatistics()
+{
+#ifndef PANDA_INTERPRETER_CACHE_STATISTICS
+    return "Interpreter call site cache: statistics are not collected in this build\n";
+#else
+    auto stats = InterpreterCache::GetRetiredCallSiteStats();
+    pandaVm_->GetThreadManager()->EnumerateThreads([&stats](ManagedThread *thread) {
+        stats += thread->GetInterpreterCache()->GetCallSiteStats();
+        return true;
+    });
+    PandaStringStream statistic;
+    statistic << "Interpreter call site cache: hits - " << stats.hits << ", misses - " << stats.misses
+              << ", megamorphic misses - " << stats.megamorphicMisses << std::endl;
+    return statistic.str();
+#endif
+}
+
 void Runtime::NotifyAboutLoadedModules()
 {
     PandaVector<const panda_file::File *> pfs;
@@ -1710,6 +1781,7 @@ void Runtime::DumpForSigQuit(std::ostream &os)
     // dump memory management
     os << "-> Dump memory management\n";
     os << GetMemoryStatistics();
+    os << GetInterpreterCacheStatistics();
     os << "\n";
 
     // dump PandaVM
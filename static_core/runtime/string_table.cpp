@@ -75,11 +75,21 @@ size_t StringTable::Size()
     return internalTable_.Size() + table_.Size();
 }
 
+StringTable::Table::Table(mem::InternalAllocatorPtr allocator)
+{
+    for (auto &shard : shards_) {
+        os::memory::WriteLockHolder holder(shard.lock);
+        shard.table = PandaUnorderedMultiMap<uint32_t, coretypes::String *>(allocator->Adapter());
+    }
+}
+
 void StringTable::Table::VisitStrings(const StringVisitor &visitor)
 {
-    os::memory::ReadLockHolder holder(tableLock_);
-    for (auto entry : table_) {
-        visitor(entry.second);
+    for (auto &shard : shards_) {
+        os::memory::ReadLockHolder holder(shard.lock);
+        for (auto entry : shard.table) {
+            visitor(entry.second);
+        }
     }
 }
 
@@ -87,8 +97,9 @@ coretypes::String *StringTable::Table::GetString(const uint8_t *utf8Data, uint32
                                                  [[maybe_unused]] const LanguageContext &ctx)
 {
     uint32_t hashCode = coretypes::String::ComputeHashcodeMutf8(utf8Data, utf16Length, canBeCompressed);
-    os::memory::ReadLockHolder holder(tableLock_);
-    for (auto it = table_.find(hashCode); it != table_.end(); it++) {
+    auto &shard = GetShard(hashCode);
+    os::memory::ReadLockHolder holder(shard.lock);
+    for (auto it = shard.table.find(hashCode); it != shard.table.end(); it++) {
         auto foundString = it->second;
         if (coretypes::String::StringsAreEqualMUtf8(foundString, utf8Data, utf16Length, canBeCompressed)) {
             return foundString;
@@ -101,8 +112,9 @@ coretypes::String *StringTable::Table::GetString(const uint16_t *utf16Data, uint
                                                  [[maybe_unused]] const LanguageContext &ctx)
 {
     uint32_t hashCode = coretypes::String::ComputeHashcodeUtf16(utf16Data, utf16Length);
-    os::memory::ReadLockHolder holder(tableLock_);
-    for (auto it = table_.find(hashCode); it != table_.end(); it++) {
+    auto &shard = GetShard(hashCode);
+    os::memory::ReadLockHolder holder(shard.lock);
+    for (auto it = shard.table.find(hashCode); it != shard.table.end(); it++) {
         auto foundString = it->second;
         if (coretypes::String::StringsAreEqualUtf16(foundString, utf16Data, utf16Length)) {
             return foundString;
@@ -114,9 +126,10 @@ coretypes::String *StringTable::Table::GetString(const uint16_t *utf16Data, uint
 coretypes::String *StringTable::Table::GetString(coretypes::String *string, [[maybe_unused]] const LanguageContext &ctx)
 {
     ASSERT(string != nullptr);
-    os::memory::ReadLockHolder holder(tableLock_);
     auto hash = coretypes::String::Cast(string)->GetHashcode();
-    for (auto it = table_.find(hash); it != table_.end(); it++) {
+    auto &shard = GetShard(hash);
+    os::memory::ReadLockHolder holder(shard.lock);
+    for (auto it = shard.table.find(hash); it != shard.table.end(); it++) {
         auto foundString = it->second;
         if (coretypes::String::StringsAreEqual(foundString, string)) {
             return foundString;
@@ -127,8 +140,10 @@ coretypes::String *StringTable::Table::GetString(coretypes::String *string, [[ma
 
 void StringTable::Table::ForceInternString(coretypes::String *string, [[maybe_unused]] const LanguageContext &ctx)
 {
-    os::memory::WriteLockHolder holder(tableLock_);
-    table_.insert(std::pair<uint32_t, coretypes::String *>(coretypes::String::Cast(string)->GetHashcode(), string));
+    uint32_t hashCode = coretypes::String::Cast(string)->GetHashcode();
+    auto &shard = GetShard(hashCode);
+    os::memory::WriteLockHolder holder(shard.lock);
+    shard.table.insert(std::pair<uint32_t, coretypes::String *>(hashCode, string));
 }
 
 coretypes::String *StringTable::Table::InternString(coretypes::String *string,
@@ -136,15 +151,16 @@ coretypes::String *StringTable::Table::InternString(coretypes::String *string,
 {
     ASSERT(string != nullptr);
     uint32_t hashCode = coretypes::String::Cast(string)->GetHashcode();
-    os::memory::WriteLockHolder holder(tableLock_);
+    auto &shard = GetShard(hashCode);
+    os::memory::WriteLockHolder holder(shard.lock);
     // Check string is not present before actually creating and inserting
-    for (auto it = table_.find(hashCode); it != table_.end(); it++) {
+    for (auto it = shard.table.find(hashCode); it != shard.table.end(); it++) {
         auto foundString = it->second;
         if (coretypes::String::StringsAreEqual(foundString, string)) {
             return foundString;
         }
     }
-    table_.insert(std::pair<uint32_t, coretypes::String *>(hashCode, string));
+    shard.table.insert(std::pair<uint32_t, coretypes::String *>(hashCode, string));
     return string;
 }
 
@@ -218,48 +234,64 @@ coretypes::String *StringTable::Table::GetOrInternString(coretypes::String *stri
 
 void StringTable::Table::UpdateAndSweep(const ReferenceUpdater &updater)
 {
-    os::memory::WriteLockHolder holder(tableLock_);
-    auto it = table_.begin();
-    while (it != table_.end()) {
-        ObjectHeader *prevObject = it->second;
-        if (updater(reinterpret_cast<ObjectHeader **>(&it->second)) == ObjectStatus::ALIVE_OBJECT) {
-            if (it->second != prevObject) {
-                LOG(DEBUG, GC) << "StringTable: forwarded " << prevObject << " -> " << it->second;
+    // Only one shard is locked at a time, so mutators can use the rest of the table meanwhile
+    for (auto &shard : shards_) {
+        os::memory::WriteLockHolder holder(shard.lock);
+        auto it = shard.table.begin();
+        while (it != shard.table.end()) {
+            ObjectHeader *prevObject = it->second;
+            if (updater(reinterpret_cast<ObjectHeader **>(&it->second)) == ObjectStatus::ALIVE_OBJECT) {
+                if (it->second != prevObject) {
+                    LOG(DEBUG, GC) << "StringTable: forwarded " << prevObject << " -> " << it->second;
+                }
+                ++it;
+            } else {
+                shard.table.erase(it++);
+                LOG(DEBUG, GC) << "StringTable: delete " << prevObject;
             }
-            ++it;
-        } else {
-            table_.erase(it++);
-            LOG(DEBUG, GC) << "StringTable: delete " << prevObject;
         }
     }
 }
 
-// NOTE(alovkov): make parallel
 void StringTable::Table::Sweep(const GCObjectVisitor &gcObjectVisitor)
 {
-    os::memory::WriteLockHolder holder(tableLock_);
     LOG(DEBUG, GC) << "=== StringTable Sweep. BEGIN ===";
-    LOG(DEBUG, GC) << "StringTable iterate over: " << table_.size() << " elements in string table";
-    for (auto it = table_.begin(), end = table_.end(); it != end;) {
-        auto *object = it->second;
-        if (gcObjectVisitor(object) == ObjectStatus::ALIVE_OBJECT) {
-            // All references in the string table must be updated before.
-            ASSERT(!object->IsForwarded());
-            ++it;
-        } else if (gcObjectVisitor(object) == ObjectStatus::DEAD_OBJECT) {
-            LOG(DEBUG, GC) << "StringTable: delete string " << std::hex << object
-                           << ", val = " << ConvertToString(object);
-            table_.erase(it++);
+    // Only one shard is locked at a time, so mutators can use the rest of the table meanwhile
+    for (auto &shard : shards_) {
+        os::memory::WriteLockHolder holder(shard.lock);
+        for (auto it = shard.table.begin(), end = shard.table.end(); it != end;) {
+            auto *object = it->second;
+            if (gcObjectVisitor(object) == ObjectStatus::ALIVE_OBJECT) {
+                // All references in the string table must be updated before.
+                ASSERT(!object->IsForwarded());
+                ++it;
+            } else if (gcObjectVisitor(object) == ObjectStatus::DEAD_OBJECT) {
+                LOG(DEBUG, GC) << "StringTable: delete string " << std::hex << object
+                               << ", val = " << ConvertToString(object);
+                shard.table.erase(it++);
+            }
         }
     }
-    LOG(DEBUG, GC) << "StringTable size after sweep = " << table_.size();
+    LOG(DEBUG, GC) << "StringTable size after sweep = " << Size();
     LOG(DEBUG, GC) << "=== StringTable Sweep. END ===";
 }
 
 size_t StringTable::Table::Size()
 {
-    os::memory::ReadLockHolder holder(tableLock_);
-    return table_.size();
+    size_t size = 0;
+    for (auto &shard : shards_) {
+        os::memory::ReadLockHolder holder(shard.lock);
+        size += shard.table.size();
+    }
+    return size;
+}
+
+void StringTable::Table::Clear()
+{
+    for (auto &shard : shards_) {
+        os::memory::WriteLockHolder holder(shard.lock);
+        shard.table.clear();
+    }
 }
 
 coretypes::String *StringTable::InternalTable::GetOrInternString(const uint8_t *mutf8Data, uint32_t utf16Length,
@@ -357,20 +389,22 @@ void StringTable::InternalTable::VisitRoots(const GCRootVisitor &visitor, mem::V
                              mem::VisitGCRootFlags::END_RECORDING_NEW_ROOT)) <= 1);
     // need to set flags before we iterate, because concurrent allocation should be in proper table
     if ((flags & mem::VisitGCRootFlags::START_RECORDING_NEW_ROOT) != 0) {
-        os::memory::WriteLockHolder holder(tableLock_);
+        os::memory::LockHolder holder(newStringsLock_);
         recordNewString_ = true;
     } else if ((flags & mem::VisitGCRootFlags::END_RECORDING_NEW_ROOT) != 0) {
-        os::memory::WriteLockHolder holder(tableLock_);
+        os::memory::LockHolder holder(newStringsLock_);
         recordNewString_ = false;
     }
 
     if ((flags & mem::VisitGCRootFlags::ACCESS_ROOT_ALL) != 0) {
-        os::memory::ReadLockHolder lock(tableLock_);
-        for (auto &v : table_) {
-            visitor({mem::RootType::STRING_TABLE, reinterpret_cast<ObjectHeader **>(&v.second)});
+        for (auto &shard : shards_) {
+            os::memory::ReadLockHolder lock(shard.lock);
+            for (auto &v : shard.table) {
+                visitor({mem::RootType::STRING_TABLE, reinterpret_cast<ObjectHeader **>(&v.second)});
+            }
         }
     } else if ((flags & mem::VisitGCRootFlags::ACCESS_ROOT_ONLY_NEW) != 0) {
-        os::memory::ReadLockHolder lock(tableLock_);
+        os::memory::LockHolder lock(newStringsLock_);
         for (auto &str : newStringTable_) {
             visitor({mem::RootType::STRING_TABLE, reinterpret_cast<ObjectHeader **>(&str)});
         }
@@ -378,7 +412,7 @@ void StringTable::InternalTable::VisitRoots(const GCRootVisitor &visitor, mem::V
         LOG(FATAL, RUNTIME) << "Unknown VisitGCRootFlags: " << static_cast<uint32_t>(flags);
     }
     if ((flags & mem::VisitGCRootFlags::END_RECORDING_NEW_ROOT) != 0) {
-        os::memory::WriteLockHolder holder(tableLock_);
+        os::memory::LockHolder holder(newStringsLock_);
         newStringTable_.clear();
     }
 }
@@ -387,7 +421,7 @@ coretypes::String *StringTable::InternalTable::InternStringNonMovable(coretypes:
                                                                       const LanguageContext &ctx)
 {
     auto *result = InternString(string, ctx);
-    os::memory::WriteLockHolder holder(tableLock_);
+    os::memory::LockHolder holder(newStringsLock_);
     if (recordNewString_) {
         newStringTable_.push_back(result);
     }
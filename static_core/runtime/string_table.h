@@ -15,8 +15,10 @@
 #ifndef PANDA_RUNTIME_STRING_TABLE_H_
 #define PANDA_RUNTIME_STRING_TABLE_H_
 
+#include <array>
 #include <cstdint>
 
+#include "libarkbase/generated/coherency_line_size.h"
 #include "libarkbase/mem/mem.h"
 #include "libarkbase/os/mutex.h"
 #include "runtime/include/coretypes/string.h"
@@ -72,9 +74,14 @@ public:
     size_t Size();
 
 protected:
+    /**
+     * The table is split into shards by the string hash, each shard has its own lock. So interning of strings
+     * with different hashes does not contend, and GC sweeps the table shard by shard without blocking the
+     * whole table.
+     */
     class PANDA_PUBLIC_API Table {
     public:
-        explicit Table(mem::InternalAllocatorPtr allocator) : table_(allocator->Adapter()) {}
+        explicit Table(mem::InternalAllocatorPtr allocator);
         Table() = default;
         virtual ~Table() = default;
 
@@ -102,14 +109,34 @@ protected:
         void ForceInternString(coretypes::String *string, const LanguageContext &ctx);
 
     protected:
+        // CC-OFFNXT(G.NAM.03-CPP) project code style
+        static constexpr size_t SHARDS_COUNT_LOG2 = 6U;
+        // CC-OFFNXT(G.NAM.03-CPP) project code style
+        static constexpr size_t SHARDS_COUNT = 1U << SHARDS_COUNT_LOG2;
+
+        struct alignas(ark::COHERENCY_LINE_SIZE) Shard {
+            os::memory::RWLock lock;  // NOLINT(misc-non-private-member-variables-in-classes)
+            // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+            PandaUnorderedMultiMap<uint32_t, coretypes::String *> table GUARDED_BY(lock) {};
+        };
+
+        Shard &GetShard(uint32_t hashCode)
+        {
+            // short strings have small hashes, so mix the high bits into the low ones
+            constexpr uint32_t SHIFT = 16U;
+            return shards_[(hashCode ^ (hashCode >> SHIFT)) & (SHARDS_COUNT - 1U)];
+        }
+
         // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
-        PandaUnorderedMultiMap<uint32_t, coretypes::String *> table_ GUARDED_BY(tableLock_) {};
-        os::memory::RWLock tableLock_;  // NOLINT(misc-non-private-member-variables-in-classes)
+        std::array<Shard, SHARDS_COUNT> shards_ {};
 
     private:
         NO_COPY_SEMANTIC(Table);
         NO_MOVE_SEMANTIC(Table);
 
+        /// Removes all the strings, used in tests only
+        void Clear();
+
         // Required to clear intern string in test
         friend class mem::test::MultithreadedInternStringTableTest;
     };
@@ -145,8 +172,9 @@ protected:
         coretypes::String *InternStringNonMovable(coretypes::String *string, const LanguageContext &ctx);
 
     private:
-        bool recordNewString_ {false};
-        PandaVector<coretypes::String *> newStringTable_ GUARDED_BY(tableLock_) {};
+        os::memory::Mutex newStringsLock_;
+        bool recordNewString_ GUARDED_BY(newStringsLock_) {false};
+        PandaVector<coretypes::String *> newStringTable_ GUARDED_BY(newStringsLock_) {};
         class EntityIdEqual {
         public:
             uint32_t operator()(const panda_file::File::EntityId &id) const
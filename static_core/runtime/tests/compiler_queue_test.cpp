@@ -20,6 +20,7 @@
 
 #include "assembly-parser.h"
 #include "runtime/compiler_queue_aged_counter_priority.h"
+#include "runtime/compiler_queue_cost_priority.h"
 #include "runtime/compiler_queue_counter_priority.h"
 #include "runtime/include/class-inl.h"
 #include "runtime/include/method.h"
@@ -539,6 +540,100 @@ TEST_F(CompilerQueueTest, AgedDeathCounter)
     ASSERT_EQ(method, nullptr);
 }
 
+// Testing of CostQueue
+
+TEST_F(CompilerQueueTest, CostEstimation)
+{
+    auto klass = TestClassPrepare();
+
+    Method *mainMethod = klass->GetDirectMethod(utf::CStringAsMutf8("main"));
+    ASSERT_NE(mainMethod, nullptr);
+
+    Method *fMethod = klass->GetDirectMethod(utf::CStringAsMutf8("f"));
+    ASSERT_NE(fMethod, nullptr);
+
+    constexpr uint32_t CALL_COST = 100;
+    // Methods without calls cost their bytecode size
+    ASSERT_EQ(CompilerPriorityCostQueue::EstimateCost(fMethod, CALL_COST), fMethod->GetCodeSize());
+    // Every call adds the call cost
+    ASSERT_EQ(CompilerPriorityCostQueue::EstimateCost(mainMethod, CALL_COST), mainMethod->GetCodeSize() + CALL_COST);
+    ASSERT_EQ(CompilerPriorityCostQueue::EstimateCost(mainMethod, 0), mainMethod->GetCodeSize());
+}
+
+TEST_F(CompilerQueueTest, CostCheaperFirst)
+{
+    auto klass = TestClassPrepare();
+
+    Method *mainMethod = klass->GetDirectMethod(utf::CStringAsMutf8("main"));
+    ASSERT_NE(mainMethod, nullptr);
+
+    Method *fMethod = klass->GetDirectMethod(utf::CStringAsMutf8("f"));
+    ASSERT_NE(fMethod, nullptr);
+
+    // Equal hotness, so the order is defined by the cost only
+    mainMethod->SetHotnessCounter(3U);
+    fMethod->SetHotnessCounter(3U);
+
+    RuntimeOptions options;
+    CompilerPriorityCostQueue queue(thread_->GetVM()->GetHeapManager()->GetInternalAllocator(),
+                                    options.GetCompilerQueueMaxLength(), options.GetCompilerTaskLifeSpan(),
+                                    options.GetCompilerQueueCallCost());
+    // The counter queue would return the first added method first
+    queue.AddTask(CompilerTask {mainMethod, false});
+    queue.AddTask(CompilerTask {fMethod, false});
+
+    auto task = queue.GetTask();
+    if (task.GetMethod() == nullptr) {
+        return;
+    }
+    if (task.GetMethod() == fMethod) {
+        ASSERT_EQ(task.GetEstimatedCost(),
+                  CompilerPriorityCostQueue::EstimateCost(fMethod, options.GetCompilerQueueCallCost()));
+        task = queue.GetTask();
+        if (task.GetMethod() == nullptr) {
+            return;
+        }
+    }
+    ASSERT_EQ(task.GetMethod(), mainMethod);
+    ASSERT_EQ(task.GetEstimatedCost(),
+              CompilerPriorityCostQueue::EstimateCost(mainMethod, options.GetCompilerQueueCallCost()));
+    ASSERT_EQ(queue.GetTask().GetMethod(), nullptr);
+}
+
+TEST_F(CompilerQueueTest, CostHotterFirst)
+{
+    auto klass = TestClassPrepare();
+
+    Method *mainMethod = klass->GetDirectMethod(utf::CStringAsMutf8("main"));
+    ASSERT_NE(mainMethod, nullptr);
+
+    Method *fMethod = klass->GetDirectMethod(utf::CStringAsMutf8("f"));
+    ASSERT_NE(fMethod, nullptr);
+
+    Method *gMethod = klass->GetDirectMethod(utf::CStringAsMutf8("g"));
+    ASSERT_NE(gMethod, nullptr);
+
+    mainMethod->SetHotnessCounter(0U);
+    fMethod->SetHotnessCounter(0U);
+    gMethod->SetHotnessCounter(0U);
+
+    RuntimeOptions options;
+    constexpr uint32_t CALL_COST = 10;
+    CompilerPriorityCostQueue queue(thread_->GetVM()->GetHeapManager()->GetInternalAllocator(),
+                                    options.GetCompilerQueueMaxLength(), options.GetCompilerTaskLifeSpan(), CALL_COST);
+
+    queue.AddTask(CompilerTask {gMethod, false});
+    queue.AddTask(CompilerTask {fMethod, false});
+    queue.AddTask(CompilerTask {mainMethod, false});
+
+    // The calls while waiting in the queue outweigh the cost of main
+    mainMethod->SetHotnessCounter(-1000U);
+    fMethod->SetHotnessCounter(-10U);
+    gMethod->SetHotnessCounter(-1U);
+
+    GetAndCheckMethodsIfExists(&queue, mainMethod, fMethod, gMethod);
+}
+
 // NOLINTEND(readability-magic-numbers)
 
 }  // namespace ark::test
@@ -516,4 +516,26 @@ TEST_F(G1AnalyticsTest, SinglePassCompactionPredictionTest)
         ASSERT_EQ(expectedTime, analytics.PredictYoungCollectionTimeInMicros(edenLength));
     }
 }
+
+TEST_F(G1AnalyticsTest, PauseCorrectionTest)
+{
+    const size_t edenLength = 16;
+    uint64_t now = START_TIME;
+    const auto startTimeDelta = -20'000'000;
+    G1Analytics analytics(now + startTimeDelta);
+    // No statistics yet, the predictions are used as is
+    ASSERT_EQ(1.0, analytics.PredictPauseCorrection());
+
+    auto collectionSet = CreateCollectionSet(edenLength);
+    FillAnalyticsUndefinedBehaviorTest(analytics, collectionSet, now);
+    // There was no prediction for the first pause
+    ASSERT_EQ(1.0, analytics.PredictPauseCorrection());
+
+    // The pause is 10ms while 7ms is predicted
+    const uint64_t nextPauseDelta = 20'000'000;
+    now += nextPauseDelta;
+    FillAnalyticsUndefinedBehaviorTest(analytics, collectionSet, now);
+    const double expectedCorrection = 10.0 / 7.0;
+    ASSERT_NEAR(expectedCorrection, analytics.PredictPauseCorrection(), 0.01);
+}
 }  // namespace ark::mem
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "runtime/mem/gc/g1/g1_heap_shrinker.h"
+
+namespace ark::mem {
+// NOLINTBEGIN(readability-magic-numbers)
+TEST(G1HeapShrinkerTest, ShrinkAfterConsecutiveLowOccupancy)
+{
+    G1HeapShrinker shrinker(40U, 3U, 1'000L);
+    int64_t nowMs = 10'000L;
+    // Load spike: the heap is fully used
+    ASSERT_FALSE(shrinker.AddCollection(100U, 100U, nowMs++));
+    // The recent occupancy decreases slowly, so the first collections after the spike do not shrink the heap
+    ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    ASSERT_GE(shrinker.GetOccupancy(), 0.4);
+    ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    ASSERT_LT(shrinker.GetOccupancy(), 0.4);
+    ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    ASSERT_TRUE(shrinker.AddCollection(10U, 100U, nowMs++));
+    // The heap is not shrunk again before the interval expires
+    for (size_t i = 0; i < 5U; ++i) {
+        ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    }
+    nowMs += 1'000L;
+    ASSERT_TRUE(shrinker.AddCollection(10U, 100U, nowMs));
+}
+
+TEST(G1HeapShrinkerTest, HighOccupancyRestartsCounting)
+{
+    G1HeapShrinker shrinker(40U, 2U, 0L);
+    int64_t nowMs = 10'000L;
+    ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    ASSERT_FALSE(shrinker.AddCollection(90U, 100U, nowMs++));
+    ASSERT_FALSE(shrinker.AddCollection(10U, 100U, nowMs++));
+    ASSERT_TRUE(shrinker.AddCollection(10U, 100U, nowMs++));
+    // Nothing is committed, nothing to shrink
+    ASSERT_FALSE(shrinker.AddCollection(0U, 0U, nowMs));
+}
+// NOLINTEND(readability-magic-numbers)
+}  // namespace ark::mem
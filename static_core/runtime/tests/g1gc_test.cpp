@@ -21,11 +21,13 @@
 #include "runtime/include/runtime.h"
 #include "runtime/include/panda_vm.h"
 #include "runtime/include/class_linker.h"
+#include "runtime/include/compiler_interface.h"
 #include "runtime/include/thread_scopes.h"
 #include "runtime/mem/vm_handle.h"
 #include "runtime/handle_scope-inl.h"
 #include "runtime/include/coretypes/array.h"
 #include "runtime/include/coretypes/line_string.h"
+#include "runtime/mem/gc/allocation_site_tracker.h"
 #include "runtime/mem/gc/card_table.h"
 #include "runtime/mem/gc/g1/g1-allocator.h"
 #include "runtime/mem/rem_set-inl.h"
@@ -33,6 +35,7 @@
 #include "runtime/mem/object_helpers.h"
 #include "runtime/mem/gc/g1/g1-gc.h"
 #include "runtime/mem/gc/gc_barrier_set.h"
+#include "assembly-parser.h"
 
 #include "test_utils.h"
 
@@ -386,6 +389,45 @@ TEST_F(G1GCTest, TestRegionInvalidationDuringFullGC)
     ASSERT_EQ(ObjectToRegion(oldString.GetPtr())->GetRemSet()->Size(), 0);
 }
 
+class G1GCParallelFullGCTest : public G1GCTest {
+public:
+    G1GCParallelFullGCTest() : G1GCTest(CreateOptions()) {}
+
+    static RuntimeOptions CreateOptions()
+    {
+        RuntimeOptions options = CreateDefaultOptions();
+        options.SetGcWorkersCount(2U);
+        return options;
+    }
+};
+
+TEST_F(G1GCParallelFullGCTest, TestRemsetAfterFullGCMovesYoungObjects)
+{
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    ASSERT_TRUE(gc->GetSettings()->ParallelRefUpdatingEnabled());
+    ManagedThread *thread = ManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+    // The humongous string is not moved by full GC, so the reference to it must be in the RemSet of its region
+    VMHandle<ObjectHeader> referent(thread, ObjectAllocator::AllocString(GetHumongousStringLength()));
+    VMHandle<coretypes::Array> holder(thread, ObjectAllocator::AllocArray(1U, ClassRoot::ARRAY_STRING, false));
+    ASSERT_TRUE(ObjectToRegion(holder.GetPtr())->IsYoung());
+    holder->Set(0, referent.GetPtr());
+
+    // The young holder is moved to a tenured region and GC workers enqueue the card of the reference
+    gc->WaitForGCInManaged(GCTask(GCTaskCause::EXPLICIT_CAUSE));
+    ASSERT_TRUE(ObjectToRegion(holder.GetPtr())->HasFlag(IS_OLD));
+    ASSERT_EQ(holder->Get<ObjectHeader *>(0), referent.GetPtr());
+    bool found = false;
+    ObjectToRegion(referent.GetPtr())->GetRemSet()->IterateOverObjects([&found, &holder](ObjectHeader *obj) {
+        if (obj == holder.GetPtr()) {
+            found = true;
+        }
+    });
+    ASSERT_TRUE(found);
+}
+
 TEST_F(G1GCTest, TestCollectTenured)
 {
     Runtime *runtime = Runtime::GetCurrent();
@@ -809,6 +851,625 @@ TEST_F(G1GCTest, TestMixedCollections)
     }
 }
 
+class EvacuatedRegionsChecker : public GCListener {
+public:
+    static constexpr size_t TLABS_COUNT = 8;
+
+    explicit EvacuatedRegionsChecker(ObjectAllocatorG1<> *allocator) : allocator_(allocator) {}
+
+    void SetEvacuatedRegions(PandaVector<Region *> regions)
+    {
+        evacuatedRegions_ = std::move(regions);
+        pauseFinished_ = false;
+    }
+
+    void GCPhaseFinished(GCPhase phase) override
+    {
+        // CollectAndMove ends inside the pause, after the collection set regions have been reset or deferred
+        if (phase != GCPhase::GC_PHASE_COLLECT_YOUNG_AND_MOVE || evacuatedRegions_.empty() || pauseFinished_) {
+            return;
+        }
+        pauseFinished_ = true;
+        auto allRegions = allocator_->GetAllRegions();
+        for (Region *region : evacuatedRegions_) {
+            if (std::find(allRegions.begin(), allRegions.end(), region) != allRegions.end() &&
+                region->HasFlag(RegionFlag::IS_COLLECTION_SET)) {
+                regionsAllocatedAtPauseEnd_++;
+            }
+        }
+    }
+
+    void GCPhaseStarted(GCPhase phase) override
+    {
+        // The cleanup phase starts after mutators are resumed, while the evacuated regions are not released yet
+        if (phase != GCPhase::GC_PHASE_CLEANUP || !pauseFinished_) {
+            return;
+        }
+        size_t tlabSize = DEFAULT_REGION_SIZE / 2;
+        for (size_t i = 0; i < TLABS_COUNT; i++) {
+            TLAB *tlab = allocator_->CreateNewTLAB(tlabSize);
+            if (tlab == nullptr) {
+                break;
+            }
+            Region *region = AddrToRegion(tlab->GetStartAddr());
+            if (region->HasFlag(RegionFlag::IS_COLLECTION_SET) ||
+                std::find(evacuatedRegions_.begin(), evacuatedRegions_.end(), region) != evacuatedRegions_.end()) {
+                evacuatedRegionsReused_++;
+            }
+            tlabsInDeferredWindow_++;
+        }
+    }
+
+    size_t GetRegionsAllocatedAtPauseEnd() const
+    {
+        return regionsAllocatedAtPauseEnd_;
+    }
+
+    size_t GetTlabsInDeferredWindow() const
+    {
+        return tlabsInDeferredWindow_;
+    }
+
+    size_t GetEvacuatedRegionsReused() const
+    {
+        return evacuatedRegionsReused_;
+    }
+
+private:
+    ObjectAllocatorG1<> *allocator_;
+    PandaVector<Region *> evacuatedRegions_;
+    bool pauseFinished_ {false};
+    size_t regionsAllocatedAtPauseEnd_ {0};
+    size_t tlabsInDeferredWindow_ {0};
+    size_t evacuatedRegionsReused_ {0};
+};
+
+template <bool CONCURRENT_RELEASE>
+class G1GCCollectionSetReleaseTest : public G1GCTest {
+public:
+    static constexpr size_t EVACUATED_REGIONS_COUNT = 2;
+
+    G1GCCollectionSetReleaseTest() : G1GCTest(CreateOptions()) {}
+
+    static RuntimeOptions CreateOptions()
+    {
+        RuntimeOptions options = CreateDefaultOptions();
+        options.SetG1ConcurrentCollectionSetRelease(CONCURRENT_RELEASE);
+        // Single pass compaction has no CollectAndMove phase, which EvacuatedRegionsChecker relies on
+        options.SetG1SinglePassCompactionEnabled(false);
+        return options;
+    }
+
+    /// Run a mixed GC, which evacuates two old regions, and observe it with the checker
+    void RunMixedGCWithEvacuatedRegions(EvacuatedRegionsChecker *checker);
+};
+
+template <bool CONCURRENT_RELEASE>
+void G1GCCollectionSetReleaseTest<CONCURRENT_RELEASE>::RunMixedGCWithEvacuatedRegions(
+    EvacuatedRegionsChecker *checker)
+{
+    uint32_t garbageRate = Runtime::GetOptions().GetG1RegionGarbageRateThreshold();
+    // The object will occupy more than half of region, so each tenured region contains one big object
+    static constexpr size_t ARRAY_SIZE = EVACUATED_REGIONS_COUNT;
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    size_t bigLen = (garbageRate + 1) * DEFAULT_REGION_SIZE / 100 + sizeof(coretypes::String);
+    size_t smallLen = DEFAULT_REGION_SIZE / 2 + sizeof(coretypes::String);
+    size_t miniObjLen = Runtime::GetOptions().GetInitTlabSize() + 1;  // To allocate not in TLAB
+
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    ObjectAllocatorG1<> *allocator = GetAllocator();
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    gc->AddListener(checker);
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    VMHandle<coretypes::Array> bigObjectHolder(thread,
+                                               ObjectAllocator::AllocArray(ARRAY_SIZE, ClassRoot::ARRAY_STRING, false));
+    VMHandle<coretypes::Array> smallObjectHolder(
+        thread, ObjectAllocator::AllocArray(ARRAY_SIZE, ClassRoot::ARRAY_STRING, false));
+    for (size_t i = 0; i < ARRAY_SIZE; i++) {
+        bigObjectHolder->Set(i, ObjectAllocator::AllocString(bigLen));
+        smallObjectHolder->Set(i, ObjectAllocator::AllocString(miniObjLen));
+    }
+    auto *stringClass = smallObjectHolder->Get<ObjectHeader *>(0)->ClassAddr<BaseClass>();
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+    }
+    // Make the tenured region of this object current, so the regions above can be collected
+    VMHandle<ObjectHeader> current(thread, ObjectAllocator::AllocArray(smallLen, ClassRoot::ARRAY_U8, false));
+    PandaVector<Region *> evacuatedRegions;
+    for (size_t i = 0; i < ARRAY_SIZE; i++) {
+        evacuatedRegions.push_back(ObjectToRegion(bigObjectHolder->Get<ObjectHeader *>(i)));
+        EXPECT_TRUE(evacuatedRegions.back()->HasFlag(RegionFlag::IS_OLD));
+        bigObjectHolder->Set(i, static_cast<ObjectHeader *>(nullptr));
+    }
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::HEAP_USAGE_THRESHOLD_CAUSE);  // concurrent marking
+        task.Run(*gc);
+    }
+    checker->SetEvacuatedRegions(evacuatedRegions);
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);  // mixed GC
+        task.Run(*gc);
+    }
+    gc->RemoveListener(checker);
+
+    // Whenever the regions were released, they are freed and removed from all remsets when GC ends
+    auto allRegions = allocator->GetAllRegions();
+    for (Region *region : evacuatedRegions) {
+        EXPECT_EQ(std::find(allRegions.begin(), allRegions.end(), region), allRegions.end());
+    }
+    for (Region *region : allRegions) {
+        EXPECT_FALSE(region->HasFlag(RegionFlag::IS_COLLECTION_SET));
+        auto dirtyRegions = region->GetRemSet()->GetDirtyRegions();
+        for (Region *evacuated : evacuatedRegions) {
+            EXPECT_EQ(dirtyRegions.count(evacuated), 0U);
+        }
+    }
+    for (size_t i = 0; i < ARRAY_SIZE; i++) {
+        auto *object = smallObjectHolder->Get<ObjectHeader *>(i);
+        EXPECT_EQ(object->ClassAddr<BaseClass>(), stringClass);
+        EXPECT_NE(std::find(allRegions.begin(), allRegions.end(), ObjectToRegion(object)), allRegions.end());
+    }
+}
+
+using G1GCConcurrentCollectionSetReleaseTest = G1GCCollectionSetReleaseTest<true>;
+using G1GCInPauseCollectionSetReleaseTest = G1GCCollectionSetReleaseTest<false>;
+
+TEST_F(G1GCConcurrentCollectionSetReleaseTest, TestEvacuatedRegionsReleasedAfterMixedGC)
+{
+    EvacuatedRegionsChecker checker(GetAllocator());
+    RunMixedGCWithEvacuatedRegions(&checker);
+    // The evacuated regions outlive the pause and are freed by ReleaseEvacuatedRegions
+    ASSERT_EQ(checker.GetRegionsAllocatedAtPauseEnd(), EVACUATED_REGIONS_COUNT);
+}
+
+TEST_F(G1GCConcurrentCollectionSetReleaseTest, TestEvacuatedRegionsNotReusedBeforeRelease)
+{
+    EvacuatedRegionsChecker checker(GetAllocator());
+    RunMixedGCWithEvacuatedRegions(&checker);
+    // The regions are allocated while mutators run and the evacuated regions still wait for the release
+    ASSERT_NE(checker.GetTlabsInDeferredWindow(), 0U);
+    ASSERT_EQ(checker.GetEvacuatedRegionsReused(), 0U);
+}
+
+TEST_F(G1GCInPauseCollectionSetReleaseTest, TestEvacuatedRegionsReleasedInMixedGC)
+{
+    EvacuatedRegionsChecker checker(GetAllocator());
+    RunMixedGCWithEvacuatedRegions(&checker);
+    ASSERT_EQ(checker.GetRegionsAllocatedAtPauseEnd(), 0U);
+    // Nothing is left to release after the pause, so there is no deferred window
+    ASSERT_EQ(checker.GetTlabsInDeferredWindow(), 0U);
+}
+
+class G1GCPretenuringTest : public G1GCTest {
+public:
+    G1GCPretenuringTest() : G1GCTest(CreateOptions()) {}
+
+    static RuntimeOptions CreateOptions()
+    {
+        RuntimeOptions options = CreateDefaultOptions();
+        options.SetG1Pretenuring(true);
+        options.SetG1PretenuringMinSamples(MIN_SAMPLES);
+        return options;
+    }
+
+    static constexpr uint32_t MIN_SAMPLES = 8U;
+};
+
+TEST_F(G1GCPretenuringTest, TestSurvivedSitesArePretenured)
+{
+    static constexpr uintptr_t LIVE_SITE = 0x100U;
+    static constexpr uintptr_t DEAD_SITE = 0x200U;
+    static constexpr size_t STRING_LEN = 16U;
+
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    AllocationSiteTracker *tracker = gc->GetAllocationSiteTracker();
+    ASSERT_NE(tracker, nullptr);
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    VMHandle<coretypes::Array> holder(thread, ObjectAllocator::AllocArray(MIN_SAMPLES, ClassRoot::ARRAY_STRING, false));
+    for (size_t i = 0; i < MIN_SAMPLES; i++) {
+        auto *live = ObjectAllocator::AllocString(STRING_LEN);
+        ASSERT_TRUE(ObjectToRegion(live)->IsYoung());
+        holder->Set(i, live);
+        // The samples stay in the buffer of the thread until the collection
+        tracker->RecordAllocation(thread->GetOrCreateAllocationSamples(), live, LIVE_SITE);
+        tracker->RecordAllocation(thread->GetOrCreateAllocationSamples(), ObjectAllocator::AllocString(STRING_LEN),
+                                  DEAD_SITE);
+    }
+    ASSERT_FALSE(tracker->IsPretenured(LIVE_SITE));
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+    }
+    ASSERT_TRUE(tracker->IsPretenured(LIVE_SITE));
+    ASSERT_FALSE(tracker->IsPretenured(DEAD_SITE));
+    ASSERT_EQ(tracker->GetPretenuredSitesCount(), 1U);
+
+    LanguageContext ctx = runtime->GetLanguageContext(panda_file::SourceLang::PANDA_ASSEMBLY);
+    Class *klass = runtime->GetClassLinker()->GetExtension(ctx)->GetClassRoot(ClassRoot::OBJECT);
+    ObjectHeader *object =
+        runtime->GetPandaVM()->GetHeapManager()->AllocateTenuredObject(klass, klass->GetObjectSize(), thread);
+    ASSERT_NE(object, nullptr);
+    ASSERT_TRUE(ObjectToRegion(object)->HasFlag(RegionFlag::IS_OLD));
+    ASSERT_TRUE(thread->GetTenuredTLAB()->ContainObject(object));
+    ASSERT_TRUE(ObjectToRegion(object)->GetLiveBitmap()->Test(object));
+    {
+        // The bytes of the tenured TLAB are recorded when it is retired
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+    }
+    ASSERT_EQ(tracker->GetPretenuredBytes(), GetAlignedObjectSize(klass->GetObjectSize()));
+    // All the sampled objects of the pretenured site survived, so none of the pretenured bytes would be freed
+    GCStats *gcStats = runtime->GetPandaVM()->GetGCStats();
+    ASSERT_EQ(gcStats->GetPretenuredBytes(), tracker->GetPretenuredBytes());
+    ASSERT_EQ(gcStats->GetCopiedBytesAvoided(), tracker->GetPretenuredBytes());
+}
+
+class G1GCPretenuringResetTest : public G1GCTest {
+public:
+    G1GCPretenuringResetTest() : G1GCTest(CreateOptions()) {}
+
+    static RuntimeOptions CreateOptions()
+    {
+        RuntimeOptions options = G1GCPretenuringTest::CreateOptions();
+        options.SetG1PretenuringResetInterval(RESET_INTERVAL);
+        return options;
+    }
+
+    static constexpr uint32_t RESET_INTERVAL = 2U;
+};
+
+TEST_F(G1GCPretenuringResetTest, TestDecisionsAreReset)
+{
+    static constexpr uintptr_t SITE = 0x100U;
+    static constexpr size_t STRING_LEN = 16U;
+
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    AllocationSiteTracker *tracker = gc->GetAllocationSiteTracker();
+    ASSERT_NE(tracker, nullptr);
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    VMHandle<coretypes::Array> holder(thread, ObjectAllocator::AllocArray(G1GCPretenuringTest::MIN_SAMPLES,
+                                                                          ClassRoot::ARRAY_STRING, false));
+    for (size_t i = 0; i < G1GCPretenuringTest::MIN_SAMPLES; i++) {
+        auto *live = ObjectAllocator::AllocString(STRING_LEN);
+        holder->Set(i, live);
+        tracker->RecordAllocation(thread->GetOrCreateAllocationSamples(), live, SITE);
+    }
+    for (uint32_t i = 0; i < RESET_INTERVAL; i++) {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+        // The site is pretenured by the first collection and sampled again after the reset
+        ASSERT_EQ(tracker->IsPretenured(SITE), i + 1U < RESET_INTERVAL);
+    }
+    ASSERT_EQ(tracker->GetPretenuredSitesCount(), 0U);
+}
+
+class G1GCPretenuringExecutionTest : public G1GCTest {
+public:
+    G1GCPretenuringExecutionTest() : G1GCTest(CreateOptions()) {}
+
+    static RuntimeOptions CreateOptions()
+    {
+        RuntimeOptions options = G1GCPretenuringTest::CreateOptions();
+        options.SetG1PretenuringSampleInterval(1U);
+        options.SetCompilerEnableJit(true);
+        // The test compiles the method itself and runs the compiled code right after that
+        options.SetNoAsyncJit(true);
+        return options;
+    }
+
+    static void RunYoungGC(GC *gc, ManagedThread *thread)
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+    }
+
+    /// Checks that @param object is allocated in the tenured TLAB of @param thread and is visible to card scanning
+    static void AssertAllocatedInTenuredTLAB(ManagedThread *thread, ObjectHeader *object)
+    {
+        ASSERT_NE(object, nullptr);
+        ASSERT_TRUE(ObjectToRegion(object)->HasFlag(RegionFlag::IS_OLD));
+        ASSERT_TRUE(thread->GetTenuredTLAB()->ContainObject(object));
+        ASSERT_TRUE(ObjectToRegion(object)->GetLiveBitmap()->Test(object));
+    }
+
+    static constexpr uint32_t MIN_SAMPLES = G1GCPretenuringTest::MIN_SAMPLES;
+};
+
+TEST_F(G1GCPretenuringExecutionTest, TestPretenuredSiteAllocatesInTenuredTLAB)
+{
+    auto source = R"(
+        .record Node {}
+
+        .function Node allocate() {
+            newobj v0, Node
+            lda.obj v0
+            return.obj
+        }
+    )";
+    pandasm::Parser parser;
+    auto res = parser.Parse(source);
+    ASSERT_TRUE(res.HasValue());
+    ClassLinker *classLinker = Runtime::GetCurrent()->GetClassLinker();
+    classLinker->AddPandaFile(pandasm::AsmEmitter::Emit(res.Value()));
+    PandaString descriptor;
+    Class *klass = classLinker->GetExtension(panda_file::SourceLang::PANDA_ASSEMBLY)
+                       ->GetClass(ClassHelper::GetDescriptor(utf::CStringAsMutf8("_GLOBAL"), &descriptor));
+    ASSERT_NE(klass, nullptr);
+    Method *method = klass->GetDirectMethod(utf::CStringAsMutf8("allocate"));
+    ASSERT_NE(method, nullptr);
+
+    GC *gc = Runtime::GetCurrent()->GetPandaVM()->GetGC();
+    AllocationSiteTracker *tracker = gc->GetAllocationSiteTracker();
+    ASSERT_NE(tracker, nullptr);
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    // The interpreter samples every allocation of the site and the handles keep the sampled objects alive
+    PandaVector<VMHandle<ObjectHeader>> sampled;
+    for (size_t i = 0; i < MIN_SAMPLES; i++) {
+        auto *object = method->Invoke(thread, nullptr).GetAs<ObjectHeader *>();
+        ASSERT_NE(object, nullptr);
+        ASSERT_TRUE(ObjectToRegion(object)->IsYoung());
+        sampled.emplace_back(thread, object);
+    }
+    ASSERT_EQ(tracker->GetPretenuredSitesCount(), 0U);
+    RunYoungGC(gc, thread);
+    ASSERT_EQ(tracker->GetPretenuredSitesCount(), 1U);
+
+    VMHandle<ObjectHeader> interpreted(thread, method->Invoke(thread, nullptr).GetAs<ObjectHeader *>());
+    AssertAllocatedInTenuredTLAB(thread, interpreted.GetPtr());
+
+    // The compiled code allocates the objects of the pretenured site by the tenured TLAB fast path
+    ASSERT_TRUE(PandaVM::GetCurrent()->GetCompiler()->CompileMethod(method, 0, false, TaggedValue::Hole()));
+    ASSERT_TRUE(method->HasCompiledCode());
+    VMHandle<ObjectHeader> compiled(thread, method->Invoke(thread, nullptr).GetAs<ObjectHeader *>());
+    AssertAllocatedInTenuredTLAB(thread, compiled.GetPtr());
+
+    // GC retires the tenured TLAB and finds the pretenured objects in its region
+    RunYoungGC(gc, thread);
+    ASSERT_EQ(thread->GetTenuredTLAB()->GetOccupiedSize(), 0U);
+    Class *nodeClass = interpreted->ClassAddr<Class>();
+    ASSERT_EQ(tracker->GetPretenuredBytes(), 2U * GetAlignedObjectSize(nodeClass->GetObjectSize()));
+    ASSERT_TRUE(ObjectToRegion(interpreted.GetPtr())->HasFlag(RegionFlag::IS_OLD));
+    ASSERT_TRUE(ObjectToRegion(compiled.GetPtr())->HasFlag(RegionFlag::IS_OLD));
+}
+
+class G1GCHeapShrinkTest : public G1GCTest {
+public:
+    G1GCHeapShrinkTest() : G1GCTest(CreateOptions()) {}
+
+    static RuntimeOptions CreateOptions()
+    {
+        RuntimeOptions options = CreateDefaultOptions();
+        options.SetG1HeapShrink(true);
+        return options;
+    }
+};
+
+TEST_F(G1GCHeapShrinkTest, TestHeapOccupancyInGCStats)
+{
+    static constexpr size_t STRING_LEN = 16U;
+
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    GCStats *gcStats = runtime->GetPandaVM()->GetGCStats();
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    VMHandle<coretypes::String> live(thread, ObjectAllocator::AllocString(STRING_LEN));
+    ASSERT_EQ(gcStats->GetLastCommittedHeapBytes(), 0U);
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+    }
+    // The surviving string is in the committed heap
+    ASSERT_GT(gcStats->GetLastCommittedHeapBytes(), 0U);
+    ASSERT_GT(gcStats->GetLastUsedHeapBytes(), 0U);
+}
+
+class G1GCWorkStealingMarkingTest : public G1GCTest {
+public:
+    G1GCWorkStealingMarkingTest() : G1GCTest(CreateOptions()) {}
+
+    static RuntimeOptions CreateOptions()
+    {
+        RuntimeOptions options = CreateDefaultOptions();
+        options.SetGcWorkersCount(WORKERS_COUNT);
+        options.SetGcParallelMarkingEnabled(true);
+        options.SetGcWorkStealingMarking(true);
+        return options;
+    }
+
+    static constexpr size_t WORKERS_COUNT = 4U;
+};
+
+TEST_F(G1GCWorkStealingMarkingTest, TestFullGCMarksLongChainAndWideFanout)
+{
+    static constexpr size_t CHAIN_LENGTH = 1000U;
+    static constexpr size_t FANOUT = 1000U;
+    static constexpr size_t STRING_LEN = 16U;
+
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    ASSERT_TRUE(gc->GetSettings()->WorkStealingMarkingEnabled());
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    VMHandle<coretypes::Array> fanout(thread, ObjectAllocator::AllocArray(FANOUT, ClassRoot::ARRAY_STRING, false));
+    for (size_t i = 0; i < FANOUT; i++) {
+        fanout->Set(i, ObjectAllocator::AllocString(STRING_LEN));
+    }
+    // Every link of the chain holds the next link and a string
+    VMHandle<coretypes::Array> chain(thread, ObjectAllocator::AllocArray(2U, ClassRoot::ARRAY_STRING, false));
+    VMHandle<coretypes::Array> link(thread, chain.GetPtr());
+    for (size_t i = 1; i < CHAIN_LENGTH; i++) {
+        link->Set(1U, ObjectAllocator::AllocString(STRING_LEN));
+        link->Set(0U, ObjectAllocator::AllocArray(2U, ClassRoot::ARRAY_STRING, false));
+        link = VMHandle<coretypes::Array>(thread, link->Get<ObjectHeader *>(0U));
+    }
+    link->Set(1U, ObjectAllocator::AllocString(STRING_LEN));
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::EXPLICIT_CAUSE);
+        task.Run(*gc);
+    }
+
+    for (size_t i = 0; i < FANOUT; i++) {
+        auto *str = fanout->Get<ObjectHeader *>(i);
+        ASSERT_TRUE(ObjectToRegion(str)->HasFlag(RegionFlag::IS_OLD));
+        ASSERT_EQ(coretypes::String::Cast(str)->GetLength(), STRING_LEN);
+    }
+    size_t length = 0;
+    for (auto *current = chain.GetPtr(); current != nullptr;
+         current = coretypes::Array::Cast(current->Get<ObjectHeader *>(0U))) {
+        ASSERT_TRUE(ObjectToRegion(current)->HasFlag(RegionFlag::IS_OLD));
+        ASSERT_EQ(coretypes::String::Cast(current->Get<ObjectHeader *>(1U))->GetLength(), STRING_LEN);
+        length++;
+    }
+    ASSERT_EQ(length, CHAIN_LENGTH);
+}
+
+TEST_F(G1GCWorkStealingMarkingTest, TestFullGCStealsOnWideFanout)
+{
+    static constexpr size_t FANOUT = 1000U;
+    static constexpr size_t LEAVES = 100U;
+    static constexpr size_t STRING_LEN = 16U;
+
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    GCStats *gcStats = runtime->GetPandaVM()->GetGCStats();
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    // The root array pushes all inner arrays to the deque of one participant, so others have to steal them
+    VMHandle<coretypes::Array> root(thread, ObjectAllocator::AllocArray(FANOUT, ClassRoot::ARRAY_STRING, false));
+    for (size_t i = 0; i < FANOUT; i++) {
+        root->Set(i, ObjectAllocator::AllocArray(LEAVES, ClassRoot::ARRAY_STRING, false));
+        for (size_t j = 0; j < LEAVES; j++) {
+            coretypes::Array::Cast(root->Get<ObjectHeader *>(i))->Set(j, ObjectAllocator::AllocString(STRING_LEN));
+        }
+    }
+    size_t stolenBefore = gcStats->GetStolenObjects();
+    {
+        ScopedNativeCodeThread sn(thread);
+        GCTask task(GCTaskCause::EXPLICIT_CAUSE);
+        task.Run(*gc);
+    }
+    ASSERT_GT(gcStats->GetStolenObjects(), stolenBefore);
+    for (size_t i = 0; i < FANOUT; i++) {
+        auto *inner = coretypes::Array::Cast(root->Get<ObjectHeader *>(i));
+        for (size_t j = 0; j < LEAVES; j++) {
+            ASSERT_EQ(coretypes::String::Cast(inner->Get<ObjectHeader *>(j))->GetLength(), STRING_LEN);
+        }
+    }
+}
+
+class ConcurrentMarkChecker : public GCListener {
+public:
+    ConcurrentMarkChecker(PandaVector<ObjectHeader *> liveObjects, PandaVector<ObjectHeader *> deadObjects)
+        : liveObjects_(std::move(liveObjects)), deadObjects_(std::move(deadObjects))
+    {
+    }
+
+    void GCPhaseFinished(GCPhase phase) override
+    {
+        if (phase != GCPhase::GC_PHASE_MARK) {
+            return;
+        }
+        PandaUnorderedMap<Region *, size_t> liveBytes;
+        for (auto *object : liveObjects_) {
+            EXPECT_TRUE(ObjectToRegion(object)->GetMarkBitmap()->Test(object));
+            liveBytes[ObjectToRegion(object)] += GetObjectSize(object);
+        }
+        for (auto *object : deadObjects_) {
+            EXPECT_FALSE(ObjectToRegion(object)->GetMarkBitmap()->Test(object));
+        }
+        // The regions may hold other live objects
+        for (auto [region, bytes] : liveBytes) {
+            EXPECT_GE(region->GetLiveBytes(), bytes);
+        }
+        checked_ = true;
+    }
+
+    bool IsChecked() const
+    {
+        return checked_;
+    }
+
+private:
+    PandaVector<ObjectHeader *> liveObjects_;
+    PandaVector<ObjectHeader *> deadObjects_;
+    bool checked_ {false};
+};
+
+TEST_F(G1GCWorkStealingMarkingTest, TestConcurrentMarking)
+{
+    static constexpr size_t LENGTH = 1000U;
+
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+
+    VMHandle<coretypes::Array> array(thread, ObjectAllocator::AllocArray(LENGTH, ClassRoot::ARRAY_STRING, false));
+    for (size_t i = 0; i < LENGTH; i++) {
+        array->Set(i, ObjectAllocator::AllocString(8U));
+    }
+    {
+        ScopedNativeCodeThread sn(thread);
+        // Propogate young objects -> tenured
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+    }
+    PandaVector<ObjectHeader *> liveObjects {array.GetPtr()};
+    PandaVector<ObjectHeader *> deadObjects;
+    for (size_t i = 0; i < LENGTH; i++) {
+        auto *str = array->Get<ObjectHeader *>(i);
+        ASSERT_TRUE(ObjectToRegion(str)->HasFlag(RegionFlag::IS_OLD));
+        // Every second string becomes garbage
+        if (i % 2U == 0) {
+            liveObjects.push_back(str);
+        } else {
+            deadObjects.push_back(str);
+            array->Set(i, static_cast<ObjectHeader *>(nullptr));
+        }
+    }
+    ConcurrentMarkChecker checker(std::move(liveObjects), std::move(deadObjects));
+    gc->AddListener(&checker);
+    {
+        ScopedNativeCodeThread sn(thread);
+        // The concurrent marking is done by the GC thread and the GC workers
+        GCTask task(GCTaskCause::HEAP_USAGE_THRESHOLD_CAUSE);
+        task.Run(*gc);
+    }
+    ASSERT_TRUE(checker.IsChecked());
+}
+
 TEST_F(G1GCTest, TestHandlePendingCards)
 {
     auto thread = MTManagedThread::GetCurrent();
@@ -1427,6 +2088,35 @@ TEST_F(G1GCTest, TestInterruptConcurrentMarking)
     }
 }
 
+TEST_F(G1GCWorkStealingMarkingTest, TestInterruptConcurrentMarking)
+{
+    Runtime *runtime = Runtime::GetCurrent();
+    GC *gc = runtime->GetPandaVM()->GetGC();
+
+    MTManagedThread *thread = MTManagedThread::GetCurrent();
+    ScopedManagedCodeThread s(thread);
+    [[maybe_unused]] HandleScope<ObjectHeader *> scope(thread);
+    VMHandle<coretypes::Array> array(thread, ObjectAllocator::AllocArray(1, ClassRoot::ARRAY_STRING, false));
+    array->Set(0, ObjectAllocator::AllocString(1));
+
+    {
+        ScopedNativeCodeThread sn(thread);
+        // Propogate young objects -> tenured
+        GCTask task(GCTaskCause::YOUNG_GC_CAUSE);
+        task.Run(*gc);
+
+        Region *region = ObjectToRegion(array->Get<ObjectHeader *>(0));
+        ASSERT_TRUE(region != nullptr);
+        region->SetLiveBytes(0);
+
+        // The marking participants stop before marking the string
+        InterruptGCListener listener(&array);
+        gc->AddListener(&listener);
+        GCTask task1(GCTaskCause::HEAP_USAGE_THRESHOLD_CAUSE);
+        task1.Run(*gc);
+    }
+}
+
 class NullRefListener : public GCListener {
 public:
     explicit NullRefListener(VMHandle<coretypes::Array> *array) : array_(array) {}
@@ -282,6 +282,11 @@ public:
         return object_;
     }
 
+    static ObjectHeader *CreateObject(ManagedThread *thread, Class *klass, [[maybe_unused]] const uint8_t *pc)
+    {
+        return CreateObject(thread, klass);
+    }
+
     static void SetupObjectClass(Class *klass)
     {
         objectClass_ = klass;
@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "assembler/assembly-parser.h"
+#include "include/thread_scopes.h"
+#include "runtime/include/class-inl.h"
+#include "runtime/include/managed_thread.h"
+#include "runtime/include/runtime.h"
+#include "runtime/interpreter/cache.h"
+
+namespace ark::interpreter::test {
+
+// Five receivers of Base.foo, one more than a call site of InterpreterCache can hold
+static auto g_interpreterCacheSource = R"(
+    .record Base {}
+    .record A <extends=Base> {}
+    .record B <extends=Base> {}
+    .record C <extends=Base> {}
+    .record D <extends=Base> {}
+    .record E <extends=Base> {}
+
+    .function void Base.ctor(Base a0) <ctor> {
+        return.void
+    }
+    .function void A.ctor(A a0) <ctor> {
+        return.void
+    }
+    .function void B.ctor(B a0) <ctor> {
+        return.void
+    }
+    .function void C.ctor(C a0) <ctor> {
+        return.void
+    }
+    .function void D.ctor(D a0) <ctor> {
+        return.void
+    }
+    .function void E.ctor(E a0) <ctor> {
+        return.void
+    }
+
+    .function i32 Base.foo(Base a0) {
+        ldai 0
+        return
+    }
+    .function i32 A.foo(A a0) {
+        ldai 1
+        return
+    }
+    .function i32 B.foo(B a0) {
+        ldai 2
+        return
+    }
+    .function i32 C.foo(C a0) {
+        ldai 3
+        return
+    }
+    .function i32 D.foo(D a0) {
+        ldai 4
+        return
+    }
+    .function i32 E.foo(E a0) {
+        ldai 5
+        return
+    }
+
+    .function i32 callFoo(Base a0) {
+        call.virt.short Base.foo, a0
+        return
+    }
+
+    .function i32 callFooAgain(Base a0) {
+        call.virt.short Base.foo, a0
+        return
+    }
+
+    # Calls foo of A, B, C, D and E twice through the single call site of callFoo
+    .function i32 main() {
+        initobj.short A.ctor
+        sta.obj v0
+        initobj.short B.ctor
+        sta.obj v1
+        initobj.short C.ctor
+        sta.obj v2
+        initobj.short D.ctor
+        sta.obj v3
+        initobj.short E.ctor
+        sta.obj v4
+        movi v5, 0
+        movi v6, 2
+    loop:
+        call.short callFoo, v0
+        add2 v5
+        sta v5
+        call.short callFoo, v1
+        add2 v5
+        sta v5
+        call.short callFoo, v2
+        add2 v5
+        sta v5
+        call.short callFoo, v3
+        add2 v5
+        sta v5
+        call.short callFoo, v4
+        add2 v5
+        sta v5
+        lda v6
+        subi 1
+        sta v6
+        jnez loop
+        lda v5
+        return
+    }
+)";
+
+class InterpreterCacheTest : public testing::Test {
+public:
+    static constexpr size_t RECEIVERS_COUNT = InterpreterCache::CLASSES_COUNT + 1;
+
+    InterpreterCacheTest()
+    {
+        RuntimeOptions options;
+        options.SetShouldLoadBootPandaFiles(false);
+        options.SetShouldInitializeIntrinsics(false);
+        options.SetRunGcInPlace(true);
+        options.SetCompilerEnableJit(false);
+        options.SetInterpreterType("cpp");
+        Runtime::Create(options);
+        thread_ = ManagedThread::GetCurrent();
+        thread_->ManagedCodeBegin();
+        LoadClasses();
+    }
+
+    ~InterpreterCacheTest() override
+    {
+        thread_->ManagedCodeEnd();
+        Runtime::Destroy();
+    }
+
+    NO_COPY_SEMANTIC(InterpreterCacheTest);
+    NO_MOVE_SEMANTIC(InterpreterCacheTest);
+
+protected:
+    Class *GetClass(const char *name)
+    {
+        PandaString descriptor;
+        return extension_->GetClass(ClassHelper::GetDescriptor(utf::CStringAsMutf8(name), &descriptor));
+    }
+
+    Method *GetGlobalMethod(const char *name)
+    {
+        return GetClass("_GLOBAL")->GetDirectMethod(utf::CStringAsMutf8(name));
+    }
+
+    const Class *GetReceiver(size_t i) const
+    {
+        return receivers_[i];
+    }
+
+    Method *GetFoo(size_t i) const
+    {
+        return foos_[i];
+    }
+
+    ManagedThread *GetThread() const
+    {
+        return thread_;
+    }
+
+private:
+    void LoadClasses()
+    {
+        pandasm::Parser p;
+        auto res = p.Parse(g_interpreterCacheSource);
+        ASSERT_TRUE(res) << res.Error().message;
+        auto pf = pandasm::AsmEmitter::Emit(res.Value());
+        ASSERT_NE(pf, nullptr);
+
+        ClassLinker *classLinker = Runtime::GetCurrent()->GetClassLinker();
+        classLinker->AddPandaFile(std::move(pf));
+        extension_ = classLinker->GetExtension(panda_file::SourceLang::PANDA_ASSEMBLY);
+
+        std::array<const char *, RECEIVERS_COUNT> names {"A", "B", "C", "D", "E"};
+        for (size_t i = 0; i < RECEIVERS_COUNT; i++) {
+            Class *klass = GetClass(names[i]);
+            ASSERT_NE(klass, nullptr);
+            receivers_[i] = klass;
+            foos_[i] = klass->GetClassMethod(utf::CStringAsMutf8("foo"));
+            ASSERT_NE(foos_[i], nullptr);
+        }
+    }
+
+    ManagedThread *thread_ {nullptr};
+    ClassLinkerExtension *extension_ {nullptr};
+    std::array<const Class *, RECEIVERS_COUNT> receivers_ {};
+    std::array<Method *, RECEIVERS_COUNT> foos_ {};
+};
+
+TEST_F(InterpreterCacheTest, MonomorphicCallSite)
+{
+    auto cache = std::make_unique<InterpreterCache>();
+    Method *caller = GetGlobalMethod("callFoo");
+    ASSERT_NE(caller, nullptr);
+    const uint8_t *pc = caller->GetInstructions();
+
+    // The call site table is not allocated before the first virtual call
+    cache->Clear();
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller, GetReceiver(0)), nullptr);
+    cache->SetVirtualMethod(pc, caller, GetReceiver(0), GetFoo(0));
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller, GetReceiver(0)), GetFoo(0));
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller, GetReceiver(0)), GetFoo(0));
+    // Other receiver at the same call site is not resolved to the cached method
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller, GetReceiver(1)), nullptr);
+
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+    auto stats = cache->GetCallSiteStats();
+    EXPECT_EQ(stats.hits, 2U);
+    EXPECT_EQ(stats.misses, 2U);
+    EXPECT_EQ(stats.megamorphicMisses, 0U);
+#endif
+}
+
+TEST_F(InterpreterCacheTest, PolymorphicCallSite)
+{
+    auto cache = std::make_unique<InterpreterCache>();
+    Method *caller = GetGlobalMethod("callFoo");
+    ASSERT_NE(caller, nullptr);
+    const uint8_t *pc = caller->GetInstructions();
+
+    for (size_t i = 0; i < InterpreterCache::CLASSES_COUNT; i++) {
+        ASSERT_EQ(cache->GetVirtualMethod(pc, caller, GetReceiver(i)), nullptr);
+        cache->SetVirtualMethod(pc, caller, GetReceiver(i), GetFoo(i));
+        // All the receivers cached before stay in the entry
+        for (size_t j = 0; j <= i; j++) {
+            ASSERT_EQ(cache->GetVirtualMethod(pc, caller, GetReceiver(j)), GetFoo(j));
+        }
+    }
+
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+    auto stats = cache->GetCallSiteStats();
+    EXPECT_EQ(stats.hits, InterpreterCache::CLASSES_COUNT * (InterpreterCache::CLASSES_COUNT + 1) / 2);
+    EXPECT_EQ(stats.misses, InterpreterCache::CLASSES_COUNT);
+    EXPECT_EQ(stats.megamorphicMisses, 0U);
+#endif
+}
+
+TEST_F(InterpreterCacheTest, MegamorphicCallSiteKeepsFirstReceivers)
+{
+    auto cache = std::make_unique<InterpreterCache>();
+    Method *caller = GetGlobalMethod("callFoo");
+    ASSERT_NE(caller, nullptr);
+    const uint8_t *pc = caller->GetInstructions();
+
+    for (size_t i = 0; i < InterpreterCache::CLASSES_COUNT; i++) {
+        cache->SetVirtualMethod(pc, caller, GetReceiver(i), GetFoo(i));
+    }
+    const Class *extraReceiver = GetReceiver(InterpreterCache::CLASSES_COUNT);
+    cache->SetVirtualMethod(pc, caller, extraReceiver, GetFoo(InterpreterCache::CLASSES_COUNT));
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller, extraReceiver), nullptr);
+    cache->SetVirtualMethod(pc, caller, extraReceiver, GetFoo(InterpreterCache::CLASSES_COUNT));
+    for (size_t i = 0; i < InterpreterCache::CLASSES_COUNT; i++) {
+        ASSERT_EQ(cache->GetVirtualMethod(pc, caller, GetReceiver(i)), GetFoo(i));
+    }
+
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+    auto stats = cache->GetCallSiteStats();
+    EXPECT_EQ(stats.hits, InterpreterCache::CLASSES_COUNT);
+    EXPECT_EQ(stats.misses, 1U);
+    EXPECT_EQ(stats.megamorphicMisses, 2U);
+#endif
+}
+
+TEST_F(InterpreterCacheTest, CallSiteCollision)
+{
+    auto cache = std::make_unique<InterpreterCache>();
+    Method *caller1 = GetGlobalMethod("callFoo");
+    Method *caller2 = GetGlobalMethod("callFooAgain");
+    ASSERT_NE(caller1, nullptr);
+    ASSERT_NE(caller2, nullptr);
+    const uint8_t *pc = caller1->GetInstructions();
+
+    // The same pc in two callers, e.g. the bytecode shared by two methods
+    cache->SetVirtualMethod(pc, caller1, GetReceiver(0), GetFoo(0));
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller2, GetReceiver(0)), nullptr);
+    cache->SetVirtualMethod(pc, caller2, GetReceiver(1), GetFoo(1));
+    // The entry is replaced, so the receivers of the first caller are not mixed with the second one
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller2, GetReceiver(1)), GetFoo(1));
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller2, GetReceiver(0)), nullptr);
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller1, GetReceiver(0)), nullptr);
+
+    // Different pc, which maps to the same entry
+    const uint8_t *collidingPc = pc + InterpreterCache::CALL_SITES_N * sizeof(uint32_t);
+    cache->SetVirtualMethod(collidingPc, caller1, GetReceiver(2), GetFoo(2));
+    ASSERT_EQ(cache->GetVirtualMethod(pc, caller2, GetReceiver(1)), nullptr);
+    ASSERT_EQ(cache->GetVirtualMethod(collidingPc, caller1, GetReceiver(2)), GetFoo(2));
+
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+    auto stats = cache->GetCallSiteStats();
+    EXPECT_EQ(stats.hits, 2U);
+    EXPECT_EQ(stats.misses, 4U);
+    EXPECT_EQ(stats.megamorphicMisses, 0U);
+#endif
+}
+
+#ifdef PANDA_INTERPRETER_CACHE_STATISTICS
+TEST_F(InterpreterCacheTest, CallSiteStatistics)
+{
+    Method *mainMethod = GetGlobalMethod("main");
+    ASSERT_NE(mainMethod, nullptr);
+    InterpreterCache *cache = GetThread()->GetInterpreterCache();
+    // The counters of the threads of the previous tests are kept in the retired statistics
+    auto expected = InterpreterCache::GetRetiredCallSiteStats();
+    expected += cache->GetCallSiteStats();
+
+    std::vector<Value> args;
+    Value v = mainMethod->Invoke(GetThread(), args.data());
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    ASSERT_EQ(v.GetAs<int32_t>(), 30);
+
+    // The first round misses all the receivers, the second one hits all but the megamorphic one
+    InterpreterCache::CallSiteStats executed;
+    executed.hits = InterpreterCache::CLASSES_COUNT;
+    executed.misses = RECEIVERS_COUNT + 1U;
+    executed.megamorphicMisses = 2U;
+    expected += executed;
+
+    auto stats = cache->GetCallSiteStats();
+    stats += InterpreterCache::GetRetiredCallSiteStats();
+    EXPECT_EQ(stats.hits, expected.hits);
+    EXPECT_EQ(stats.misses, expected.misses);
+    EXPECT_EQ(stats.megamorphicMisses, expected.megamorphicMisses);
+
+    PandaStringStream report;
+    report << "Interpreter call site cache: hits - " << expected.hits << ", misses - " << expected.misses
+           << ", megamorphic misses - " << expected.megamorphicMisses << std::endl;
+    EXPECT_EQ(Runtime::GetCurrent()->GetInterpreterCacheStatistics(), report.str());
+}
+#endif
+
+}  // namespace ark::interpreter::test
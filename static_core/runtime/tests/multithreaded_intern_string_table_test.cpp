@@ -33,6 +33,9 @@ namespace ark::mem::test {
 static constexpr uint32_t TEST_THREADS = 8;
 static constexpr uint32_t TEST_ITERS = 1000;
 static constexpr uint32_t TEST_ARRAY_SIZE = TEST_THREADS * 1000;
+static constexpr uint32_t SCALING_MAX_THREADS = 32;
+static constexpr uint32_t SCALING_STRINGS_COUNT = 4096;
+static constexpr uint32_t SCALING_ITERS = 50;
 
 class MultithreadedInternStringTableTest : public testing::Test {
 public:
@@ -81,6 +84,12 @@ public:
         return table_;
     }
 
+    void ClearTable()
+    {
+        table_->table_.Clear();
+        table_->internalTable_.Clear();
+    }
+
     void PreCheck()
     {
         std::unique_lock<std::mutex> lk(preLock_);
@@ -115,14 +124,7 @@ public:
             ASSERT_EQ(table_->Size(), 1);
             string_ = nullptr;
 
-            {
-                os::memory::WriteLockHolder holder(table_->table_.tableLock_);
-                table_->table_.table_.clear();
-            }
-            {
-                os::memory::WriteLockHolder holder(table_->internalTable_.tableLock_);
-                table_->internalTable_.table_.clear();
-            }
+            ClearTable();
 
             postCv_.notify_all();
             counterPost_ = 0;
@@ -217,6 +219,55 @@ TEST_F(MultithreadedInternStringTableTest, ConcurrentInsertion)
     }
 }
 
+void TestInternScaling(const std::vector<std::array<uint8_t, 4U>> &strings, uint32_t threadIdx, uint32_t threadsCount,
+                       MultithreadedInternStringTableTest *test)
+{
+    auto *thisThread =
+        ark::MTManagedThread::Create(ark::Runtime::GetCurrent(), ark::Runtime::GetCurrent()->GetPandaVM());
+    thisThread->ManagedCodeBegin();
+    LanguageContext ctx = Runtime::GetCurrent()->GetLanguageContext(panda_file::SourceLang::PANDA_ASSEMBLY);
+    auto *table = test->GetTable();
+
+    // All the threads intern the same strings starting from different positions, so the first pass mostly
+    // inserts and the rest mostly look up the already interned strings
+    for (uint32_t iter = 0; iter < SCALING_ITERS; iter++) {
+        for (uint32_t i = 0; i < strings.size(); i++) {
+            auto idx = (i + threadIdx * strings.size() / threadsCount) % strings.size();
+            table->GetOrInternString(strings[idx].data(), 2U, ctx);
+        }
+    }
+
+    thisThread->ManagedCodeEnd();
+    thisThread->Destroy();
+}
+
+// Interns the same strings from 1..SCALING_MAX_THREADS threads, every string must be interned exactly once
+TEST_F(MultithreadedInternStringTableTest, ConcurrentInternScaling)
+{
+    std::vector<std::array<uint8_t, 4U>> strings;
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    for (uint8_t second = 0x80; second < 0xc0; second++) {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        for (uint8_t third = 1; third < 0x80 && strings.size() < SCALING_STRINGS_COUNT; third++) {
+            // NOLINTNEXTLINE(readability-magic-numbers)
+            strings.push_back({0xc2, second, third, 0x00});
+        }
+    }
+    ASSERT_EQ(strings.size(), SCALING_STRINGS_COUNT);
+
+    for (uint32_t threadsCount = 1; threadsCount <= SCALING_MAX_THREADS; threadsCount *= 2U) {
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            threads.emplace_back(TestInternScaling, std::cref(strings), i, threadsCount, this);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(GetTable()->Size(), SCALING_STRINGS_COUNT);
+        ClearTable();
+    }
+}
+
 TEST_F(MultithreadedInternStringTableTest, CheckInternReturnsSameString)
 {
     std::array<std::thread, TEST_THREADS> threads;
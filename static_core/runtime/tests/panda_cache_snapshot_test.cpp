@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "libarkbase/os/file.h"
+#include "libarkfile/panda_cache.h"
+#include "runtime/include/class_linker.h"
+#include "runtime/include/class_linker_extension.h"
+#include "runtime/include/runtime.h"
+#include "runtime/include/thread_scopes.h"
+#include "runtime/panda_cache_snapshot.h"
+
+namespace ark::test {
+
+class PandaCacheSnapshotTest : public testing::Test {
+public:
+    PandaCacheSnapshotTest()
+    {
+        auto execPath = ark::os::file::File::GetExecutablePath().Value();
+        pandaStdLib_ = execPath + "/../pandastdlib/arkstdlib.abc";
+        snapshotPath_ = execPath + "/panda_cache_snapshot_test.snap";
+        std::remove(snapshotPath_.c_str());
+    }
+
+    ~PandaCacheSnapshotTest() override
+    {
+        std::remove(snapshotPath_.c_str());
+    }
+
+    NO_COPY_SEMANTIC(PandaCacheSnapshotTest);
+    NO_MOVE_SEMANTIC(PandaCacheSnapshotTest);
+
+protected:
+    RuntimeOptions CreateOptions(bool loadBootPandaFiles) const
+    {
+        RuntimeOptions options;
+        options.SetShouldLoadBootPandaFiles(loadBootPandaFiles);
+        options.SetShouldInitializeIntrinsics(false);
+        if (loadBootPandaFiles) {
+            options.SetBootPandaFiles({pandaStdLib_});
+            options.SetLoadRuntimes({"core"});
+        }
+        return options;
+    }
+
+    static const panda_file::File *GetBootFile()
+    {
+        const auto &bootFiles = Runtime::GetCurrent()->GetClassLinker()->GetBootPandaFiles();
+        return bootFiles.empty() ? nullptr : bootFiles.front();
+    }
+
+    /// Resolves up to @param count classes defined in the boot file, @return number of resolved classes
+    static size_t ResolveBootClasses(size_t count)
+    {
+        auto *runtime = Runtime::GetCurrent();
+        auto *classLinker = runtime->GetClassLinker();
+        auto *ctx = classLinker->GetExtension(runtime->GetLanguageContext(runtime->GetRuntimeType()))->GetBootContext();
+        const auto *pf = GetBootFile();
+        size_t resolved = 0;
+        ScopedManagedCodeThread smct(ManagedThread::GetCurrent());
+        for (auto offset : pf->GetClasses()) {
+            panda_file::File::EntityId id(offset);
+            if (pf->IsExternal(id)) {
+                continue;
+            }
+            if (classLinker->GetClass(*pf, id, ctx) != nullptr && ++resolved == count) {
+                break;
+            }
+        }
+        return resolved;
+    }
+
+    const std::string &GetSnapshotPath() const
+    {
+        return snapshotPath_;
+    }
+
+private:
+    std::string pandaStdLib_;
+    std::string snapshotPath_;
+};
+
+TEST_F(PandaCacheSnapshotTest, SaveLoad)
+{
+    Runtime::Create(CreateOptions(false));
+    {
+        PandaCacheSnapshot snapshot;
+        PandaCacheSnapshot::FileEntry entry;
+        entry.filename = "boot.abc";
+        entry.checksum = 0xdeadbeefU;
+        entry.classes = {0x10U, 0x20U};
+        entry.methods = {0x30U};
+        entry.staticFields = {0x40U};
+        entry.instanceFields = {0x50U, 0x60U, 0x70U};
+        snapshot.AddEntry(entry);
+        ASSERT_TRUE(snapshot.Save(ConvertToString(GetSnapshotPath())));
+
+        auto loaded = PandaCacheSnapshot::Load(ConvertToString(GetSnapshotPath()));
+        ASSERT_TRUE(loaded) << loaded.Error();
+        ASSERT_EQ(loaded.Value().GetFiles().size(), 1U);
+        const auto &result = loaded.Value().GetFiles().front();
+        ASSERT_EQ(result.filename, entry.filename);
+        ASSERT_EQ(result.checksum, entry.checksum);
+        ASSERT_EQ(result.classes, entry.classes);
+        ASSERT_EQ(result.methods, entry.methods);
+        ASSERT_EQ(result.staticFields, entry.staticFields);
+        ASSERT_EQ(result.instanceFields, entry.instanceFields);
+    }
+    {
+        // Truncated snapshot must be rejected
+        std::ofstream fd(GetSnapshotPath(), std::ios::binary | std::ios::trunc);
+        fd.write(PandaCacheSnapshot::MAGIC.data(), PandaCacheSnapshot::MAGIC.size());
+        fd.close();
+        ASSERT_FALSE(PandaCacheSnapshot::Load(ConvertToString(GetSnapshotPath())));
+    }
+    Runtime::Destroy();
+}
+
+TEST_F(PandaCacheSnapshotTest, PrewarmOnStartup)
+{
+    constexpr size_t CLASSES_COUNT = 16U;
+
+    // Cold start, collect the snapshot on shutdown
+    auto options = CreateOptions(true);
+    options.SetPandaCacheSnapshot(GetSnapshotPath());
+    options.SetSavePandaCacheSnapshot(true);
+    ASSERT_TRUE(Runtime::Create(options));
+    size_t resolved = ResolveBootClasses(CLASSES_COUNT);
+    ASSERT_NE(resolved, 0U);
+    Runtime::Destroy();
+
+    // Warm start, the classes must be in the cache before any resolution
+    options.SetSavePandaCacheSnapshot(false);
+    ASSERT_TRUE(Runtime::Create(options));
+    {
+        const auto *pf = GetBootFile();
+        size_t cached = 0;
+        pf->GetPandaCache()->EnumerateClassCache(
+            [&cached](panda_file::File::EntityId /* id */, Class * /* klass */) { cached++; });
+        ASSERT_GE(cached, resolved);
+    }
+    ASSERT_EQ(ResolveBootClasses(CLASSES_COUNT), resolved);
+    Runtime::Destroy();
+}
+
+}  // namespace ark::test
@@ -795,4 +795,92 @@ TEST_F(YoungRegionCacheBoundTest, CacheBoundedByInitialMaxAfterYoungEnlargement)
     ASSERT_EQ(regionSpace->GetEmptyYoungRegionsCount(), INIT_MAX_YOUNG_REGIONS);
 }
 
+class NumaRegionSpaceTest : public YoungRegionCacheBoundTest {
+protected:
+    void TearDown() override
+    {
+        // The tests bind the main thread, which runs the next tests
+        NumaTopology::UnbindCurrentThread();
+    }
+};
+
+TEST_F(NumaRegionSpaceTest, SimulatedTopology)
+{
+    NumaTopology topology(2U);
+    ASSERT_TRUE(topology.IsSimulated());
+    ASSERT_EQ(topology.GetNodesCount(), 2U);
+    ASSERT_EQ(topology.GetNodeOfCpu(0), 0U);
+    ASSERT_EQ(topology.GetNodeOfCpu(1), 1U);
+    ASSERT_EQ(topology.GetNodeOfCpu(2), 0U);
+
+    uint32_t threadNode = 0;
+    std::thread thread([&topology, &threadNode]() {
+        topology.BindCurrentThread(1U);
+        threadNode = topology.GetCurrentNode();
+    });
+    thread.join();
+    ASSERT_EQ(threadNode, 1U);
+}
+
+TEST_F(NumaRegionSpaceTest, NodeLocalEmptyRegions)
+{
+    NumaTopology topology(2U);
+    mem::MemStatsType memStats;
+    NonObjectRegionAllocator allocator(&memStats, &spaces_, SpaceType::SPACE_TYPE_OBJECT);
+    auto *regionSpace = allocator.GetSpace();
+    regionSpace->SetNumaTopology(&topology);
+
+    topology.BindCurrentThread(0U);
+    auto *region0 = regionSpace->NewRegion(DEFAULT_REGION_SIZE, RegionFlag::IS_EDEN, RegionFlag::IS_UNUSED);
+    ASSERT_NE(region0, nullptr);
+    ASSERT_EQ(region0->GetNumaNode(), 0U);
+    topology.BindCurrentThread(1U);
+    auto *region1 = regionSpace->NewRegion(DEFAULT_REGION_SIZE, RegionFlag::IS_EDEN, RegionFlag::IS_UNUSED);
+    ASSERT_NE(region1, nullptr);
+    ASSERT_EQ(region1->GetNumaNode(), 1U);
+
+    auto onRegionDestroy = [](uintptr_t, uintptr_t) {};
+    for (auto *region : {region0, region1}) {
+        regionSpace->template FreeRegion<decltype(onRegionDestroy), RegionSpace::ReleaseRegionsPolicy::NoRelease>(
+            region, onRegionDestroy);
+    }
+    ASSERT_EQ(regionSpace->GetEmptyYoungRegionsCount(), 2U);
+
+    // Each node reuses its own empty region
+    ASSERT_EQ(regionSpace->NewRegion(DEFAULT_REGION_SIZE, RegionFlag::IS_EDEN, RegionFlag::IS_UNUSED), region1);
+    ASSERT_EQ(region1->GetNumaNode(), 1U);
+    topology.BindCurrentThread(0U);
+    ASSERT_EQ(regionSpace->NewRegion(DEFAULT_REGION_SIZE, RegionFlag::IS_EDEN, RegionFlag::IS_UNUSED), region0);
+    ASSERT_EQ(region0->GetNumaNode(), 0U);
+    ASSERT_EQ(regionSpace->GetEmptyYoungRegionsCount(), 0U);
+}
+
+TEST_F(NumaRegionSpaceTest, NodeAffineTlabs)
+{
+    static constexpr size_t TLAB_SIZE = 4_KB;
+    NumaTopology topology(2U);
+    mem::MemStatsType memStats;
+    NonObjectRegionAllocator allocator(&memStats, &spaces_, SpaceType::SPACE_TYPE_OBJECT);
+    allocator.GetSpace()->SetNumaTopology(&topology);
+
+    topology.BindCurrentThread(0U);
+    auto *tlab0 = allocator.CreateTLAB(TLAB_SIZE);
+    ASSERT_NE(tlab0, nullptr);
+    auto *region0 = allocator.GetRegion(static_cast<ObjectHeader *>(tlab0->GetStartAddr()));
+    ASSERT_EQ(region0->GetNumaNode(), 0U);
+
+    // The region retained by the node 0 is not used by the node 1
+    topology.BindCurrentThread(1U);
+    auto *tlab1 = allocator.CreateTLAB(TLAB_SIZE);
+    ASSERT_NE(tlab1, nullptr);
+    auto *region1 = allocator.GetRegion(static_cast<ObjectHeader *>(tlab1->GetStartAddr()));
+    ASSERT_NE(region1, region0);
+    ASSERT_EQ(region1->GetNumaNode(), 1U);
+
+    topology.BindCurrentThread(0U);
+    auto *nextTlab0 = allocator.CreateTLAB(TLAB_SIZE);
+    ASSERT_NE(nextTlab0, nullptr);
+    ASSERT_EQ(allocator.GetRegion(static_cast<ObjectHeader *>(nextTlab0->GetStartAddr())), region0);
+}
+
 }  // namespace ark::mem::test
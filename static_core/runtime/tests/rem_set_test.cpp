@@ -195,4 +195,48 @@ TEST_F(RemSetTest, TravelObjectToAddRefTest)
     delete memStats;
 }
 
+TEST_F(RemSetTest, CardSetGrowsTest)
+{
+    using CardSet = RemSetWithCommonLock::CardSet;
+    static constexpr size_t NUM_CARDS = RemSetWithCommonLock::Bitmap::GetNumBits();
+    CardSet cardSet;
+    cardSet.Set(1U);
+    cardSet.Set(1U);
+    ASSERT_EQ(cardSet.GetKind(), CardSet::Kind::SPARSE);
+    ASSERT_EQ(cardSet.GetCardsCount(), 1U);
+    ASSERT_TRUE(cardSet.Check(1U));
+    ASSERT_FALSE(cardSet.Check(2U));
+    auto sparseFootprint = cardSet.GetMemoryFootprint();
+
+    // Odd cards only, so the set stays below the full threshold
+    for (size_t idx = 1U; idx < NUM_CARDS; idx += 2U) {
+        cardSet.Set(idx);
+    }
+    ASSERT_EQ(cardSet.GetKind(), CardSet::Kind::BITMAP);
+    ASSERT_EQ(cardSet.GetCardsCount(), NUM_CARDS / 2U);
+    ASSERT_TRUE(cardSet.Check(NUM_CARDS - 1U));
+    ASSERT_FALSE(cardSet.Check(0U));
+    ASSERT_GT(cardSet.GetMemoryFootprint(), sparseFootprint);
+
+    size_t visited = 0;
+    MemRange range(0U, DEFAULT_REGION_SIZE);
+    cardSet.Iterate(range, [&visited](const MemRange &) { ++visited; });
+    ASSERT_EQ(visited, NUM_CARDS / 2U);
+
+    for (size_t idx = 0; idx < NUM_CARDS; idx += 2U) {
+        cardSet.Set(idx);
+    }
+    ASSERT_EQ(cardSet.GetKind(), CardSet::Kind::FULL);
+    ASSERT_TRUE(cardSet.Check(0U));
+    ASSERT_EQ(cardSet.GetMemoryFootprint(), sparseFootprint);
+
+    CardSet merged;
+    merged.Set(3U);
+    merged.AddCards(cardSet);
+    ASSERT_EQ(merged.GetKind(), CardSet::Kind::FULL);
+    visited = 0;
+    merged.Iterate(range, [&visited](const MemRange &) { ++visited; });
+    ASSERT_EQ(visited, NUM_CARDS);
+}
+
 }  // namespace ark::mem::test
@@ -1015,6 +1015,42 @@ TEST_F(StringTest, IndexOfTest9)
     EXPECT_EQ(-1, string->IndexOf(pattern, GetLanguageContext(), string->GetLength() - pattern->GetLength() + 1));
 }
 
+TEST_F(StringTest, IndexOfLongMixedTest)
+{
+    // The subject is longer than a vector, so the matches are found by the vector search and by the scalar tail
+    static constexpr uint32_t STRING_LENGTH = 100;
+    std::vector<uint16_t> stringData(STRING_LENGTH, 'a');
+    stringData[37U] = 'x';
+    stringData[38U] = 'y';
+    stringData[39U] = 'z';
+    stringData[95U] = 'x';
+    stringData[96U] = 'y';
+    stringData[97U] = 'z';
+    stringData[STRING_LENGTH - 1U] = 0x4e2d;
+    std::vector<uint8_t> patternData {'x', 'y', 'z', 0};
+    std::vector<uint16_t> wideData {'a', 0x4e2d};
+    String *string = String::CreateFromUtf16(stringData.data(), stringData.size(), GetLanguageContext(),
+                                             Runtime::GetCurrent()->GetPandaVM());
+    String *pattern = String::CreateFromMUtf8(patternData.data(), patternData.size() - 1, GetLanguageContext(),
+                                              Runtime::GetCurrent()->GetPandaVM());
+    String *widePattern = String::CreateFromUtf16(wideData.data(), wideData.size(), GetLanguageContext(),
+                                                  Runtime::GetCurrent()->GetPandaVM());
+    ASSERT_TRUE(string->IsUtf16());
+    EXPECT_EQ(37_I, string->IndexOf(pattern, GetLanguageContext(), 0));
+    EXPECT_EQ(95_I, string->IndexOf(pattern, GetLanguageContext(), 38_I));
+    EXPECT_EQ(98_I, string->IndexOf(widePattern, GetLanguageContext(), 0));
+    EXPECT_EQ(95_I, string->LastIndexOf(pattern, GetLanguageContext(), string->GetLength()));
+    EXPECT_EQ(37_I, string->LastIndexOf(pattern, GetLanguageContext(), 94_I));
+
+    // The compressed subject has no chars of the uncompressed pattern
+    std::vector<uint8_t> compressedData(STRING_LENGTH, 'a');
+    String *compressed = String::CreateFromMUtf8(compressedData.data(), compressedData.size(), GetLanguageContext(),
+                                                 Runtime::GetCurrent()->GetPandaVM());
+    EXPECT_EQ(-1, compressed->IndexOf(widePattern, GetLanguageContext(), 0));
+    EXPECT_EQ(-1, compressed->LastIndexOf(widePattern, GetLanguageContext(), compressed->GetLength()));
+    EXPECT_GT(string->Compare(compressed, GetLanguageContext()), 0);
+}
+
 TEST_F(StringTest, LastIndexOfShortTest)
 {
     std::vector<uint8_t> data1 {'a', 'b', 'c', 'd', 'z', 0};
@@ -16,14 +16,19 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <atomic>
+#include <filesystem>
+#include <sstream>
 
 #include "assembler/assembly-parser.h"
 #include "libarkfile/file.h"
+#include "libarkbase/os/filesystem.h"
 #include "libarkbase/trace/trace.h"
 #include "libarkbase/panda_gen_options/generated/logger_options.h"
 #include "runtime/include/thread_scopes.h"
 #include "runtime/include/runtime.h"
+#include "runtime/include/tooling/buffer_serializer.h"
 #include "runtime/tooling/sampler/sampling_profiler.h"
+#include "runtime/tooling/sampler/stack_aggregator.h"
 #include "runtime/interpreter/runtime_interface.h"
 #include "tools/sampler/aspt_converter.h"
 
@@ -1017,4 +1022,142 @@ TEST_F(SamplerTest, ProfilerSamplerSignalHandlerTest)
     }
 }
 
+// Writes the aggregated stacks to a temporary file, which is removed after the test
+class SamplerAggregationTest : public SamplerTest {
+public:
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove(aggregationFile_, ec);
+        SamplerTest::TearDown();
+    }
+
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    std::string aggregationFile_ {(std::filesystem::temp_directory_path() / "sampler_aggregation_test.zip").string()};
+};
+
+// Sampling big pandasm program with in-process aggregation
+TEST_F(SamplerAggregationTest, ProfilerAggregatingWriterTest)
+{
+    StackAggregator::Options options;
+    options.outputFile = aggregationFile_;
+    auto aggregator = std::make_shared<StackAggregator>(options);
+
+    auto *sp = Sampler::Create();
+    ASSERT_NE(sp, nullptr);
+    auto overheadBefore = Sampler::GetOverheadStats();
+    ASSERT_EQ(sp->Start(std::make_unique<AggregatingStreamWriter>(aggregator)), true);
+    ASSERT_TRUE(Runtime::GetCurrent()->Execute("_GLOBAL::main", {}));
+    sp->Stop();
+
+    auto overhead = Sampler::GetOverheadStats();
+    ASSERT_GT(overhead.totalSamples, overheadBefore.totalSamples);
+    ASSERT_GT(overhead.signalHandlerTimeNs, overheadBefore.signalHandlerTimeNs);
+
+    auto stats = aggregator->GetStats();
+    ASSERT_NE(stats.aggregatedSamples, 0);
+    ASSERT_EQ(stats.droppedSamples, 0);
+    // Samples are folded, so there are less stacks than samples
+    ASSERT_LE(aggregator->GetStacksCount(), stats.aggregatedSamples);
+
+    std::stringstream folded;
+    aggregator->DumpFoldedStacks(folded);
+    ASSERT_NE(folded.str().find("main"), std::string::npos);
+
+    ASSERT_TRUE(aggregator->Flush());
+    ASSERT_EQ(aggregator->GetStacksCount(), 0);
+    ASSERT_EQ(aggregator->GetStats().flushes, 1);
+    ASSERT_TRUE(os::IsFileExists(aggregationFile_));
+
+    Sampler::Destroy(sp);
+}
+
+// Samples of the external frames "foo", "bar", "baz" and "qux" from test.js
+class ExternalSamples {
+public:
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr size_t FRAMES_COUNT = 4;
+
+    SampleInfo MakeSample(size_t firstFrame, size_t depth)
+    {
+        SampleInfo sample;
+        for (size_t i = 0; i < depth; ++i) {
+            BufferSerializer::PluginFrameData data;
+            data.functionName = names_[firstFrame + i];
+            data.url = "test.js";
+            auto &frame = sample.stackInfo.managedStack[i];
+            frame.pandaFilePtr = helpers::ToUnderlying(FrameKind::EXTERNAL_FRAME);
+            frame.extFrameData = framesData_[firstFrame + i].data();
+            frame.extFrameDataSize = static_cast<uint32_t>(BufferSerializer::SerializePluginFrameData(
+                data, framesData_[firstFrame + i].data(), framesData_[firstFrame + i].size()));
+        }
+        sample.stackInfo.managedStackSize = depth;
+        sample.threadInfo.threadStatus = SampleInfo::ThreadStatus::RUNNING;
+        return sample;
+    }
+
+private:
+    std::array<std::array<uint8_t, Sampler::PLUGIN_FRAME_DATA_MAX_SIZE>, FRAMES_COUNT> framesData_ {};
+    std::array<std::string, FRAMES_COUNT> names_ {"foo", "bar", "baz", "qux"};
+};
+
+// Checking folding of equal stacks and flushing of the full storage
+TEST_F(SamplerTest, StackAggregatorTest)
+{
+    ExternalSamples samples;
+
+    StackAggregator::Options options;
+    options.maxStacks = 2U;
+    StackAggregator aggregator(options);
+    auto sample1 = samples.MakeSample(0, 2U);
+    auto sample2 = samples.MakeSample(2U, 2U);
+    aggregator.AddSample(sample1);
+    aggregator.AddSample(sample1);
+    aggregator.AddSample(sample2);
+    ASSERT_EQ(aggregator.GetStacksCount(), 2U);
+
+    std::stringstream folded;
+    aggregator.DumpFoldedStacks(folded);
+    ASSERT_NE(folded.str().find("(running);bar (test.js);foo (test.js) 2\n"), std::string::npos);
+    ASSERT_NE(folded.str().find("(running);qux (test.js);baz (test.js) 1\n"), std::string::npos);
+
+    // The storage is full, so it is flushed before a new stack is added
+    aggregator.AddSample(samples.MakeSample(1U, 2U));
+    ASSERT_EQ(aggregator.GetStacksCount(), 1U);
+    auto stats = aggregator.GetStats();
+    ASSERT_EQ(stats.aggregatedSamples, 4U);
+    ASSERT_EQ(stats.droppedSamples, 0);
+    ASSERT_EQ(stats.flushes, 1U);
+    ASSERT_EQ(stats.flushedStacks, 2U);
+}
+
+// Checking that the frames which don't fit the storage are counted and the failed output is not retried
+TEST_F(SamplerTest, StackAggregatorLimitsTest)
+{
+    ExternalSamples samples;
+    StackAggregator::Options options;
+    options.outputFile = (std::filesystem::temp_directory_path() / "no_such_dir" / "aggregation.txt").string();
+    options.compress = false;
+    auto sample = samples.MakeSample(0, 2U);
+    // Only the data of a single frame fits the storage
+    options.maxExternalFramesBytes = sample.stackInfo.managedStack[0].extFrameDataSize * 3U / 2U;
+    StackAggregator aggregator(options);
+
+    aggregator.AddSample(sample);
+    ASSERT_EQ(aggregator.GetStacksCount(), 1U);
+    auto stats = aggregator.GetStats();
+    ASSERT_EQ(stats.aggregatedSamples, 1U);
+    ASSERT_EQ(stats.droppedFrames, 1U);
+
+    ASSERT_FALSE(aggregator.Flush());
+    ASSERT_EQ(aggregator.GetStacksCount(), 0);
+    aggregator.AddSample(samples.MakeSample(2U, 1U));
+    ASSERT_FALSE(aggregator.Flush());
+    stats = aggregator.GetStats();
+    ASSERT_EQ(stats.aggregatedSamples, 2U);
+    ASSERT_EQ(stats.unwrittenSamples, 2U);
+    ASSERT_EQ(stats.flushes, 0);
+    ASSERT_FALSE(os::IsFileExists(options.outputFile));
+}
+
 }  // namespace ark::tooling::sampler::test
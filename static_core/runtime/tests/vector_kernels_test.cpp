@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "runtime/vector_kernels.h"
+
+namespace ark::intrinsics::vector::test {
+
+using compiler::VectorOp;
+using helpers::vector::VECTOR_BYTES;
+
+// Elements around the processed range, which must stay untouched
+static constexpr size_t GUARD = 3;
+static constexpr uint8_t GUARD_VALUE = 0xa5;
+
+template <VectorOp OP, typename T>
+static T Reference(T lhs, T rhs)
+{
+    if constexpr (OP == VectorOp::ADD) {
+        return static_cast<T>(lhs + rhs);
+    } else if constexpr (OP == VectorOp::REVERSE_SUB) {
+        return static_cast<T>(rhs - lhs);
+    } else if constexpr (OP == VectorOp::MUL) {
+        return static_cast<T>(lhs * rhs);
+    } else if constexpr (OP == VectorOp::DIV) {
+        return lhs / rhs;
+    } else {
+        static_assert(OP == VectorOp::XOR);
+        return static_cast<T>(lhs ^ rhs);
+    }
+}
+
+template <typename T>
+static std::vector<T> CreateArray(size_t length, size_t seed)
+{
+    std::vector<T> array(length + 2U * GUARD, static_cast<T>(GUARD_VALUE));
+    for (size_t i = 0; i < length; i++) {
+        // Nonzero, so the division is defined, and large enough to wrap around the narrow integers
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        array[GUARD + i] = static_cast<T>((i + 1U) * 37U + seed);
+    }
+    return array;
+}
+
+template <typename T>
+static void ExpectGuardsUntouched(const std::vector<T> &array, size_t length)
+{
+    for (size_t i = 0; i < GUARD; i++) {
+        EXPECT_EQ(array[i], static_cast<T>(GUARD_VALUE));
+        EXPECT_EQ(array[GUARD + length + i], static_cast<T>(GUARD_VALUE));
+    }
+}
+
+/// Checks the kernels for every tail length from the empty range to a full vector and one more element
+template <VectorOp OP, typename T>
+static void TestKernels()
+{
+    for (size_t length = 0; length <= VECTOR_BYTES + 1U; length++) {
+        auto src0 = CreateArray<T>(length, 1U);
+        auto src1 = CreateArray<T>(length, 2U);
+        auto dst = CreateArray<T>(length, 0U);
+        auto value = static_cast<T>(3U);
+
+        ArrayOpLoop<OP>(dst.data(), src0.data(), src1.data(), GUARD, GUARD + length);
+        for (size_t i = GUARD; i < GUARD + length; i++) {
+            ASSERT_EQ(dst[i], (Reference<OP, T>(src0[i], src1[i]))) << "length " << length << ", index " << i;
+        }
+        ExpectGuardsUntouched(dst, length);
+
+        ScalarOpLoop<OP>(dst.data(), src0.data(), value, GUARD, GUARD + length);
+        for (size_t i = GUARD; i < GUARD + length; i++) {
+            ASSERT_EQ(dst[i], (Reference<OP, T>(src0[i], value))) << "length " << length << ", index " << i;
+        }
+        ExpectGuardsUntouched(dst, length);
+    }
+}
+
+/**
+ * The pass accesses all the arrays by the same index, so the source and the destination can only be the same array.
+ * The kernel must read each vector of the source before it stores the vector of the destination.
+ */
+template <VectorOp OP, typename T>
+static void TestInPlaceKernels()
+{
+    for (size_t length = 0; length <= VECTOR_BYTES + 1U; length++) {
+        auto src = CreateArray<T>(length, 1U);
+        auto expected = src;
+        for (size_t i = GUARD; i < GUARD + length; i++) {
+            expected[i] = Reference<OP, T>(src[i], src[i]);
+        }
+        auto array = src;
+        ArrayOpLoop<OP>(array.data(), array.data(), array.data(), GUARD, GUARD + length);
+        ASSERT_EQ(array, expected) << "length " << length;
+
+        auto value = static_cast<T>(5U);
+        for (size_t i = GUARD; i < GUARD + length; i++) {
+            expected[i] = Reference<OP, T>(array[i], value);
+        }
+        ScalarOpLoop<OP>(array.data(), array.data(), value, GUARD, GUARD + length);
+        ASSERT_EQ(array, expected) << "length " << length;
+    }
+}
+
+TEST(VectorKernelsTest, Uint8)
+{
+    TestKernels<VectorOp::ADD, uint8_t>();
+    TestKernels<VectorOp::MUL, uint8_t>();
+    TestKernels<VectorOp::XOR, uint8_t>();
+    TestInPlaceKernels<VectorOp::ADD, uint8_t>();
+}
+
+TEST(VectorKernelsTest, Uint16)
+{
+    TestKernels<VectorOp::REVERSE_SUB, uint16_t>();
+    TestInPlaceKernels<VectorOp::MUL, uint16_t>();
+}
+
+TEST(VectorKernelsTest, Uint32)
+{
+    TestKernels<VectorOp::ADD, uint32_t>();
+    TestKernels<VectorOp::MUL, uint32_t>();
+    TestInPlaceKernels<VectorOp::XOR, uint32_t>();
+}
+
+TEST(VectorKernelsTest, Uint64)
+{
+    TestKernels<VectorOp::REVERSE_SUB, uint64_t>();
+    TestInPlaceKernels<VectorOp::ADD, uint64_t>();
+}
+
+TEST(VectorKernelsTest, Float)
+{
+    TestKernels<VectorOp::DIV, float>();
+    TestInPlaceKernels<VectorOp::MUL, float>();
+}
+
+TEST(VectorKernelsTest, Double)
+{
+    TestKernels<VectorOp::ADD, double>();
+    TestKernels<VectorOp::DIV, double>();
+    TestInPlaceKernels<VectorOp::REVERSE_SUB, double>();
+}
+
+}  // namespace ark::intrinsics::vector::test
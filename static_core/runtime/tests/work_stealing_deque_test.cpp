@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/execution/work_stealing_deque.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ark::test {
+
+TEST(WorkStealingDequeTest, EmptyDeque)
+{
+    WorkStealingDeque<int> deque;
+    ASSERT_TRUE(deque.IsEmptyApprox());
+    ASSERT_EQ(deque.PopBottom(), nullptr);
+    ASSERT_EQ(deque.Steal(), nullptr);
+    ASSERT_EQ(deque.SizeApprox(), 0U);
+}
+
+TEST(WorkStealingDequeTest, OwnerLifoThiefFifo)
+{
+    WorkStealingDeque<int> deque;
+    std::array<int, 4U> values {0, 1, 2, 3};
+    for (auto &v : values) {
+        deque.PushBottom(&v);
+    }
+    ASSERT_EQ(deque.SizeApprox(), values.size());
+    ASSERT_EQ(deque.Steal(), &values[0U]);
+    ASSERT_EQ(deque.PopBottom(), &values[3U]);
+    ASSERT_EQ(deque.Steal(), &values[1U]);
+    ASSERT_EQ(deque.PopBottom(), &values[2U]);
+    ASSERT_EQ(deque.PopBottom(), nullptr);
+    ASSERT_EQ(deque.Steal(), nullptr);
+}
+
+TEST(WorkStealingDequeTest, Grow)
+{
+    static constexpr size_t INITIAL_CAPACITY = 4U;
+    static constexpr size_t COUNT = 100U;
+    WorkStealingDeque<size_t> deque(INITIAL_CAPACITY);
+    std::vector<size_t> values(COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        values[i] = i;
+        deque.PushBottom(&values[i]);
+    }
+    ASSERT_EQ(deque.SizeApprox(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        auto *v = deque.Steal();
+        ASSERT_NE(v, nullptr);
+        ASSERT_EQ(*v, i);
+    }
+    ASSERT_TRUE(deque.IsEmptyApprox());
+}
+
+// Each element must be taken exactly once, either by the owner or by one of the thieves
+TEST(WorkStealingDequeTest, ConcurrentSteal)
+{
+    static constexpr size_t COUNT = 100000U;
+    static constexpr size_t THIEVES_COUNT = 4U;
+    static constexpr size_t OWNER_POP_PERIOD = 3U;
+    WorkStealingDeque<size_t> deque(2U);
+    std::vector<size_t> values(COUNT);
+    std::vector<std::atomic<uint32_t>> taken(COUNT);
+    std::atomic<bool> pushFinished = false;
+
+    auto take = [&taken](size_t *v) {
+        // Atomic with relaxed order reason: only the final values are checked after the threads are joined
+        taken[*v].fetch_add(1U, std::memory_order_relaxed);
+    };
+    std::vector<std::thread> thieves;
+    for (size_t i = 0; i < THIEVES_COUNT; ++i) {
+        thieves.emplace_back([&deque, &pushFinished, &take]() {
+            // Atomic with acquire order reason: the owner's pushes must be visible
+            while (!pushFinished.load(std::memory_order_acquire) || !deque.IsEmptyApprox()) {
+                auto *v = deque.Steal();
+                if (v != nullptr) {
+                    take(v);
+                }
+            }
+        });
+    }
+    for (size_t i = 0; i < COUNT; ++i) {
+        values[i] = i;
+        deque.PushBottom(&values[i]);
+        if (i % OWNER_POP_PERIOD == 0U) {
+            auto *v = deque.PopBottom();
+            if (v != nullptr) {
+                take(v);
+            }
+        }
+    }
+    for (auto *v = deque.PopBottom(); v != nullptr; v = deque.PopBottom()) {
+        take(v);
+    }
+    // Atomic with release order reason: the owner's pushes must be visible
+    pushFinished.store(true, std::memory_order_release);
+    for (auto &t : thieves) {
+        t.join();
+    }
+    for (size_t i = 0; i < COUNT; ++i) {
+        // Atomic with relaxed order reason: the threads are joined already
+        ASSERT_EQ(taken[i].load(std::memory_order_relaxed), 1U) << "element " << i;
+    }
+}
+
+}  // namespace ark::test
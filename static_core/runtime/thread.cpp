@@ -164,6 +164,7 @@ ManagedThread::ManagedThread(ThreadId id, mem::InternalAllocatorPtr allocator, P
     InitThreadRandomState();
     ASSERT(zeroTlab_ != nullptr);
     tlab_ = zeroTlab_;
+    tenuredTlab_ = zeroTlab_;
     entrypointsTable_ = Runtime::GetCurrent()->GetEntrypointsTable();
     stackFrameAllocator_ =
         allocator->New<mem::StackFrameAllocator>(Runtime::GetOptions().UseMallocForInternalAllocations());
@@ -198,6 +199,7 @@ ManagedThread::~ManagedThread()
     // (zero_tlab == nullptr means that we destroyed Runtime and do not need to register TLAB)
     if (zeroTlab_ != nullptr) {
         ASSERT(tlab_ == zeroTlab_);
+        ASSERT(tenuredTlab_ == zeroTlab_);
     }
 
     mem::InternalAllocatorPtr allocator = GetInternalAllocator(this);
@@ -205,6 +207,7 @@ ManagedThread::~ManagedThread()
     allocator->Delete(taggedGlobalHandleStorage_);
     allocator->Delete(taggedHandleStorage_);
     allocator->Delete(weightedAdaptiveTlabAverage_);
+    allocator->Delete(allocationSamples_);
     mem::InternalAllocator<>::FinalizeLocalInternalAllocator(internalLocalAllocator_,
                                                              static_cast<mem::Allocator *>(allocator));
     internalLocalAllocator_ = nullptr;
@@ -538,6 +541,34 @@ void ManagedThread::ClearTLAB()
 {
     ASSERT(zeroTlab_ != nullptr);
     tlab_ = zeroTlab_;
+    // The thread may be reused after termination, so it must not keep a TLAB of the region freed by GC
+    ClearTenuredTLAB();
+}
+
+void ManagedThread::UpdateTenuredTLAB(mem::TLAB *tlab, uintptr_t *liveBitmap, uintptr_t liveBitmapBegin)
+{
+    ASSERT(tenuredTlab_ != nullptr);
+    ASSERT(tlab != nullptr);
+    ASSERT(liveBitmap != nullptr);
+    tenuredTlab_ = tlab;
+    tenuredTlabLiveBitmap_ = liveBitmap;
+    tenuredTlabLiveBitmapBegin_ = liveBitmapBegin;
+}
+
+mem::AllocationSamples *ManagedThread::GetOrCreateAllocationSamples()
+{
+    if (UNLIKELY(allocationSamples_ == nullptr)) {
+        allocationSamples_ = GetInternalAllocator(this)->New<mem::AllocationSamples>();
+    }
+    return allocationSamples_;
+}
+
+void ManagedThread::ClearTenuredTLAB()
+{
+    ASSERT(zeroTlab_ != nullptr);
+    tenuredTlab_ = zeroTlab_;
+    tenuredTlabLiveBitmap_ = nullptr;
+    tenuredTlabLiveBitmapBegin_ = 0;
 }
 
 /* Common actions for creation of the thread. */
@@ -811,6 +842,7 @@ void ManagedThread::FreeInternalMemory()
 
     allocator->Delete(ptThreadInfo_.release());
     allocator->Delete(weightedAdaptiveTlabAverage_);
+    allocator->Delete(allocationSamples_);
 
     taggedHandleScopes_.~PandaVector<HandleScope<coretypes::TaggedType> *>();
     allocator->Delete(taggedHandleStorage_);
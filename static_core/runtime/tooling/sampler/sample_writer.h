@@ -24,6 +24,7 @@
 
 #include "runtime/tooling/sampler/sample_info.h"
 #include "runtime/tooling/sampler/samples_record.h"
+#include "runtime/tooling/sampler/stack_aggregator.h"
 
 #include <unordered_set>
 
@@ -155,6 +156,38 @@ private:
     std::shared_ptr<SamplesRecord> samplesRecord_ = nullptr;
 };
 
+/*
+ * Writer for the continuous profiling: samples are folded in process by StackAggregator,
+ * which periodically flushes them in folded stacks format instead of writing every raw sample.
+ */
+class AggregatingStreamWriter final : public StreamWriter {
+public:
+    explicit AggregatingStreamWriter(std::shared_ptr<StackAggregator> stackAggregator)
+        : stackAggregator_(std::move(stackAggregator))
+    {
+        ASSERT(stackAggregator_ != nullptr);
+    }
+    ~AggregatingStreamWriter() override = default;
+    PANDA_PUBLIC_API void WriteModule(const FileInfo &moduleInfo) override
+    {
+        UNUSED_VAR(moduleInfo);
+    }
+    PANDA_PUBLIC_API void WriteSample(const SampleInfo &sample) const override
+    {
+        stackAggregator_->AddSample(sample);
+    }
+    bool IsModuleWritten(const FileInfo &moduleInfo) const override
+    {
+        UNUSED_VAR(moduleInfo);
+        return true;
+    }
+    NO_COPY_SEMANTIC(AggregatingStreamWriter);
+    NO_MOVE_SEMANTIC(AggregatingStreamWriter);
+
+private:
+    std::shared_ptr<StackAggregator> stackAggregator_;
+};
+
 }  // namespace ark::tooling::sampler
 
 #endif  // PANDA_RUNTIME_TOOLING_SAMPLER_SAMPLE_WRITER_H
@@ -39,6 +39,17 @@ static std::atomic<size_t> g_sLostSegvSamples = 0;
 static std::atomic<size_t> g_sLostInvalidSamples = 0;
 static std::atomic<size_t> g_sLostNotFindSamples = 0;
 static std::atomic<size_t> g_sTotalSamples = 0;
+static std::atomic<size_t> g_sDroppedSamples = 0;
+static std::atomic<uint64_t> g_sSignalHandlerTimeNs = 0;
+
+static uint64_t GetNanosecondsTimeStamp()
+{
+    static constexpr uint64_t NSEC_PER_SEC = 1000ULL * 1000 * 1000;
+    struct timespec time {};
+    // clock_gettime is async-signal-safe
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<uint64_t>(time.tv_sec) * NSEC_PER_SEC + static_cast<uint64_t>(time.tv_nsec);
+}
 
 class ScopedThreadSampling {
 public:
@@ -62,6 +73,22 @@ private:
     NO_MOVE_SEMANTIC(ScopedThreadSampling);
 };
 
+class ScopedHandlerTiming {
+public:
+    explicit ScopedHandlerTiming() : start_(GetNanosecondsTimeStamp()) {}
+
+    ~ScopedHandlerTiming()
+    {
+        g_sSignalHandlerTimeNs += GetNanosecondsTimeStamp() - start_;
+    }
+
+    NO_COPY_SEMANTIC(ScopedHandlerTiming);
+    NO_MOVE_SEMANTIC(ScopedHandlerTiming);
+
+private:
+    uint64_t start_;
+};
+
 class ScopedHandlersCounting {
 public:
     explicit ScopedHandlersCounting()
@@ -194,11 +221,14 @@ void Sampler::ReleaseSampleSlots(const SampleInfo &sample)
 
 static void LogProfilerStats()
 {
+    static constexpr uint64_t NSEC_PER_USEC = 1000;
     LOG(INFO, PROFILER) << "Total samples: " << g_sTotalSamples;
     LOG(INFO, PROFILER) << "Lost samples: " << g_sLostSamples;
     LOG(INFO, PROFILER) << "Lost samples(Invalid method ptr): " << g_sLostInvalidSamples;
     LOG(INFO, PROFILER) << "Lost samples(Invalid pf ptr): " << g_sLostNotFindSamples;
     LOG(INFO, PROFILER) << "Lost samples(SIGSEGV occured): " << g_sLostSegvSamples;
+    LOG(INFO, PROFILER) << "Dropped samples: " << g_sDroppedSamples;
+    LOG(INFO, PROFILER) << "Signal handler time: " << g_sSignalHandlerTimeNs / NSEC_PER_USEC << "us";
 }
 
 /* static */
@@ -645,6 +675,14 @@ static bool CollectFrames(SamplerFrameInfo &frameInfo, SampleInfo &sample, size_
     return false;
 }
 
+static void SendSample(const SampleInfo &sample)
+{
+    const ThreadCommunicator &communicator = Sampler::GetSampleCommunicator();
+    if (!communicator.SendSample(sample)) {
+        g_sDroppedSamples++;
+    }
+}
+
 static void SendHybridSampleIfPresent(SampleInfo &sample, size_t stackCounter)
 {
     if (stackCounter == 0) {
@@ -653,8 +691,7 @@ static void SendHybridSampleIfPresent(SampleInfo &sample, size_t stackCounter)
 
     sample.stackInfo.managedStackSize = stackCounter;
     sample.timeStamp = Sampler::GetMicrosecondsTimeStamp();
-    const ThreadCommunicator &communicator = Sampler::GetSampleCommunicator();
-    communicator.SendSample(sample);
+    SendSample(sample);
     LOG(DEBUG, PROFILER) << "Hybrid stack sample sent with " << stackCounter << " frames";
 }
 
@@ -728,9 +765,7 @@ static void ProcessSample(SamplerFrameInfo &frameInfo, SampleInfo &sample, size_
         return;
     }
     sample.stackInfo.managedStackSize = stackCounter;
-
-    const ThreadCommunicator &communicator = Sampler::GetSampleCommunicator();
-    communicator.SendSample(sample);
+    SendSample(sample);
 }
 
 void SigProfSamplingProfilerHandler([[maybe_unused]] int signum, [[maybe_unused]] siginfo_t *siginfo,
@@ -742,6 +777,7 @@ void SigProfSamplingProfilerHandler([[maybe_unused]] int signum, [[maybe_unused]
         return;
     }
     auto scopedHandlersCounting = ScopedHandlersCounting();
+    auto scopedHandlerTiming = ScopedHandlerTiming();
 
     Coroutine *coro = Coroutine::GetCurrent();
     if (coro != nullptr && coro->GetCoroutineStatus() != Coroutine::Status::RUNNING) {
@@ -883,6 +919,16 @@ void Sampler::ListenerThreadEntry(std::unique_ptr<StreamWriter> writerPtr)
     }
 }
 
+SamplerOverheadStats Sampler::GetOverheadStats()
+{
+    SamplerOverheadStats stats;
+    stats.totalSamples = g_sTotalSamples;
+    stats.lostSamples = g_sLostSamples;
+    stats.droppedSamples = g_sDroppedSamples;
+    stats.signalHandlerTimeNs = g_sSignalHandlerTimeNs;
+    return stats;
+}
+
 uint64_t Sampler::GetMicrosecondsTimeStamp()
 {
     static constexpr int USEC_PER_SEC = 1000 * 1000;
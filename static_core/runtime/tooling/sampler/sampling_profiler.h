@@ -38,6 +38,16 @@ namespace test {
 class SamplerTest;
 }  // namespace test
 
+struct SamplerOverheadStats {
+    size_t totalSamples {0};
+    // Samples lost while walking the stack (invalid frames, SIGSEGV)
+    size_t lostSamples {0};
+    // Samples collected but not passed to the listener thread
+    size_t droppedSamples {0};
+    // Total time spent in the SIGPROF handler by all the threads
+    uint64_t signalHandlerTimeNs {0};
+};
+
 // Panda sampling profiler
 class Sampler final : public RuntimeListener {
 public:
@@ -94,6 +104,7 @@ public:
     void ThreadEnd(ManagedThread *managedThread) override;
     void LoadModule(std::string_view name) override;
     static PANDA_PUBLIC_API uint64_t GetMicrosecondsTimeStamp();
+    static PANDA_PUBLIC_API SamplerOverheadStats GetOverheadStats();
 
     static constexpr uint32_t DEFAULT_SAMPLE_INTERVAL_US = 500;
     // Maximum serialized size for a single plugin (dynamic) frame: 1280 bytes.
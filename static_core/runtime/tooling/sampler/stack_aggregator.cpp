@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/tooling/sampler/stack_aggregator.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "libarkbase/utils/hash.h"
+#include "libarkbase/utils/logger.h"
+#include "libarkbase/utils/math_helpers.h"
+#include "libarkbase/utils/time.h"
+#include "libarkfile/file.h"
+#include "libarkfile/method_data_accessor.h"
+#include "runtime/include/tooling/buffer_serializer.h"
+#include "zip_archive.h"
+
+namespace ark::tooling::sampler {
+
+size_t StackAggregator::FrameHash::operator()(const Frame &frame) const
+{
+    return MergeHashes(std::hash<uintptr_t> {}(frame.pandaFilePtr), std::hash<uintptr_t> {}(frame.fileId));
+}
+
+StackAggregator::StackAggregator(Options options) : options_(std::move(options))
+{
+    ASSERT(options_.maxStacks > 0);
+    ASSERT(options_.maxFrames >= SampleInfo::StackInfo::MAX_STACK_DEPTH);
+    os::memory::LockHolder holder(lock_);
+    // Keep the load factor of the hash table not greater than 0.5
+    stacks_.resize(helpers::math::GetPowerOfTwoValue32(options_.maxStacks * 2U));
+    framesArena_.reserve(options_.maxFrames);
+    externalFramesData_.reserve(options_.maxExternalFramesBytes);
+    lastFlushTime_ = time::GetCurrentTimeInMicros();
+}
+
+StackAggregator::~StackAggregator()
+{
+    os::memory::LockHolder holder(lock_);
+    FlushImpl();
+    LOG(INFO, PROFILER) << "Aggregated samples: " << stats_.aggregatedSamples
+                        << ", dropped samples: " << stats_.droppedSamples
+                        << ", unwritten samples: " << stats_.unwrittenSamples
+                        << ", dropped external frames: " << stats_.droppedFrames << ", flushed stacks: " << stats_.flushedStacks << " in " << stats_.flushes << " flushes";
+}
+
+void StackAggregator::AddSample(const SampleInfo &sample)
+{
+    os::memory::LockHolder holder(lock_);
+    if (time::GetCurrentTimeInMicros() - lastFlushTime_ >= options_.flushIntervalUs) {
+        FlushImpl();
+    }
+    size_t droppedFrames = 0;
+    size_t depth = CollectFrames(sample, &droppedFrames);
+    if (depth == 0 && droppedFrames == 0) {
+        return;
+    }
+    if (droppedFrames != 0 || !InsertStack(depth, sample.threadInfo.threadStatus)) {
+        // The storage is reset even if writing fails
+        FlushImpl();
+        depth = CollectFrames(sample, &droppedFrames);
+        stats_.droppedFrames += droppedFrames;
+        if (depth == 0 || !InsertStack(depth, sample.threadInfo.threadStatus)) {
+            stats_.droppedSamples++;
+            return;
+        }
+    }
+    stats_.aggregatedSamples++;
+}
+
+size_t StackAggregator::CollectFrames(const SampleInfo &sample, size_t *droppedFrames)
+{
+    size_t depth = 0;
+    *droppedFrames = 0;
+    for (size_t i = 0; i < sample.stackInfo.managedStackSize; ++i) {
+        const auto &frameId = sample.stackInfo.managedStack[i];
+        if (frameId.pandaFilePtr == 0 || frameId.pandaFilePtr == helpers::ToUnderlying(FrameKind::BRIDGE)) {
+            continue;
+        }
+        Frame frame {frameId.pandaFilePtr, frameId.fileId};
+        if (frameId.pandaFilePtr == helpers::ToUnderlying(FrameKind::EXTERNAL_FRAME)) {
+            if (frameId.extFrameData == nullptr) {
+                continue;
+            }
+            // Slot with the frame data is reused by the sampler, so the data is copied now and parsed on flush
+            auto offset = InternExternalFrame(
+                std::string_view(static_cast<const char *>(frameId.extFrameData), frameId.extFrameDataSize));
+            if (!offset.has_value()) {
+                (*droppedFrames)++;
+                continue;
+            }
+            frame.fileId = *offset;
+        }
+        framesBuffer_[depth++] = frame;
+    }
+    return depth;
+}
+
+std::optional<uintptr_t> StackAggregator::InternExternalFrame(std::string_view data)
+{
+    auto it = externalFrames_.find(data);
+    if (it != externalFrames_.end()) {
+        return it->second;
+    }
+    auto size = static_cast<uint32_t>(data.size());
+    if (externalFramesData_.size() + sizeof(size) + data.size() > options_.maxExternalFramesBytes) {
+        return std::nullopt;
+    }
+    uintptr_t offset = externalFramesData_.size();
+    const auto *sizeBytes = reinterpret_cast<const uint8_t *>(&size);
+    externalFramesData_.insert(externalFramesData_.end(), sizeBytes, sizeBytes + sizeof(size));
+    externalFramesData_.insert(externalFramesData_.end(), data.begin(), data.end());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto *copy = reinterpret_cast<const char *>(externalFramesData_.data() + offset + sizeof(size));
+    externalFrames_.emplace(std::string_view(copy, data.size()), offset);
+    return offset;
+}
+
+bool StackAggregator::IsStackEqual(const Stack &stack, size_t depth, SampleInfo::ThreadStatus threadStatus) const
+{
+    if (stack.depth != depth || stack.threadStatus != threadStatus) {
+        return false;
+    }
+    for (size_t i = 0; i < depth; ++i) {
+        if (!(framesArena_[stack.framesBegin + i] == framesBuffer_[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StackAggregator::InsertStack(size_t depth, SampleInfo::ThreadStatus threadStatus)
+{
+    ASSERT(depth > 0);
+    auto hash = static_cast<uint32_t>(helpers::ToUnderlying(threadStatus));
+    for (size_t i = 0; i < depth; ++i) {
+        hash = static_cast<uint32_t>(MergeHashes(static_cast<size_t>(hash), FrameHash {}(framesBuffer_[i])));
+    }
+    size_t mask = stacks_.size() - 1U;
+    for (size_t index = hash & mask;; index = (index + 1U) & mask) {
+        auto &stack = stacks_[index];
+        if (stack.count == 0) {
+            // Empty slot, the stack is new
+            if (stacksCount_ == options_.maxStacks || framesArena_.size() + depth > options_.maxFrames) {
+                return false;
+            }
+            stack.hash = hash;
+            stack.framesBegin = static_cast<uint32_t>(framesArena_.size());
+            stack.depth = static_cast<uint32_t>(depth);
+            stack.threadStatus = threadStatus;
+            stack.count = 1;
+            framesArena_.insert(framesArena_.end(), framesBuffer_.begin(), framesBuffer_.begin() + depth);
+            stacksCount_++;
+            return true;
+        }
+        if (stack.hash == hash && IsStackEqual(stack, depth, threadStatus)) {
+            stack.count++;
+            return true;
+        }
+    }
+}
+
+void StackAggregator::WriteFrameName(std::ostream &out, const Frame &frame)
+{
+    if (frame.pandaFilePtr == helpers::ToUnderlying(FrameKind::EXTERNAL_FRAME)) {
+        ASSERT(frame.fileId + sizeof(uint32_t) <= externalFramesData_.size());
+        const uint8_t *sizePtr = externalFramesData_.data() + frame.fileId;
+        uint32_t size = ReadUint32TBitMisaligned(sizePtr);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto data = BufferSerializer::ReadPluginFrameData(sizePtr + sizeof(size), size);
+        out << data.functionName << " (" << data.url << ")";
+        return;
+    }
+    auto it = methodNames_.find(frame);
+    if (it == methodNames_.end()) {
+        // Sampler collects frames only of the panda files it was notified about, so the pointer is valid
+        const auto *pf = reinterpret_cast<const panda_file::File *>(frame.pandaFilePtr);
+        panda_file::MethodDataAccessor mda(*pf, panda_file::File::EntityId(frame.fileId));
+        it = methodNames_.emplace(frame, mda.GetFullName()).first;
+    }
+    out << it->second;
+}
+
+void StackAggregator::DumpFoldedStacksImpl(std::ostream &out)
+{
+    for (const auto &stack : stacks_) {
+        if (stack.count == 0) {
+            continue;
+        }
+        out << (stack.threadStatus == SampleInfo::ThreadStatus::SUSPENDED ? "(suspended)" : "(running)");
+        // Folded format starts from the root frame
+        for (size_t i = stack.depth; i > 0; --i) {
+            out << ';';
+            WriteFrameName(out, framesArena_[stack.framesBegin + i - 1U]);
+        }
+        out << ' ' << stack.count << '\n';
+    }
+}
+
+void StackAggregator::DumpFoldedStacks(std::ostream &out)
+{
+    os::memory::LockHolder holder(lock_);
+    DumpFoldedStacksImpl(out);
+}
+
+bool StackAggregator::WriteOutput(const std::string &folded)
+{
+    if (options_.outputFile.empty()) {
+        return true;
+    }
+    if (options_.compress) {
+        std::vector<uint8_t> buffer(folded.begin(), folded.end());
+        std::string entryName = "folded_" + std::to_string(flushIndex_) + ".txt";
+        int append = flushIndex_ == 0 ? APPEND_STATUS_CREATE : APPEND_STATUS_ADDINZIP;
+        return CreateOrAddFileIntoZip(options_.outputFile.c_str(), entryName.c_str(), &buffer, append,
+                                      Z_BEST_SPEED) == ZIPARCHIVE_OK;
+    }
+    auto mode = flushIndex_ == 0 ? std::ios::trunc : std::ios::app;
+    std::ofstream out(options_.outputFile, std::ios::out | mode);
+    out << folded;
+    return out.good();
+}
+
+bool StackAggregator::FlushImpl()
+{
+    lastFlushTime_ = time::GetCurrentTimeInMicros();
+    if (stacksCount_ == 0) {
+        return true;
+    }
+    if (!outputFailed_) {
+        std::stringstream folded;
+        DumpFoldedStacksImpl(folded);
+        if (WriteOutput(folded.str())) {
+            stats_.flushedStacks += stacksCount_;
+            stats_.flushes++;
+            flushIndex_++;
+            Reset();
+            return true;
+        }
+        LOG(ERROR, PROFILER) << "Failed to write aggregated samples to " << options_.outputFile
+                             << ", the output is disabled";
+        outputFailed_ = true;
+    }
+    // Sampling goes on, but the stacks are only counted
+    for (const auto &stack : stacks_) {
+        stats_.unwrittenSamples += stack.count;
+    }
+    Reset();
+    return false;
+}
+
+bool StackAggregator::Flush()
+{
+    os::memory::LockHolder holder(lock_);
+    return FlushImpl();
+}
+
+void StackAggregator::Reset()
+{
+    std::fill(stacks_.begin(), stacks_.end(), Stack {});
+    stacksCount_ = 0;
+    framesArena_.clear();
+    externalFramesData_.clear();
+    externalFrames_.clear();
+    methodNames_.clear();
+}
+
+StackAggregatorStats StackAggregator::GetStats()
+{
+    os::memory::LockHolder holder(lock_);
+    return stats_;
+}
+
+}  // namespace ark::tooling::sampler
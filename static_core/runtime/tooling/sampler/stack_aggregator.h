@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PANDA_RUNTIME_TOOLING_SAMPLER_STACK_AGGREGATOR_H
+#define PANDA_RUNTIME_TOOLING_SAMPLER_STACK_AGGREGATOR_H
+
+#include <array>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "libarkbase/os/mutex.h"
+#include "runtime/tooling/sampler/sample_info.h"
+
+namespace ark::tooling::sampler {
+
+struct StackAggregatorStats {
+    // Samples folded into the stacks
+    uint64_t aggregatedSamples {0};
+    // Samples which could not be stored, e.g. when the storage is full of the stacks of a single sample
+    uint64_t droppedSamples {0};
+    // Aggregated samples which were discarded without writing, because writing the output failed
+    uint64_t unwrittenSamples {0};
+    // External frames omitted from the stored stacks, because the storage of their data is full
+    uint64_t droppedFrames {0};
+    // Unique stacks written by all the flushes
+    uint64_t flushedStacks {0};
+    uint64_t flushes {0};
+};
+
+/**
+ * In-process aggregation of the sampled call stacks.
+ *
+ * Instead of storing every raw sample, samples with equal stacks are folded into one stack with a hit count.
+ * The frames are stored per method (bytecode offsets are ignored) in an arena which is reserved on construction,
+ * so folding a sample doesn't allocate and the memory used by a continuously running profiler is bounded.
+ * The data of the dynamic (external) frames is copied as is into a buffer, which is reserved too, once per distinct
+ * frame. The names of all the frames are resolved only on flush.
+ * When the storage is full or the flush interval has elapsed, the stacks are written to the output
+ * in folded format ("root;...;leaf count", one line per stack), which is consumed by the flamegraph tools,
+ * and the storage is reset.
+ * If compression is enabled the output is a zip archive with a deflated entry per flush.
+ * Writing is not retried after a failure: the later flushes only discard the stacks.
+ */
+class StackAggregator {
+public:
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr size_t DEFAULT_MAX_STACKS = 8192;
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr size_t DEFAULT_MAX_FRAMES = 128 * 1024;
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr size_t DEFAULT_MAX_EXTERNAL_FRAMES_BYTES = 256 * 1024;
+    // CC-OFFNXT(G.NAM.03-CPP) project code style
+    static constexpr uint64_t DEFAULT_FLUSH_INTERVAL_US = 60ULL * 1000 * 1000;
+
+    struct Options {
+        std::string outputFile;
+        uint64_t flushIntervalUs {DEFAULT_FLUSH_INTERVAL_US};
+        size_t maxStacks {DEFAULT_MAX_STACKS};
+        size_t maxFrames {DEFAULT_MAX_FRAMES};
+        size_t maxExternalFramesBytes {DEFAULT_MAX_EXTERNAL_FRAMES_BYTES};
+        bool compress {true};
+    };
+
+    PANDA_PUBLIC_API explicit StackAggregator(Options options);
+    PANDA_PUBLIC_API ~StackAggregator();
+
+    NO_COPY_SEMANTIC(StackAggregator);
+    NO_MOVE_SEMANTIC(StackAggregator);
+
+    /// Folds @param sample, the storage is flushed before if it is full or the flush interval has elapsed
+    PANDA_PUBLIC_API void AddSample(const SampleInfo &sample);
+
+    /// Writes the aggregated stacks to the output and resets the storage, @return false if writing failed
+    PANDA_PUBLIC_API bool Flush();
+
+    /// Writes the aggregated stacks in folded format to @param out without resetting the storage
+    PANDA_PUBLIC_API void DumpFoldedStacks(std::ostream &out);
+
+    PANDA_PUBLIC_API StackAggregatorStats GetStats();
+
+    size_t GetStacksCount()
+    {
+        os::memory::LockHolder holder(lock_);
+        return stacksCount_;
+    }
+
+private:
+    struct Frame {
+        uintptr_t pandaFilePtr {0};
+        uintptr_t fileId {0};
+
+        bool operator==(const Frame &other) const
+        {
+            return pandaFilePtr == other.pandaFilePtr && fileId == other.fileId;
+        }
+    };
+
+    struct FrameHash {
+        size_t operator()(const Frame &frame) const;
+    };
+
+    struct Stack {
+        uint32_t hash {0};
+        uint32_t framesBegin {0};
+        uint32_t depth {0};
+        SampleInfo::ThreadStatus threadStatus {SampleInfo::ThreadStatus::UNDECLARED};
+        uint64_t count {0};
+    };
+
+    /**
+     * @return number of frames written to framesBuffer_ or 0 if the sample has no frames to store,
+     * @param droppedFrames is set to the number of the omitted external frames
+     */
+    size_t CollectFrames(const SampleInfo &sample, size_t *droppedFrames) REQUIRES(lock_);
+    /// @return offset of the copy of the external frame @param data or std::nullopt if there is no space for it
+    std::optional<uintptr_t> InternExternalFrame(std::string_view data) REQUIRES(lock_);
+    /// @return false if there is no space for a new stack
+    bool InsertStack(size_t depth, SampleInfo::ThreadStatus threadStatus) REQUIRES(lock_);
+    bool IsStackEqual(const Stack &stack, size_t depth, SampleInfo::ThreadStatus threadStatus) const REQUIRES(lock_);
+    void DumpFoldedStacksImpl(std::ostream &out) REQUIRES(lock_);
+    void WriteFrameName(std::ostream &out, const Frame &frame) REQUIRES(lock_);
+    bool FlushImpl() REQUIRES(lock_);
+    bool WriteOutput(const std::string &folded) REQUIRES(lock_);
+    void Reset() REQUIRES(lock_);
+
+    Options options_;
+    os::memory::Mutex lock_;
+    // Open addressing hash table of the stacks, its size is a power of two
+    std::vector<Stack> stacks_ GUARDED_BY(lock_);
+    size_t stacksCount_ GUARDED_BY(lock_) {0};
+    // Frames of all the stacks, leaf frame first
+    std::vector<Frame> framesArena_ GUARDED_BY(lock_);
+    std::array<Frame, SampleInfo::StackInfo::MAX_STACK_DEPTH> framesBuffer_ GUARDED_BY(lock_) {};
+    // Size prefixed data of the external frames of the current aggregation period, frame id is an offset here.
+    // It is never reallocated, so the keys of externalFrames_ point into it
+    std::vector<uint8_t> externalFramesData_ GUARDED_BY(lock_);
+    std::unordered_map<std::string_view, uintptr_t> externalFrames_ GUARDED_BY(lock_);
+    // Names of the managed frames of the current aggregation period, resolved on flush
+    std::unordered_map<Frame, std::string, FrameHash> methodNames_ GUARDED_BY(lock_);
+    uint64_t lastFlushTime_ GUARDED_BY(lock_) {0};
+    uint32_t flushIndex_ GUARDED_BY(lock_) {0};
+    bool outputFailed_ GUARDED_BY(lock_) {false};
+    StackAggregatorStats stats_ GUARDED_BY(lock_);
+};
+
+}  // namespace ark::tooling::sampler
+
+#endif  // PANDA_RUNTIME_TOOLING_SAMPLER_STACK_AGGREGATOR_H
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PANDA_RUNTIME_VECTOR_KERNELS_H
+#define PANDA_RUNTIME_VECTOR_KERNELS_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "compiler/optimizer/ir/runtime_interface.h"
+#include "libarkbase/macros.h"
+#include "libarkbase/utils/vector_helpers.h"
+#include "runtime/include/coretypes/array.h"
+
+/**
+ * Kernels of the element-wise array operations, which the LoopVectorization pass calls instead of the scalar loops.
+ * The tail is computed in a zero padded vector, so every element is computed by the same vector instruction.
+ * Integer elements are processed as unsigned ones, so the result wraps around as the result of the scalar loop does.
+ */
+namespace ark::intrinsics::vector {
+
+using ark::helpers::vector::Vector;
+using ark::helpers::vector::VectorType;
+
+template <compiler::VectorOp OP, typename V>
+ALWAYS_INLINE inline V ApplyOp(V lhs, V rhs)
+{
+    if constexpr (OP == compiler::VectorOp::ADD) {
+        return lhs + rhs;
+    } else if constexpr (OP == compiler::VectorOp::SUB) {
+        return lhs - rhs;
+    } else if constexpr (OP == compiler::VectorOp::REVERSE_SUB) {
+        return rhs - lhs;
+    } else if constexpr (OP == compiler::VectorOp::MUL) {
+        return lhs * rhs;
+    } else if constexpr (OP == compiler::VectorOp::DIV) {
+        return lhs / rhs;
+    } else if constexpr (OP == compiler::VectorOp::REVERSE_DIV) {
+        return rhs / lhs;
+    } else if constexpr (OP == compiler::VectorOp::AND) {
+        return lhs & rhs;
+    } else if constexpr (OP == compiler::VectorOp::OR) {
+        return lhs | rhs;
+    } else {
+        static_assert(OP == compiler::VectorOp::XOR);
+        return lhs ^ rhs;
+    }
+}
+
+template <typename T>
+ALWAYS_INLINE inline VectorType<T> LoadVector(const T *src, size_t count = Vector<T>::LANES)
+{
+    VectorType<T> vec {};
+    // Arrays data is not aligned to the vector size
+    memcpy(&vec, src, count * sizeof(T));
+    return vec;
+}
+
+template <typename T>
+ALWAYS_INLINE inline void StoreVector(T *dst, VectorType<T> vec, size_t count = Vector<T>::LANES)
+{
+    memcpy(dst, &vec, count * sizeof(T));
+}
+
+/// dst[i] = src0[i] OP src1[i] for i in [begin, end), the arrays may be the same
+template <compiler::VectorOp OP, typename T>
+void ArrayOpLoop(T *dst, const T *src0, const T *src1, size_t begin, size_t end)
+{
+    constexpr size_t LANES = Vector<T>::LANES;
+    size_t i = begin;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; i + LANES <= end; i += LANES) {
+        StoreVector(dst + i, ApplyOp<OP>(LoadVector(src0 + i), LoadVector(src1 + i)));
+    }
+    if (i < end) {
+        size_t count = end - i;
+        StoreVector(dst + i, ApplyOp<OP>(LoadVector(src0 + i, count), LoadVector(src1 + i, count)), count);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/// dst[i] = src[i] OP value for i in [begin, end), the arrays may be the same
+template <compiler::VectorOp OP, typename T>
+void ScalarOpLoop(T *dst, const T *src, T value, size_t begin, size_t end)
+{
+    constexpr size_t LANES = Vector<T>::LANES;
+    VectorType<T> broadcast {};
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        broadcast[lane] = value;
+    }
+    size_t i = begin;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; i + LANES <= end; i += LANES) {
+        StoreVector(dst + i, ApplyOp<OP>(LoadVector(src + i), broadcast));
+    }
+    if (i < end) {
+        size_t count = end - i;
+        StoreVector(dst + i, ApplyOp<OP>(LoadVector(src + i, count), broadcast), count);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/// Calls @param loop instantiated for the runtime @param op, bitwise operations are not defined for floating point
+template <typename T, typename Loop>
+ALWAYS_INLINE inline void Dispatch(uint32_t op, Loop loop)
+{
+    using compiler::VectorOp;
+    switch (static_cast<VectorOp>(op)) {
+        case VectorOp::ADD:
+            return loop(std::integral_constant<VectorOp, VectorOp::ADD> {});
+        case VectorOp::SUB:
+            return loop(std::integral_constant<VectorOp, VectorOp::SUB> {});
+        case VectorOp::REVERSE_SUB:
+            return loop(std::integral_constant<VectorOp, VectorOp::REVERSE_SUB> {});
+        case VectorOp::MUL:
+            return loop(std::integral_constant<VectorOp, VectorOp::MUL> {});
+        default:
+            break;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+        switch (static_cast<VectorOp>(op)) {
+            case VectorOp::DIV:
+                return loop(std::integral_constant<VectorOp, VectorOp::DIV> {});
+            case VectorOp::REVERSE_DIV:
+                return loop(std::integral_constant<VectorOp, VectorOp::REVERSE_DIV> {});
+            default:
+                UNREACHABLE();
+        }
+    } else {
+        switch (static_cast<VectorOp>(op)) {
+            case VectorOp::AND:
+                return loop(std::integral_constant<VectorOp, VectorOp::AND> {});
+            case VectorOp::OR:
+                return loop(std::integral_constant<VectorOp, VectorOp::OR> {});
+            case VectorOp::XOR:
+                return loop(std::integral_constant<VectorOp, VectorOp::XOR> {});
+            default:
+                UNREACHABLE();
+        }
+    }
+}
+
+template <typename T>
+T *GetData(ObjectHeader *array)
+{
+    return reinterpret_cast<T *>(coretypes::Array::Cast(array)->GetData());
+}
+
+template <typename T>
+void ArrayOp(ObjectHeader *dst, ObjectHeader *src0, ObjectHeader *src1, uint32_t op, uint32_t begin, uint32_t end)
+{
+    static_assert(std::is_unsigned_v<T> || std::is_floating_point_v<T>);
+    T *dstData = GetData<T>(dst);
+    const T *src0Data = GetData<T>(src0);
+    const T *src1Data = GetData<T>(src1);
+    Dispatch<T>(op, [dstData, src0Data, src1Data, begin, end](auto opTag) {
+        ArrayOpLoop<decltype(opTag)::value>(dstData, src0Data, src1Data, begin, end);
+    });
+}
+
+template <typename T>
+void ScalarOp(ObjectHeader *dst, ObjectHeader *src, T value, uint32_t op, uint32_t begin, uint32_t end)
+{
+    static_assert(std::is_unsigned_v<T> || std::is_floating_point_v<T>);
+    Dispatch<T>(op, [dstData = GetData<T>(dst), srcData = GetData<T>(src), value, begin, end](auto opTag) {
+        ScalarOpLoop<decltype(opTag)::value>(dstData, srcData, value, begin, end);
+    });
+}
+
+}  // namespace ark::intrinsics::vector
+
+#endif  // PANDA_RUNTIME_VECTOR_KERNELS_H
@@ -75,6 +75,7 @@ class PassConfig:
         'loop-idioms': None,
         'loop-peeling': None,
         'loop-unroll': None,
+        'loop-vectorization': None,
         'lse': 'lse-opt',
         'cse': 'cse-opt',
         'vn': 'vn-opt',
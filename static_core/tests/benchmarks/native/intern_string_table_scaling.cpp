@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how StringTable::GetOrInternString scales with the number of threads interning the same strings.
+// Correctness of the concurrent interning is covered by runtime/tests/multithreaded_intern_string_table_test.cpp
+
+#include "runtime/include/runtime.h"
+#include "runtime/include/thread.h"
+#include "runtime/string_table.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ark::benchmarks {
+
+static constexpr uint32_t MAX_THREADS = 32;
+static constexpr uint32_t STRINGS_COUNT = 4096;
+static constexpr uint32_t ITERS = 50;
+
+using TestString = std::array<uint8_t, 4U>;
+
+static std::vector<TestString> CreateStrings()
+{
+    std::vector<TestString> strings;
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    for (uint8_t second = 0x80; second < 0xc0; second++) {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        for (uint8_t third = 1; third < 0x80 && strings.size() < STRINGS_COUNT; third++) {
+            // NOLINTNEXTLINE(readability-magic-numbers)
+            strings.push_back({0xc2, second, third, 0x00});
+        }
+    }
+    return strings;
+}
+
+static void InternStrings(StringTable *table, const std::vector<TestString> &strings, uint32_t threadIdx,
+                          uint32_t threadsCount)
+{
+    auto *thisThread = MTManagedThread::Create(Runtime::GetCurrent(), Runtime::GetCurrent()->GetPandaVM());
+    thisThread->ManagedCodeBegin();
+    LanguageContext ctx = Runtime::GetCurrent()->GetLanguageContext(panda_file::SourceLang::PANDA_ASSEMBLY);
+
+    // All the threads intern the same strings starting from different positions, so the first pass mostly
+    // inserts and the rest mostly look up the already interned strings
+    for (uint32_t iter = 0; iter < ITERS; iter++) {
+        for (uint32_t i = 0; i < strings.size(); i++) {
+            auto idx = (i + threadIdx * strings.size() / threadsCount) % strings.size();
+            table->GetOrInternString(strings[idx].data(), 2U, ctx);
+        }
+    }
+
+    thisThread->ManagedCodeEnd();
+    thisThread->Destroy();
+}
+
+static void RunScaling()
+{
+    auto strings = CreateStrings();
+    for (uint32_t threadsCount = 1; threadsCount <= MAX_THREADS; threadsCount *= 2U) {
+        auto table = std::make_unique<StringTable>();
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            threads.emplace_back(InternStrings, table.get(), std::cref(strings), i, threadsCount);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        uint64_t ops = static_cast<uint64_t>(threadsCount) * ITERS * strings.size();
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        auto opsPerMs = static_cast<double>(ops) * 1000U / std::max<int64_t>(time.count(), 1);
+        std::cout << "[ INTERN   ] threads: " << threadsCount << ", ops: " << ops << ", time: " << time.count()
+                  << " us, ops/ms: " << opsPerMs << std::endl;
+        if (table->Size() != strings.size()) {
+            std::cerr << "Unexpected string table size " << table->Size() << std::endl;
+            std::abort();
+        }
+    }
+}
+
+}  // namespace ark::benchmarks
+
+int main()
+{
+    ark::RuntimeOptions options;
+    options.SetShouldLoadBootPandaFiles(false);
+    options.SetShouldInitializeIntrinsics(false);
+    options.SetGcType("epsilon");
+    options.SetCompilerEnableJit(false);
+    if (!ark::Runtime::Create(options)) {
+        std::cerr << "Cannot create runtime" << std::endl;
+        return 1;
+    }
+    auto *thread = ark::MTManagedThread::GetCurrent();
+    thread->ManagedCodeBegin();
+    ark::benchmarks::RunScaling();
+    thread->ManagedCodeEnd();
+    ark::Runtime::Destroy();
+    return 0;
+}
@@ -79,6 +79,9 @@ def add_measurement_opts(parser: argparse.ArgumentParser) -> None:
     parser.add_argument("-compiler-inlning", "--compiler-inlining",
                         default=None, type=str,
                         help="enable compiler inlining")
+    parser.add_argument("-ro", "--runtime-options", default=[],
+                        type=str, action="append",
+                        help="Sets runtime options, f.e. -ro=--gc-workers-count=4")
 
 
 def add_compiler_specific_opts(parser: argparse.ArgumentParser) -> None:
@@ -387,6 +387,7 @@ class TemplateVars:  # pylint: disable=invalid-name
     generator: str = ''
     config: Dict[str, Any] = field(default_factory=dict)
     aot_opts: str = ''
+    runtime_opts: str = ''
     disable_inlining: bool = False
     max_tag_len = 20
 
@@ -500,3 +501,7 @@ class TemplateVars:  # pylint: disable=invalid-name
                 opts = ' '.join(ovr.aot_compiler_options)
                 self.aot_opts = f'{self.aot_opts} {opts} '
                 self.config.update({'aot_opts': self.aot_opts})
+            if ovr.runtime_options:
+                opts = ' '.join(ovr.runtime_options)
+                self.runtime_opts = f'{self.runtime_opts} {opts} '
+                self.config.update({'runtime_opts': self.runtime_opts})
@@ -264,7 +264,7 @@ class BenchGenerator:
         log.trace('Bench: %s', bench_file)
         with create_file(bench_file) as f:
             f.write(bench)
-        if values.generator or values.disable_inlining or values.aot_opts:
+        if values.generator or values.disable_inlining or values.aot_opts or values.runtime_opts:
             BenchGenerator.write_config(bench_dir, values)
         if values.generator:
             BenchGenerator.process_generator(
@@ -69,7 +69,7 @@ class Tool(ToolBase):
             opts += '--safepoint-checkers-report-filepath={abc}.spcr.json '
         self.cmd = f'LD_LIBRARY_PATH={self.ark_lib} {self.ark} ' \
                    f'--boot-panda-files={self.etsstdlib} ' \
-                   f'--load-runtimes=ets {opts} {{aot_opts}} {self.custom} ' \
+                   f'--load-runtimes=ets {opts} {{aot_opts}} {{runtime_opts}} {self.custom} ' \
                    '{options} {abc} {name}.VmbLauncher::main'
 
     @property
@@ -83,7 +83,7 @@ class Tool(ToolBase):
             return ' '.join(str(res.out or res.err).split())
         return super().version
 
-    def get_cmd(self, name: str, abc: str, options: str, gclog: str, an: str) -> str:
+    def get_cmd(self, name: str, abc: str, options: str, gclog: str, an: str, runtime_opts: str = '') -> str:
         an_files = self.an_files + [an] \
             if an and (OptFlags.AOT in self.flags or OptFlags.AOTPGO in self.flags) \
             else self.an_files
@@ -94,7 +94,8 @@ class Tool(ToolBase):
         if OptFlags.AOTPGO in self.flags:
             options += '--compiler-enable-jit=false '
         return self.cmd.format(
-            name=f'{BENCH_PREFIX}{name}', abc=abc, options=options, gclog=gclog, aot_opts=aot_opts)
+            name=f'{BENCH_PREFIX}{name}', abc=abc, options=options, gclog=gclog, aot_opts=aot_opts,
+            runtime_opts=runtime_opts)
 
     def do_exec(self, bu: BenchUnit, profile: bool = False) -> None:
         bu_flags, _ = self.get_bu_opts(bu)
@@ -120,8 +121,10 @@ class Tool(ToolBase):
                         '--profilesaver-enabled=true '
                         '--compiler-enable-jit=false '
                         f'--profile-output={abc.as_posix()}.profdata ')
+        # Options of the bench unit go before the custom ones, so they could be overridden from the cmdline
         arkts_cmd = self.get_cmd(
-            name=bu.name, abc=str(abc.as_posix()), options=options, gclog=gclog, an=an)
+            name=bu.name, abc=str(abc.as_posix()), options=options, gclog=gclog, an=an,
+            runtime_opts=self.get_bu_runtime_opts(bu))
         res = self.x_run(arkts_cmd)
         if self.no_run:
             bu.status = BUStatus.NOT_RUN
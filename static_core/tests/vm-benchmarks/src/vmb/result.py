@@ -133,19 +133,22 @@ class JITStat(Jsonable):
     bc_size: int
     code_size: int
     time: int
+    queue_wait_time: int = 0
+    estimated_cost: int = 0
 
     @staticmethod
     def from_csv(csv_file: Union[str, Path]) -> List[JITStat]:
         data: List[JITStat] = []
         check_file_exists(csv_file)
         with open(csv_file, mode='r', encoding='utf-8', newline='\n') as f:
-            for method, is_osr, bc_size, code_size, time in csv.reader(
+            for method, is_osr, bc_size, code_size, time, *queue_stats in csv.reader(
                     f, delimiter=','):
                 data.append(JITStat(method,
                                     bool(int(is_osr)),
                                     int(bc_size),
                                     int(code_size),
-                                    int(time)))
+                                    int(time),
+                                    *[int(x) for x in queue_stats]))
         return data
 
 
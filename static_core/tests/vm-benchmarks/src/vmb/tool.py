@@ -220,6 +220,14 @@ class ToolBase(CrossShell, ABC):
                 aot_opts = conf_data.get('aot_opts', '')
         return flags, aot_opts
 
+    @staticmethod
+    def get_bu_runtime_opts(bu: BenchUnit) -> str:
+        conf = bu.path.joinpath('config.json')
+        if not conf.exists():
+            return ''
+        with open(conf, 'r', encoding='utf-8') as f:
+            return str(json.load(f).get('runtime_opts', ''))
+
     def custom_opts_obj(self) -> Dict[str, str]:
         re_opts = re.compile(r'^(-+)?(?P<opt>[\w\-]+)(=|\s+)(?P<val>.+)$')
         opts = {}
@@ -251,6 +251,24 @@ ETS_MEASURE_OVERRIDES = '''
     }
     '''
 
+ETS_RUNTIME_OPTIONS = '''
+    /**
+    * @State
+    * @Benchmark -ro=--gc-workers-count=4
+    */
+    class X {
+    /**
+    * @Benchmark -ro=--gc-work-stealing-marking=true
+    */
+    public one(): int {
+    }
+    /**
+    * @Benchmark
+    */
+    public two(): bool {
+    }
+    '''
+
 ets_mod = get_plugin('langs', 'ets')
 ts_mod = get_plugin('langs', 'ts')
 js_mod = get_plugin('langs', 'js')
@@ -447,6 +465,21 @@ def test_measure_overrides():
         test.assertTrue(var2.gc == -1)
 
 
+def test_runtime_options():
+    ets = ets_mod.Lang()
+    test = TestCase()
+    parser = DocletParser.create(ETS_RUNTIME_OPTIONS, ets).parse()
+    test.assertTrue(parser.state is not None)
+    test.assertEqual(['--gc-workers-count=4'], vars(parser.state.bench_args)['runtime_options'])
+    with patch.object(sys, 'argv', 'vmb gen --lang ets blah'.split()):
+        args = Args()
+        var1, var2 = list(TemplateVars.params_from_parsed('', parser.state, args))
+        # Class options go first, so the bench could override them
+        test.assertEqual(['--gc-workers-count=4', '--gc-work-stealing-marking=true'], var1.runtime_opts.split())
+        test.assertEqual(var1.runtime_opts, var1.config['runtime_opts'])
+        test.assertEqual(['--gc-workers-count=4'], var2.runtime_opts.split())
+
+
 def test_tags():
     src = '''
     /**